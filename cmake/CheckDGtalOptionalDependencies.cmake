@@ -466,7 +466,7 @@ IF(WITH_FFTW3)
   IF(FFTW3_FOUND)
     SET(FFTW3_FOUND_DGTAL 1)
     ADD_DEFINITIONS("-DWITH_FFTW3 ")
-    INCLUDE_DIRECTORIES(${FFTW3_INCLUDES})
+    INCLUDE_DIRECTORIES(${FFTW3_INCLUDE_DIR})
     SET(DGtalLibDependencies ${DGtalLibDependencies} ${FFTW3_LIBRARIES} ${FFTW3_DEP_LIBRARIES} )
     message(STATUS "FFTW3 is found : ${FFTW3_LIBRARIES}.")
   ELSE(FFTW3_FOUND)
@@ -0,0 +1,420 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CompressedRanges.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module CompressedRanges.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CompressedRanges_RECURSES)
+#error Recursive header files inclusion detected in CompressedRanges.h
+#else // defined(CompressedRanges_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CompressedRanges_RECURSES
+
+#if !defined CompressedRanges_h
+/** Prevents repeated inclusion of headers. */
+#define CompressedRanges_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+#include <atomic>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConstSpan
+  /**
+   * Description of template class 'ConstSpan' <p>
+   * \brief Aim: A lightweight non-mutable view on a contiguous range
+   * of values, i.e. a pair of pointers. It is the range type of
+   * CompressedRanges, and it is converted implicitly to a std::vector
+   * when a copy of the values is needed.
+   *
+   * @tparam T the type of the values.
+   */
+  template < typename T >
+  class ConstSpan
+  {
+  public:
+    typedef T               value_type;
+    typedef const T*        const_iterator;
+    typedef const T*        iterator;
+    typedef const T&        const_reference;
+    typedef const T&        reference;
+    typedef std::size_t     size_type;
+    typedef std::ptrdiff_t  difference_type;
+    typedef std::reverse_iterator< const T* > const_reverse_iterator;
+    typedef const_reverse_iterator            reverse_iterator;
+
+    /// Constructor. The span is empty.
+    ConstSpan() : myBegin( 0 ), myEnd( 0 ) {}
+
+    /// Constructor from two pointers.
+    /// @param first the beginning of the range.
+    /// @param last the end of the range.
+    ConstSpan( const T* first, const T* last ) : myBegin( first ), myEnd( last ) {}
+
+    /// @return an iterator on the first value.
+    const_iterator begin() const  { return myBegin; }
+    /// @return an iterator after the last value.
+    const_iterator end() const    { return myEnd; }
+    /// @return an iterator on the first value.
+    const_iterator cbegin() const { return myBegin; }
+    /// @return an iterator after the last value.
+    const_iterator cend() const   { return myEnd; }
+    /// @return a reverse iterator on the last value.
+    const_reverse_iterator rbegin() const { return const_reverse_iterator( myEnd ); }
+    /// @return a reverse iterator before the first value.
+    const_reverse_iterator rend() const   { return const_reverse_iterator( myBegin ); }
+
+    /// @return the number of values.
+    size_type size() const { return myEnd - myBegin; }
+    /// @return 'true' iff the span has no values.
+    bool empty() const     { return myEnd == myBegin; }
+    /// @return a pointer to the values.
+    const T* data() const  { return myBegin; }
+
+    /// @param i any index lower than size().
+    /// @return the i-th value.
+    const T& operator[]( size_type i ) const
+    {
+      ASSERT( i < size() );
+      return myBegin[ i ];
+    }
+    /// @return the first value.
+    const T& front() const { ASSERT( ! empty() ); return *myBegin; }
+    /// @return the last value.
+    const T& back() const  { ASSERT( ! empty() ); return *( myEnd - 1 ); }
+
+    /// @return a copy of the values.
+    operator std::vector< T >() const { return std::vector< T >( myBegin, myEnd ); }
+
+    /// @param other any span.
+    /// @return 'true' iff both spans have the same values.
+    bool operator==( const ConstSpan & other ) const
+    { return size() == other.size() && std::equal( myBegin, myEnd, other.myBegin ); }
+    /// @param other any span.
+    /// @return 'true' iff the spans have different values.
+    bool operator!=( const ConstSpan & other ) const
+    { return ! ( *this == other ); }
+
+  private:
+    const T* myBegin; ///< The beginning of the range.
+    const T* myEnd;   ///< The end of the range.
+  }; // end of class ConstSpan
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CompressedRanges
+  /**
+   * Description of template class 'CompressedRanges' <p>
+   * \brief Aim: A sequence of ranges of values stored in compressed
+   * form (CSR, compressed sparse rows): all the values are stored
+   * contiguously, range after range, and the offsets of the ranges
+   * in this array are stored in another one. This replaces a
+   * std::vector of std::vector, with two allocations instead of one
+   * per range and a better locality when visiting neighbor ranges.
+   *
+   * Ranges are given as ConstSpan. They can be appended one by one
+   * with push_back(), or built all at once from pairs (range, value)
+   * by a counting sort with assign(), possibly in parallel.
+   *
+   * @code
+   * // For each vertex, its incident faces.
+   * CompressedRanges< std::size_t > faces;
+   * faces.push_back( { 0, 1, 2 } );
+   * faces.push_back( { 2, 1, 3 } );
+   * auto incident = faces.transpose( 4 ); // { {0}, {0,1}, {0,1}, {1} }
+   * @endcode
+   *
+   * @tparam T the type of the values.
+   *
+   * @see testCompressedRanges.cpp
+   */
+  template < typename T >
+  class CompressedRanges
+  {
+  public:
+    typedef CompressedRanges< T > Self;
+    typedef T                     Value;
+    typedef std::size_t           Size;
+    typedef ConstSpan< T >        Range;
+    typedef Range                 value_type;
+    typedef Size                  size_type;
+
+    /// How the values of each range are ordered by assign().
+    enum Ordering
+    {
+      UNSORTED,     ///< in the order of the items with one thread, unspecified otherwise
+      SORTED,       ///< sorted in increasing order
+      SORTED_UNIQUE ///< sorted in increasing order, without duplicates
+    };
+
+    /**
+     * The object given to the generators of assign(): calling it
+     * with a range index and a value adds the value to the range.
+     */
+    class Inserter
+    {
+      friend class CompressedRanges;
+    public:
+      /// Adds a value to a range.
+      /// @param r the index of the range.
+      /// @param v the value.
+      void operator()( Size r, const T & v );
+    private:
+      /// What the inserter does.
+      enum Mode { COUNT, COUNT_ATOMIC, FILL, FILL_ATOMIC };
+      Inserter( Mode mode, Size* counts, std::atomic< Size >* atomicCounts, T* values )
+        : myMode( mode ), myCounts( counts ), myAtomicCounts( atomicCounts ), myValues( values ) {}
+      Mode                 myMode;         ///< counting or filling, with atomics or not.
+      Size*                myCounts;       ///< counts or cursors per range.
+      std::atomic< Size >* myAtomicCounts; ///< atomic counts or cursors per range.
+      T*                   myValues;       ///< the array of values.
+    };
+
+    /// Non mutable random access iterator on the ranges.
+    class ConstIterator
+    {
+    public:
+      typedef std::random_access_iterator_tag iterator_category;
+      typedef Range                           value_type;
+      typedef std::ptrdiff_t                  difference_type;
+      typedef const Range*                    pointer;
+      typedef Range                           reference;
+
+      ConstIterator() : myRanges( 0 ), myIndex( 0 ) {}
+      ConstIterator( const CompressedRanges* ranges, Size i ) : myRanges( ranges ), myIndex( i ) {}
+
+      Range operator*() const { return (*myRanges)[ myIndex ]; }
+      Range operator[]( difference_type n ) const { return (*myRanges)[ myIndex + n ]; }
+      ConstIterator& operator++() { ++myIndex; return *this; }
+      ConstIterator  operator++( int ) { ConstIterator tmp( *this ); ++myIndex; return tmp; }
+      ConstIterator& operator--() { --myIndex; return *this; }
+      ConstIterator  operator--( int ) { ConstIterator tmp( *this ); --myIndex; return tmp; }
+      ConstIterator& operator+=( difference_type n ) { myIndex += n; return *this; }
+      ConstIterator& operator-=( difference_type n ) { myIndex -= n; return *this; }
+      ConstIterator  operator+( difference_type n ) const { return ConstIterator( myRanges, myIndex + n ); }
+      ConstIterator  operator-( difference_type n ) const { return ConstIterator( myRanges, myIndex - n ); }
+      difference_type operator-( const ConstIterator& other ) const
+      { return difference_type( myIndex ) - difference_type( other.myIndex ); }
+      bool operator==( const ConstIterator& other ) const { return myIndex == other.myIndex; }
+      bool operator!=( const ConstIterator& other ) const { return myIndex != other.myIndex; }
+      bool operator<( const ConstIterator& other ) const  { return myIndex < other.myIndex; }
+      bool operator>( const ConstIterator& other ) const  { return myIndex > other.myIndex; }
+      bool operator<=( const ConstIterator& other ) const { return myIndex <= other.myIndex; }
+      bool operator>=( const ConstIterator& other ) const { return myIndex >= other.myIndex; }
+    private:
+      const CompressedRanges* myRanges; ///< the ranges.
+      Size                    myIndex;  ///< the index of the current range.
+    };
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Constructor. There is no range.
+    CompressedRanges();
+
+    /**
+     * Constructor from a range of ranges (e.g. a std::vector of std::vector).
+     * @param first an iterator on the first range.
+     * @param last an iterator after the last range.
+     */
+    template < typename TRangeIterator >
+    CompressedRanges( TRangeIterator first, TRangeIterator last );
+
+    /// Removes all the ranges.
+    void clear();
+
+    /**
+     * Reserves memory.
+     * @param nbRanges the number of ranges.
+     * @param nbValues the total number of values.
+     */
+    void reserve( Size nbRanges, Size nbValues );
+
+    /**
+     * Appends a range.
+     * @param first an iterator on the first value of the range.
+     * @param last an iterator after the last value of the range.
+     */
+    template < typename TIterator >
+    void push_back( TIterator first, TIterator last );
+
+    /**
+     * Appends a range.
+     * @param values the values of the range.
+     */
+    void push_back( std::initializer_list< T > values );
+
+    /**
+     * Builds all the ranges by a counting sort. The generator is
+     * called twice for each item, first to count the values of each
+     * range, then to store them: `gen( i, ins )` must call `ins( r, v )`
+     * for each value v of range r contributed by item i, in the same
+     * way at both calls. Items are processed in parallel by tiles when
+     * there are several threads.
+     *
+     * @tparam TGenerator the type of a functor (Size, Inserter&).
+     * @param nbRanges the number of ranges.
+     * @param nbItems the number of items.
+     * @param gen the generator of the values of the items.
+     * @param ordering how the values of each range are ordered.
+     * @param nbThreads the number of threads, 0 means ParallelFor::nbThreads().
+     */
+    template < typename TGenerator >
+    void assign( Size nbRanges, Size nbItems, TGenerator gen,
+                 Ordering ordering = SORTED, unsigned int nbThreads = 0 );
+
+    /**
+     * @param nbColumns the number of columns, greater than any value.
+     * @param nbThreads the number of threads, 0 means ParallelFor::nbThreads().
+     * @return the transposed ranges: range c contains (in increasing
+     * order) the index of every range that contains the value c, once
+     * per occurrence.
+     */
+    Self transpose( Size nbColumns, unsigned int nbThreads = 0 ) const;
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of ranges.
+    Size size() const { return myOffsets.size() - 1; }
+
+    /// @return 'true' iff there is no range.
+    bool empty() const { return size() == 0; }
+
+    /// @return the total number of values.
+    Size nbValues() const { return myValues.size(); }
+
+    /// @param i any index of range.
+    /// @return the range of index \a i.
+    Range operator[]( Size i ) const
+    {
+      ASSERT( i < size() );
+      return Range( myValues.data() + myOffsets[ i ], myValues.data() + myOffsets[ i + 1 ] );
+    }
+
+    /// @param i any index of range.
+    /// @return the number of values of range \a i.
+    Size rangeSize( Size i ) const
+    { return myOffsets[ i + 1 ] - myOffsets[ i ]; }
+
+    /// @return an iterator on the first range.
+    ConstIterator begin() const { return ConstIterator( this, 0 ); }
+    /// @return an iterator after the last range.
+    ConstIterator end() const { return ConstIterator( this, size() ); }
+    /// @return an iterator on the first range.
+    ConstIterator cbegin() const { return begin(); }
+    /// @return an iterator after the last range.
+    ConstIterator cend() const { return end(); }
+
+    /// @return the offsets of the ranges in values(), size()+1 of them.
+    const std::vector< Size >& offsets() const { return myOffsets; }
+    /// @return the values of all the ranges, range after range.
+    const std::vector< T >& values() const { return myValues; }
+
+    /// @return a copy of the ranges as a vector of vectors.
+    operator std::vector< std::vector< T > >() const;
+
+    /// @param other any ranges.
+    /// @return 'true' iff both objects have the same ranges.
+    bool operator==( const Self & other ) const
+    { return myOffsets == other.myOffsets && myValues == other.myValues; }
+    /// @param other any ranges.
+    /// @return 'true' iff the objects have different ranges.
+    bool operator!=( const Self & other ) const
+    { return ! ( *this == other ); }
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Sorts the values of each range.
+     * @param unique when 'true', removes the duplicates and compacts the values.
+     * @param nbThreads the number of threads.
+     */
+    void sortRanges( bool unique, unsigned int nbThreads );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The offsets of the ranges: range i is [myOffsets[i],myOffsets[i+1]).
+    std::vector< Size > myOffsets;
+    /// The values of all the ranges.
+    std::vector< T > myValues;
+
+  }; // end of class CompressedRanges
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'CompressedRanges'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'CompressedRanges' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename T >
+  std::ostream&
+  operator<< ( std::ostream & out, const CompressedRanges< T > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/CompressedRanges.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CompressedRanges_h
+
+#undef CompressedRanges_RECURSES
+#endif // else defined(CompressedRanges_RECURSES)
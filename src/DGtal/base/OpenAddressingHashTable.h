@@ -0,0 +1,648 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OpenAddressingHashTable.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module OpenAddressingHashTable.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(OpenAddressingHashTable_RECURSES)
+#error Recursive header files inclusion detected in OpenAddressingHashTable.h
+#else // defined(OpenAddressingHashTable_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OpenAddressingHashTable_RECURSES
+
+#if !defined OpenAddressingHashTable_h
+/** Prevents repeated inclusion of headers. */
+#define OpenAddressingHashTable_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /// Extracts the key of an element of a set: the element itself.
+    template <typename TKey>
+    struct OpenAddressingSetKey
+    {
+      const TKey & operator()( const TKey & v ) const { return v; }
+    };
+
+    /// Extracts the key of an element of a map: its first member.
+    template <typename TKey, typename TValue>
+    struct OpenAddressingMapKey
+    {
+      const TKey & operator()( const TValue & v ) const { return v.first; }
+    };
+
+    /// The number of locality bits of a hash functor: 0 by default.
+    template <typename THash, typename TEnable = void>
+    struct OpenAddressingLocalityBits
+    {
+      static const unsigned int value = 0;
+    };
+
+    /// The number of locality bits of a hash functor that defines
+    /// THash::locality_bits.
+    template <typename THash>
+    struct OpenAddressingLocalityBits
+    < THash, decltype( void( THash::locality_bits ) ) >
+    {
+      static const unsigned int value = THash::locality_bits;
+    };
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingHashTable
+  /**
+   * Description of template class 'OpenAddressingHashTable' <p>
+   * \brief Aim: A hash table with open addressing (linear probing),
+   * the common implementation of OpenAddressingHashSet and
+   * OpenAddressingHashMap.
+   *
+   * Elements are stored in one contiguous array of slots, whose size
+   * is a power of two, and a parallel array of control bytes tells if
+   * a slot is empty, full or erased (tombstone). A full slot also keeps
+   * 7 bits of the hash value of its element, so that most of the slots
+   * that are probed are rejected without comparing keys. A lookup thus
+   * costs about one cache miss, whereas node based hash tables
+   * (std::unordered_set) or balanced trees (std::set) follow several
+   * pointers.
+   *
+   * The interface is the one of std::unordered_set and
+   * std::unordered_map, with the following differences:
+   * - inserting an element may move all elements: it invalidates
+   *   iterators, pointers and references when the table grows;
+   * - erasing an element leaves a tombstone, and never moves other
+   *   elements: iterators on other elements stay valid (an element
+   *   may be erased while iterating);
+   * - there is no bucket interface and no allocator.
+   *
+   * The table grows when more than half of its slots are used (full or
+   * erased), hence the memory usage is about two slots per element.
+   * The hash values are spread by fibonacci hashing, but the hash
+   * function should still depend on all the bits of the keys.
+   *
+   * A hash functor may define a static constant \c locality_bits
+   * (at most 16). The lowest \c locality_bits bits of its hash
+   * values are then not spread but kept as an offset from the slot
+   * given by the other bits, so that keys whose hash values only
+   * differ by these bits are stored in nearby slots, and iterated
+   * one after the other. For instance, KhalimskyCellPackedHash stores
+   * close cells close in memory.
+   *
+   * @tparam TKey the type of the keys.
+   * @tparam TValue the type of the elements, TKey for sets, std::pair<const TKey, T> for maps.
+   * @tparam TKeyOfValue a functor TValue -> TKey that returns the key of an element.
+   * @tparam THash a hash functor on TKey.
+   * @tparam TEqual an equality predicate on TKey.
+   *
+   * @see testOpenAddressingHashTable.cpp
+   */
+  template < typename TKey, typename TValue, typename TKeyOfValue,
+             typename THash = std::hash< TKey >,
+             typename TEqual = std::equal_to< TKey > >
+  class OpenAddressingHashTable
+  {
+  public:
+    typedef OpenAddressingHashTable< TKey, TValue, TKeyOfValue, THash, TEqual > Self;
+    typedef TKey key_type;
+    typedef TValue value_type;
+    typedef THash hasher;
+    typedef TEqual key_equal;
+    typedef TKeyOfValue KeyOfValue;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef value_type & reference;
+    typedef const value_type & const_reference;
+    typedef value_type * pointer;
+    typedef const value_type * const_pointer;
+
+    /// Elements of sets cannot be modified through iterators.
+    static const bool isSet = std::is_same< TKey, TValue >::value;
+
+    /**
+     * Forward iterator on the elements of the table.
+     * @tparam isConst when 'true', the elements cannot be modified.
+     */
+    template <bool isConst>
+    class Iterator
+    {
+    public:
+      friend class OpenAddressingHashTable;
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typename OpenAddressingHashTable::value_type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef typename std::conditional< isConst, const value_type *, value_type * >::type pointer;
+      typedef typename std::conditional< isConst, const value_type &, value_type & >::type reference;
+      typedef typename std::conditional< isConst, const OpenAddressingHashTable *, OpenAddressingHashTable * >::type TablePointer;
+
+      /// Default constructor (singular iterator).
+      Iterator() : myTable( 0 ), myIndex( 0 ) {}
+
+      /// Conversion from a mutable iterator.
+      /// @param other any iterator on the same kind of table.
+      template <bool otherConst,
+                typename = typename std::enable_if< isConst || ! otherConst >::type >
+      Iterator( const Iterator< otherConst > & other )
+        : myTable( other.myTable ), myIndex( other.myIndex ) {}
+
+      /// @return the current element.
+      reference operator*() const { return myTable->element( myIndex ); }
+      /// @return a pointer on the current element.
+      pointer operator->() const { return &myTable->element( myIndex ); }
+
+      /// Pre-increment operator.
+      /// @return a reference to itself.
+      Iterator & operator++()
+      {
+        myIndex = myTable->nextFull( myIndex + 1 );
+        return *this;
+      }
+
+      /// Post-increment operator.
+      /// @return the iterator before incrementation.
+      Iterator operator++( int )
+      {
+        Iterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      /// @param other any other iterator.
+      /// @return 'true' iff the iterators points on the same slot.
+      template <bool otherConst>
+      bool operator==( const Iterator< otherConst > & other ) const
+      { return myIndex == other.myIndex; }
+
+      /// @param other any other iterator.
+      /// @return 'true' iff the iterators points on different slots.
+      template <bool otherConst>
+      bool operator!=( const Iterator< otherConst > & other ) const
+      { return myIndex != other.myIndex; }
+
+    private:
+      template <bool> friend class Iterator;
+      /// Constructor. Internal. Used by OpenAddressingHashTable.
+      Iterator( TablePointer table, size_type index )
+        : myTable( table ), myIndex( index ) {}
+
+      TablePointer myTable; ///< The visited table.
+      size_type myIndex;    ///< The index of the current slot.
+    };
+
+    typedef Iterator< true > const_iterator;
+    typedef typename std::conditional< isSet, Iterator< true >, Iterator< false > >::type iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param n the number of elements for which memory is reserved.
+     * @param hash the hash functor.
+     * @param equal the equality predicate.
+     */
+    explicit OpenAddressingHashTable( size_type n = 0,
+                                      const hasher & hash = hasher(),
+                                      const key_equal & equal = key_equal() );
+
+    /**
+     * Constructor from a range of elements.
+     * @tparam InputIterator any model of input iterator on value_type.
+     * @param first the first element.
+     * @param last after the last element.
+     */
+    template <typename InputIterator>
+    OpenAddressingHashTable( InputIterator first, InputIterator last );
+
+    /**
+     * Constructor from a list of elements.
+     * @param l the list of elements.
+     */
+    OpenAddressingHashTable( std::initializer_list< value_type > l );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    OpenAddressingHashTable( const OpenAddressingHashTable & other );
+
+    /**
+     * Move constructor.
+     * @param other the object to move, left empty.
+     */
+    OpenAddressingHashTable( OpenAddressingHashTable && other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    OpenAddressingHashTable & operator=( OpenAddressingHashTable other );
+
+    /// Destructor.
+    ~OpenAddressingHashTable();
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return an iterator on the first element.
+    iterator begin();
+    /// @return an iterator after the last element.
+    iterator end();
+    /// @return an iterator on the first element.
+    const_iterator begin() const;
+    /// @return an iterator after the last element.
+    const_iterator end() const;
+    /// @return an iterator on the first element.
+    const_iterator cbegin() const;
+    /// @return an iterator after the last element.
+    const_iterator cend() const;
+
+    /// @return 'true' iff there is no element.
+    bool empty() const;
+    /// @return the number of elements.
+    size_type size() const;
+    /// @return the maximal number of elements.
+    size_type max_size() const;
+    /// @return the number of slots.
+    size_type bucket_count() const;
+    /// @return the ratio of the number of elements to the number of slots.
+    double load_factor() const;
+    /// @return the hash functor.
+    hasher hash_function() const;
+    /// @return the equality predicate.
+    key_equal key_eq() const;
+
+    /// Removes all elements. The memory is kept.
+    void clear();
+
+    /**
+     * Reserves memory so that @a n elements can be stored without
+     * growing the table.
+     * @param n a number of elements.
+     */
+    void reserve( size_type n );
+
+    /**
+     * Swaps the content of two tables.
+     * @param other any other table.
+     */
+    void swap( OpenAddressingHashTable & other );
+
+    // ----------------------- Insertion, removal -----------------------------
+  public:
+
+    /**
+     * Inserts an element, if its key is not already present.
+     * @param v the element.
+     * @return an iterator on the element with the key of @a v, and
+     * 'true' iff @a v was inserted.
+     */
+    std::pair< iterator, bool > insert( const value_type & v );
+
+    /**
+     * Inserts an element, if its key is not already present.
+     * @param v the element, moved if inserted.
+     * @return an iterator on the element with the key of @a v, and
+     * 'true' iff @a v was inserted.
+     */
+    std::pair< iterator, bool > insert( value_type && v );
+
+    /**
+     * Inserts an element, if its key is not already present.
+     * @param hint ignored (for compatibility with std::inserter).
+     * @param v the element.
+     * @return an iterator on the element with the key of @a v.
+     */
+    iterator insert( const_iterator hint, const value_type & v );
+
+    /**
+     * Inserts a range of elements.
+     * @tparam InputIterator any model of input iterator on value_type.
+     * @param first the first element.
+     * @param last after the last element.
+     */
+    template <typename InputIterator>
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * Inserts an element built from the given arguments, if its key
+     * is not already present.
+     * @param args the arguments of a constructor of value_type.
+     * @return an iterator on the element with the same key, and
+     * 'true' iff the element was inserted.
+     */
+    template <typename... Args>
+    std::pair< iterator, bool > emplace( Args &&... args );
+
+    /**
+     * Removes an element.
+     * @param pos an iterator on the element.
+     * @return an iterator on the element following @a pos.
+     */
+    iterator erase( const_iterator pos );
+
+    /**
+     * Removes a range of elements.
+     * @param first the first element.
+     * @param last after the last element.
+     * @return @a last.
+     */
+    iterator erase( const_iterator first, const_iterator last );
+
+    /**
+     * Removes the element with the given key, if any.
+     * @param key any key.
+     * @return the number of removed elements (0 or 1).
+     */
+    size_type erase( const key_type & key );
+
+    // ----------------------- Lookup -----------------------------------------
+  public:
+
+    /**
+     * @param key any key.
+     * @return an iterator on the element with key @a key, or end().
+     */
+    iterator find( const key_type & key );
+
+    /**
+     * @param key any key.
+     * @return an iterator on the element with key @a key, or end().
+     */
+    const_iterator find( const key_type & key ) const;
+
+    /**
+     * @param key any key.
+     * @return the number of elements with key @a key (0 or 1).
+     */
+    size_type count( const key_type & key ) const;
+
+    /**
+     * @param key any key.
+     * @return the range of the elements with key @a key.
+     */
+    std::pair< iterator, iterator > equal_range( const key_type & key );
+
+    /**
+     * @param key any key.
+     * @return the range of the elements with key @a key.
+     */
+    std::pair< const_iterator, const_iterator > equal_range( const key_type & key ) const;
+
+    /**
+     * @param other any other table.
+     * @return 'true' iff both tables contain the same elements.
+     */
+    bool operator==( const OpenAddressingHashTable & other ) const;
+
+    /**
+     * @param other any other table.
+     * @return 'true' iff the tables contain different elements.
+     */
+    bool operator!=( const OpenAddressingHashTable & other ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// Control byte of an empty slot.
+    static const std::uint8_t EMPTY = 0x80;
+    /// Control byte of an erased slot.
+    static const std::uint8_t ERASED = 0xfe;
+    /// Uninitialized memory for one element.
+    typedef typename std::aligned_storage< sizeof( value_type ),
+                                           alignof( value_type ) >::type Slot;
+
+    std::vector< Slot > mySlots;            ///< The slots (capacity a power of two).
+    std::vector< std::uint8_t > myControls; ///< The control bytes of the slots.
+    size_type mySize;                       ///< The number of elements.
+    size_type myNbErased;                   ///< The number of erased slots.
+    unsigned int myShift;                   ///< 64 - log2 of the capacity.
+    hasher myHash;                          ///< The hash functor.
+    key_equal myEqual;                      ///< The equality predicate.
+
+    // ------------------------- Internals ------------------------------------
+  protected:
+
+    /// @return the element of slot @a i.
+    value_type & element( size_type i );
+    /// @return the element of slot @a i.
+    const value_type & element( size_type i ) const;
+
+    /// @return the first full slot from slot @a i, or the capacity.
+    size_type nextFull( size_type i ) const;
+
+    /**
+     * @param key any key.
+     * @param[out] control the control byte of a slot holding @a key.
+     * @return the first slot of the probe sequence of @a key.
+     */
+    size_type home( const key_type & key, std::uint8_t & control ) const;
+
+    /// @return the slot of the element with key @a key, or the capacity.
+    size_type lookup( const key_type & key ) const;
+
+    /**
+     * Finds where the element with key @a key is, or should be inserted.
+     * @param key any key.
+     * @param[out] control the control byte of a slot holding @a key.
+     * @return the slot and 'true' if @a key is present, or the slot where it
+     * should be inserted and 'false'.
+     */
+    std::pair< size_type, bool > probe( const key_type & key, std::uint8_t & control ) const;
+
+    /**
+     * Inserts an element, if its key is not already present. Grows
+     * the table if needed. Used by all insertion methods.
+     * @tparam TArg value_type, possibly cv-qualified (the key of @a v
+     * is read in place, hence @a v must not be converted).
+     * @param v the element (forwarded).
+     * @return an iterator on the element with the key of @a v, and
+     * 'true' iff @a v was inserted.
+     */
+    template <typename TArg>
+    std::pair< iterator, bool > insertValue( TArg && v );
+
+    /// Destroys the element of slot @a i and marks the slot as erased.
+    void eraseSlot( size_type i );
+
+    /// Moves all elements to a new array of @a capacity slots.
+    void rehash( size_type capacity );
+
+  }; // end of class OpenAddressingHashTable
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingHashSet
+  /**
+   * Description of template class 'OpenAddressingHashSet' <p>
+   * \brief Aim: A set of keys stored in a hash table with open
+   * addressing, a replacement of std::unordered_set when lookups
+   * dominate (see OpenAddressingHashTable for the differences).
+   *
+   * Model of concepts::CSTLAssociativeContainer, as a unique and
+   * simple unordered associative container.
+   *
+   * @tparam TKey the type of the keys.
+   * @tparam THash a hash functor on TKey.
+   * @tparam TEqual an equality predicate on TKey.
+   */
+  template < typename TKey,
+             typename THash = std::hash< TKey >,
+             typename TEqual = std::equal_to< TKey > >
+  class OpenAddressingHashSet
+    : public OpenAddressingHashTable< TKey, TKey, detail::OpenAddressingSetKey< TKey >, THash, TEqual >
+  {
+  public:
+    typedef OpenAddressingHashTable< TKey, TKey, detail::OpenAddressingSetKey< TKey >, THash, TEqual > Base;
+    using Base::Base;
+    OpenAddressingHashSet() = default;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingHashMap
+  /**
+   * Description of template class 'OpenAddressingHashMap' <p>
+   * \brief Aim: A map key -> data stored in a hash table with open
+   * addressing, a replacement of std::unordered_map when lookups
+   * dominate (see OpenAddressingHashTable for the differences).
+   *
+   * Model of concepts::CSTLAssociativeContainer, as a unique and
+   * pair unordered associative container.
+   *
+   * @tparam TKey the type of the keys.
+   * @tparam TData the type of the associated data.
+   * @tparam THash a hash functor on TKey.
+   * @tparam TEqual an equality predicate on TKey.
+   */
+  template < typename TKey, typename TData,
+             typename THash = std::hash< TKey >,
+             typename TEqual = std::equal_to< TKey > >
+  class OpenAddressingHashMap
+    : public OpenAddressingHashTable< TKey, std::pair< const TKey, TData >,
+                                      detail::OpenAddressingMapKey< TKey, std::pair< const TKey, TData > >,
+                                      THash, TEqual >
+  {
+  public:
+    typedef OpenAddressingHashTable< TKey, std::pair< const TKey, TData >,
+                                     detail::OpenAddressingMapKey< TKey, std::pair< const TKey, TData > >,
+                                     THash, TEqual > Base;
+    typedef TData mapped_type;
+    typedef TData data_type;
+    using typename Base::key_type;
+    using typename Base::value_type;
+    using Base::Base;
+    OpenAddressingHashMap() = default;
+
+    /**
+     * @param key any key.
+     * @return a reference on the data associated to @a key,
+     * default-constructed and inserted if @a key was not present.
+     */
+    mapped_type & operator[]( const key_type & key );
+
+    /**
+     * @param key any key, which must be present.
+     * @return a reference on the data associated to @a key.
+     * @throw std::out_of_range if @a key is not present.
+     */
+    mapped_type & at( const key_type & key );
+
+    /**
+     * @param key any key, which must be present.
+     * @return a const reference on the data associated to @a key.
+     * @throw std::out_of_range if @a key is not present.
+     */
+    const mapped_type & at( const key_type & key ) const;
+  };
+
+  /// Defines container traits for OpenAddressingHashSet<>.
+  template < typename TKey, typename THash, typename TEqual >
+  struct ContainerTraits< OpenAddressingHashSet< TKey, THash, TEqual > >
+  {
+    typedef UnorderedSetAssociativeCategory Category;
+  };
+
+  /// Defines container traits for OpenAddressingHashMap<>.
+  template < typename TKey, typename TData, typename THash, typename TEqual >
+  struct ContainerTraits< OpenAddressingHashMap< TKey, TData, THash, TEqual > >
+  {
+    typedef UnorderedMapAssociativeCategory Category;
+  };
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OpenAddressingHashTable'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OpenAddressingHashTable' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TKey, typename TValue, typename TKeyOfValue, typename THash, typename TEqual >
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const OpenAddressingHashTable< TKey, TValue, TKeyOfValue, THash, TEqual > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/OpenAddressingHashTable.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OpenAddressingHashTable_h
+
+#undef OpenAddressingHashTable_RECURSES
+#endif // else defined(OpenAddressingHashTable_RECURSES)
@@ -0,0 +1,132 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ParallelFor.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ParallelFor.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ParallelFor_RECURSES)
+#error Recursive header files inclusion detected in ParallelFor.h
+#else // defined(ParallelFor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ParallelFor_RECURSES
+
+#if !defined ParallelFor_h
+/** Prevents repeated inclusion of headers. */
+#define ParallelFor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // struct ParallelFor
+  /**
+   * Description of struct 'ParallelFor' <p>
+   * \brief Aim: runs the iterations of a loop over indices on
+   * several threads, the index range being cut into contiguous tiles.
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
+   * to "true"), tiles are distributed with an OpenMP dynamic
+   * schedule. Otherwise, a pool of std::thread workers picks the
+   * tiles in increasing order.
+   *
+   * The loop body receives the index of the thread running it (in
+   * [0, number of threads)), so that per-thread buffers can be
+   * allocated once and reused across tiles.
+   *
+   * @code
+   * const unsigned int nbThreads = ParallelFor::nbThreads();
+   * std::vector< std::vector<Point> > buffers( nbThreads );
+   * ParallelFor::tiles( nbLines, 64,
+   *   [&] ( unsigned int thread, std::size_t first, std::size_t last )
+   *   {
+   *     for ( std::size_t i = first; i < last; ++i )
+   *       processLine( i, buffers[ thread ] );
+   *   } );
+   * @endcode
+   *
+   * The number of threads defaults to the number of hardware threads
+   * (or to the OpenMP default) and can be changed globally with
+   * setNbThreads().
+   */
+  struct ParallelFor
+  {
+    /**
+     * @return the number of threads used by tiles().
+     */
+    static unsigned int nbThreads();
+
+    /**
+     * Sets the number of threads used by tiles().
+     *
+     * @param n the number of threads, 0 restores the default value.
+     */
+    static void setNbThreads( unsigned int n );
+
+    /**
+     * Runs @a aBody on the tiles [k*tileSize, min((k+1)*tileSize, n))
+     * of the index range [0,n). Calls to @a aBody with the same
+     * thread index never overlap.
+     *
+     * If @a aBody throws an exception, the remaining tiles are
+     * skipped and the first exception is rethrown.
+     *
+     * @tparam TBody a callable object with signature
+     * <code>void( unsigned int thread, std::size_t first, std::size_t last )</code>.
+     * @param n the number of indices.
+     * @param tileSize the number of consecutive indices in a tile (>0).
+     * @param aBody the loop body.
+     * @param aNbThreads the number of threads to use, 0 for nbThreads().
+     */
+    template <typename TBody>
+    static void tiles( std::size_t n, std::size_t tileSize, TBody && aBody,
+                       unsigned int aNbThreads = 0 );
+
+  private:
+    /// @return a reference on the user defined number of threads (0 if unset).
+    static unsigned int & userNbThreads();
+
+  }; // end of struct ParallelFor
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/ParallelFor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ParallelFor_h
+
+#undef ParallelFor_RECURSES
+#endif // else defined(ParallelFor_RECURSES)
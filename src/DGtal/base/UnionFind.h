@@ -0,0 +1,192 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file UnionFind.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module UnionFind.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(UnionFind_RECURSES)
+#error Recursive header files inclusion detected in UnionFind.h
+#else // defined(UnionFind_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define UnionFind_RECURSES
+
+#if !defined UnionFind_h
+/** Prevents repeated inclusion of headers. */
+#define UnionFind_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class UnionFind
+  /**
+   * Description of template class 'UnionFind' <p>
+   * \brief Aim: A disjoint-set forest over the integers 0, 1, ...,
+   * size()-1, with union by rank and path halving, so that any
+   * sequence of operations runs in almost linear time.
+   *
+   * It is typically used to label connected components: elements are
+   * numbered, adjacent elements are merged with unite(), then labels()
+   * numbers the components in the order of their smallest element,
+   * which makes the labelling independent of the order of the merges.
+   *
+   * @code
+   * UnionFind<> uf( 5 );
+   * uf.unite( 0, 3 );
+   * uf.unite( 4, 3 );
+   * std::vector< std::size_t > labels;
+   * uf.labels( labels ); // { 0, 1, 2, 0, 0 }, uf.nbSets() == 3
+   * @endcode
+   *
+   * @tparam TIndex an unsigned integral type for the elements (e.g.
+   * std::uint32_t for saving memory on large sets).
+   *
+   * @see testUnionFind.cpp
+   */
+  template < typename TIndex = std::size_t >
+  class UnionFind
+  {
+  public:
+    typedef TIndex Index;
+    typedef std::size_t Size;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param n the initial number of elements, each one in its own set.
+     */
+    explicit UnionFind( Size n = 0 );
+
+    /**
+     * Adds a new element in its own set.
+     * @return the new element, i.e. the former size().
+     */
+    Index makeSet();
+
+    /**
+     * Reserves memory for @a n elements.
+     * @param n any number of elements.
+     */
+    void reserve( Size n );
+
+    /// @return the number of elements.
+    Size size() const;
+
+    /// @return the number of disjoint sets.
+    Size nbSets() const;
+
+    /**
+     * @param x any element.
+     * @return the representative of the set of @a x.
+     */
+    Index find( Index x );
+
+    /**
+     * Merges the sets of @a x and @a y.
+     * @param x any element.
+     * @param y any element.
+     * @return 'true' iff @a x and @a y were in different sets.
+     */
+    bool unite( Index x, Index y );
+
+    /**
+     * @param x any element.
+     * @param y any element.
+     * @return 'true' iff @a x and @a y are in the same set.
+     */
+    bool same( Index x, Index y );
+
+    /**
+     * Numbers the sets from 0 to nbSets()-1 in the order of their
+     * smallest element.
+     *
+     * @param[out] labels a vector of size size() giving the label of
+     * each element.
+     * @return the number of sets.
+     */
+    Size labels( std::vector< Index > & labels );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The parent of each element (itself for a representative).
+    std::vector< Index > myParents;
+    /// The rank of each element (only meaningful for representatives).
+    std::vector< unsigned char > myRanks;
+    /// The number of disjoint sets.
+    Size myNbSets;
+
+  }; // end of class UnionFind
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'UnionFind'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'UnionFind' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TIndex >
+  std::ostream&
+  operator<< ( std::ostream & out, const UnionFind< TIndex > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/UnionFind.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined UnionFind_h
+
+#undef UnionFind_RECURSES
+#endif // else defined(UnionFind_RECURSES)
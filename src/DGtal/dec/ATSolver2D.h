@@ -43,7 +43,10 @@
 #include <iostream>
 #include <sstream>
 #include <tuple>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/math/linalg/EigenSupport.h"
 #include "DGtal/dec/DiscreteExteriorCalculus.h"
@@ -86,7 +89,8 @@ namespace DGtal
   * @see exampleSurfaceATNormals.cpp
   */
   template < typename TKSpace,
-             typename TLinearAlgebra = EigenLinearAlgebraBackend >
+             typename TLinearAlgebra = EigenLinearAlgebraBackend,
+             typename TLinearAlgebraSolver = EigenLinearAlgebraBackend::SolverSimplicialLDLT >
   class ATSolver2D
   {
     // ----------------------- Standard services ------------------------------
@@ -94,7 +98,7 @@ namespace DGtal
 
     typedef TKSpace                                              KSpace;
     typedef TLinearAlgebra                                       LinearAlgebra;
-    typedef ATSolver2D< KSpace, LinearAlgebra >                  Self;
+    typedef ATSolver2D< KSpace, LinearAlgebra, TLinearAlgebraSolver > Self;
 
     static const Dimension dimension = KSpace::dimension;
 
@@ -114,6 +118,7 @@ namespace DGtal
     typedef DiscreteExteriorCalculus<2,dimension, LinearAlgebra> Calculus;
     typedef typename KSpace::template SurfelMap<double>::Type    SmallestEpsilonMap;
     typedef typename Calculus::Index                             Index;
+    typedef typename Calculus::DenseMatrix                       DenseMatrix;
     typedef typename Calculus::PrimalForm0                       PrimalForm0;
     typedef typename Calculus::PrimalForm1                       PrimalForm1;
     typedef typename Calculus::PrimalForm2                       PrimalForm2;
@@ -131,15 +136,54 @@ namespace DGtal
 
     // SparseLU is so much faster than SparseQR
     // SimplicialLLT is much faster than SparseLU
-    // SimplicialLDLT is as fast as SimplicialLLT but more robust
-    // typedef EigenLinearAlgebraBackend::SolverSparseQR LinearAlgebraSolver;
-    // typedef EigenLinearAlgebraBackend::SolverSparseLU LinearAlgebraSolver;
-    // typedef EigenLinearAlgebraBackend::SolverSimplicialLLT LinearAlgebraSolver;
-    typedef EigenLinearAlgebraBackend::SolverSimplicialLDLT LinearAlgebraSolver;
+    // SimplicialLDLT is as fast as SimplicialLLT but more robust (default)
+    // Iterative solvers (e.g. SolverConjugateGradient) are warm-started
+    // from the former u and v.
+    typedef TLinearAlgebraSolver                                 LinearAlgebraSolver;
     typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 2, PRIMAL, 2, PRIMAL> SolverU2;
     typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL> SolverV0;
 
+    /// Cumulated computation times (in ms) of the phases of the
+    /// alternate minimization, since the construction of the solver
+    /// or the last call to resetTimings.
+    struct Timings
+    {
+      double assembly_u2      = 0.0; ///< building the operator of u
+      double analysis_u2      = 0.0; ///< symbolic analysis of its sparsity pattern
+      double factorization_u2 = 0.0; ///< its numerical factorization
+      double solve_u2         = 0.0; ///< solving for u (and normalizing it)
+      double assembly_v0      = 0.0; ///< building the operator of v
+      double analysis_v0      = 0.0; ///< symbolic analysis of its sparsity pattern
+      double factorization_v0 = 0.0; ///< its numerical factorization
+      double solve_v0         = 0.0; ///< solving for v
+      unsigned int nb_steps    = 0;  ///< the number of alternate steps
+      unsigned int nb_analyses = 0;  ///< the number of symbolic analyses
+    };
+
   protected:
+    /// A linear solver kept across the alternate steps, with the
+    /// sparsity pattern (compressed outer and inner indices) of the
+    /// operator of its last symbolic analysis. Linear solvers are not
+    /// copyable: a copy gets its own fresh solver, which analyzes again
+    /// the pattern of the first operator it factorizes.
+    template <typename Solver>
+    struct PersistentSolver
+    {
+      Solver             solver;
+      std::vector<Index> outer;
+      std::vector<Index> inner;
+
+      PersistentSolver() = default;
+      PersistentSolver( const PersistentSolver& )
+        : solver(), outer(), inner() {}
+      PersistentSolver& operator=( const PersistentSolver& )
+      {
+        outer.clear();
+        inner.clear();
+        return *this;
+      }
+    };
+
     /// A smart (or not) pointer to a calculus object.
     CountedConstPtrOrConstPtr< Calculus > ptrCalculus;
     /// the derivative operator for primal 0-forms
@@ -169,6 +213,16 @@ namespace DGtal
     PrimalForm0           former_v0;
     /// The primal 0-form lambda/(4epsilon) (stored for performance)
     PrimalForm0           l_1_over_4e;
+    /// The operator of the linear system in u (kept for iterative solvers)
+    PrimalIdentity2       ope_u2;
+    /// The operator of the linear system in v (kept for iterative solvers)
+    PrimalIdentity0       ope_v0;
+    /// The solver for u, whose symbolic analysis is reused across steps
+    PersistentSolver<SolverU2> solver_u2;
+    /// The solver for v, whose symbolic analysis is reused across steps
+    PersistentSolver<SolverV0> solver_v0;
+    /// The computation times of the phases of the alternate minimization
+    Timings               phase_timings;
 
   public:
     // The map Surfel -> Index that gives the index of the surfel in 2-forms.
@@ -205,7 +259,9 @@ namespace DGtal
         M01( *ptrCalculus ), M12( *ptrCalculus ), primal_AD2( *ptrCalculus ),
         alpha_Id2( *ptrCalculus ), l_1_over_4e_Id0( *ptrCalculus ),
         g2(), alpha_g2(), u2(), v0( *ptrCalculus ), former_v0( *ptrCalculus ),
-        l_1_over_4e( *ptrCalculus ), verbose( aVerbose )
+        l_1_over_4e( *ptrCalculus ), ope_u2( *ptrCalculus ), ope_v0( *ptrCalculus ),
+        solver_u2(), solver_v0(),
+        verbose( aVerbose )
     {
       if ( verbose >= 2 )
 	trace.info() << "[ATSolver::ATSolver] " << *ptrCalculus << std::endl;
@@ -228,7 +284,8 @@ namespace DGtal
     ~ATSolver2D() = default;
 
     /**
-     * Copy constructor.
+     * Copy constructor. The copy has its own linear solvers, which
+     * are analyzed and factorized again at its first alternate step.
      * @param other the object to clone.
      */
     ATSolver2D ( const ATSolver2D & other ) = default;
@@ -546,47 +603,71 @@ namespace DGtal
     bool solveOneAlternateStep()
     {
       bool solve_ok = true;
+      Clock c;
       if ( verbose >= 1 ) trace.beginBlock("Solving for u as a 2-form");
+      c.startClock();
       PrimalForm1 v1_squared = M01*v0;
       v1_squared.myContainer.array() = v1_squared.myContainer.array().square();
-      const PrimalIdentity2 ope_u2 = alpha_Id2
+      ope_u2 = alpha_Id2
         + primal_AD2.transpose() * dec_helper::diagonal( v1_squared ) * primal_AD2;
+      phase_timings.assembly_u2 += c.stopClock();
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
-      SolverU2 solver_u2;
-      solver_u2.compute( ope_u2 );
-      for ( Dimension d = 0; d < u2.size(); ++d )
-        {
-          if ( verbose >= 2 ) trace.info() << "Solving U u[" << d << "] = a g[" << d << "]" << std::endl;
-          u2[ d ] = solver_u2.solve( alpha_g2[ d ] );
-          if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2.isValid() ? "OK" : "ERROR" )
-                                           << " " << solver_u2.myLinearAlgebraSolver.info() << std::endl;
-          solve_ok = solve_ok && solver_u2.isValid();
-        }
+      factorize( solver_u2, ope_u2, phase_timings.analysis_u2, phase_timings.factorization_u2 );
+      c.startClock();
+      // All the components of u are solved at once with the same factorization.
+      if ( verbose >= 2 ) trace.info() << "Solving U u[d] = a g[d] for the " << u2.size() << " components" << std::endl;
+      u2 = solver_u2.solver.solve( alpha_g2, u2 );
+      if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2.solver.isValid() ? "OK" : "ERROR" )
+                                       << " " << solver_u2.solver.myLinearAlgebraSolver.info() << std::endl;
+      solve_ok = solve_ok && solver_u2.solver.isValid();
       if ( normalize_u2 ) normalizeU2();
+      phase_timings.solve_u2 += c.stopClock();
       if ( verbose >= 1 ) trace.endBlock();
       if ( verbose >= 1 ) trace.beginBlock("Solving for v");
+      c.startClock();
       former_v0 = v0;
       PrimalForm1 squared_norm_d_u2 = PrimalForm1::zeros(*ptrCalculus);
-      for ( Dimension d = 0; d < u2.size(); ++d )
-        squared_norm_d_u2.myContainer.array() += (primal_AD2 * u2[ d ] ).myContainer.array().square();
-      trace.info() << "build metric u2" << std::endl;
-      const PrimalIdentity0 ope_v0 = l_1_over_4e_Id0
+      if ( ! u2.empty() )
+        {
+          DenseMatrix U( u2[ 0 ].length(), u2.size() );
+          for ( Dimension d = 0; d < u2.size(); ++d )
+            U.col( d ) = u2[ d ].myContainer;
+          squared_norm_d_u2.myContainer = ( primal_AD2.myContainer * U ).rowwise().squaredNorm();
+        }
+      if ( verbose >= 2 ) trace.info() << "build metric u2" << std::endl;
+      ope_v0 = l_1_over_4e_Id0
         + (lambda * epsilon) * primal_D0.transpose() * primal_D0
 	+ M01.transpose() * dec_helper::diagonal( squared_norm_d_u2 ) * M01;
+      phase_timings.assembly_v0 += c.stopClock();
 
       if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
-      SolverV0 solver_v0;
-      solver_v0.compute( ope_v0 );
+      factorize( solver_v0, ope_v0, phase_timings.analysis_v0, phase_timings.factorization_v0 );
       if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
-      v0 = solver_v0.solve( l_1_over_4e );
-      if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0.isValid() ? "OK" : "ERROR" )
-                                       << " " << solver_v0.myLinearAlgebraSolver.info() << std::endl;
-      solve_ok = solve_ok && solver_v0.isValid();
+      c.startClock();
+      v0 = solver_v0.solver.solve( l_1_over_4e, v0 );
+      phase_timings.solve_v0 += c.stopClock();
+      if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0.solver.isValid() ? "OK" : "ERROR" )
+                                       << " " << solver_v0.solver.myLinearAlgebraSolver.info() << std::endl;
+      solve_ok = solve_ok && solver_v0.solver.isValid();
+      phase_timings.nb_steps += 1;
       if ( verbose >= 1 ) trace.endBlock();
       return solve_ok;
     }
 
+    /// @return the cumulated computation times of the phases of the
+    /// alternate minimization.
+    const Timings& timings() const
+    {
+      return phase_timings;
+    }
+
+    /// Resets the computation times of the phases of the alternate minimization.
+    void resetTimings()
+    {
+      phase_timings = Timings();
+    }
+
     /// Solves the alternate minimization of AT for a given \a eps. Solves
     /// for u then for v till convergence.
     ///
@@ -952,6 +1033,15 @@ namespace DGtal
           << std::get<0>(cv) << "/"
           << std::get<1>(cv) << "/"
           << std::get<2>(cv) << std::endl;
+      out << "[ATSolver2D] " << phase_timings.nb_steps << " steps, "
+          << phase_timings.nb_analyses << " pattern analyses, times (ms)"
+          << " u assembly/analysis/factorization/solve:"
+          << phase_timings.assembly_u2 << "/" << phase_timings.analysis_u2 << "/"
+          << phase_timings.factorization_u2 << "/" << phase_timings.solve_u2
+          << " v assembly/analysis/factorization/solve:"
+          << phase_timings.assembly_v0 << "/" << phase_timings.analysis_v0 << "/"
+          << phase_timings.factorization_v0 << "/" << phase_timings.solve_v0
+          << std::endl;
     }
 
     /**
@@ -990,6 +1080,45 @@ namespace DGtal
       if ( verbose >= 1 ) trace.endBlock();
     }
 
+    /// Prefactorizes an operator with a persistent solver. The
+    /// symbolic analysis is done only if the sparsity pattern of the
+    /// operator differs from the one of the former analysis, which is
+    /// never the case along the alternate minimization.
+    ///
+    /// @param[in,out] s a persistent solver.
+    /// @param[in] ope the operator, which must outlive the solving.
+    /// @param[in,out] analysis_time the time of the symbolic analysis is added to it.
+    /// @param[in,out] factorization_time the time of the numerical factorization is added to it.
+    template <typename Solver, typename Operator>
+    void factorize( PersistentSolver<Solver>& s, const Operator& ope,
+                    double& analysis_time, double& factorization_time )
+    {
+      Clock c;
+      c.startClock();
+      const auto& m = ope.myContainer;
+      const bool same_pattern = m.isCompressed()
+        && s.outer.size() == static_cast<std::size_t>( m.outerSize() + 1 )
+        && s.inner.size() == static_cast<std::size_t>( m.nonZeros() )
+        && std::equal( s.outer.begin(), s.outer.end(), m.outerIndexPtr() )
+        && std::equal( s.inner.begin(), s.inner.end(), m.innerIndexPtr() );
+      if ( ! same_pattern )
+        {
+          if ( verbose >= 2 ) trace.info() << "Analyzing the sparsity pattern" << std::endl;
+          s.solver.analyzePattern( ope );
+          s.outer.clear();
+          s.inner.clear();
+          if ( m.isCompressed() )
+            {
+              s.outer.assign( m.outerIndexPtr(), m.outerIndexPtr() + m.outerSize() + 1 );
+              s.inner.assign( m.innerIndexPtr(), m.innerIndexPtr() + m.nonZeros() );
+            }
+          phase_timings.nb_analyses += 1;
+        }
+      analysis_time += c.restartClock();
+      s.solver.factorize( ope );
+      factorization_time += c.stopClock();
+    }
+
     /// @}
     
     // ------------------------- Internals ------------------------------------
@@ -1004,9 +1133,13 @@ namespace DGtal
    * @param object the object of class 'ATSolver2D' to write.
    * @return the output stream after the writing.
    */
-  template <typename T>
+  template <typename T, typename L, typename S>
   std::ostream&
-  operator<< ( std::ostream & out, const ATSolver2D<T> & object );
+  operator<< ( std::ostream & out, const ATSolver2D<T, L, S> & object )
+  {
+    object.selfDisplay( out );
+    return out;
+  }
 
 } // namespace DGtal
 
@@ -44,12 +44,14 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <algorithm>
 #include <boost/array.hpp>
-#include <boost/unordered_map.hpp>
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
 #include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
 #include "DGtal/dec/Duality.h"
 #include "DGtal/dec/KForm.h"
 #include "DGtal/dec/LinearOperator.h"
@@ -88,6 +90,13 @@ namespace DGtal
    * This is used to describe the space on which the dec is build and to compute various operators.
    * Once operators or kforms are created, this structure should not be modified.
    *
+   * Cells of each order are indexed in increasing order of cells.
+   * Once indexed, their properties are also stored in contiguous
+   * arrays in index order and their incidences are stored in
+   * compressed (CSR) index arrays, from which the sparse matrices of
+   * the derivative, hodge, flat and sharp operators are directly
+   * assembled in compressed form.
+   *
    * @tparam dimEmbedded dimension of emmbedded manifold.
    * @tparam dimAmbient dimension of ambient manifold.
    * @tparam TLinearAlgebraBackend linear algebra backend used (i.e. EigenSparseLinearAlgebraBackend).
@@ -160,7 +169,7 @@ namespace DGtal
     /**
      * Cells properties map typedef.
      */
-    typedef boost::unordered_map<Cell, Property> Properties;
+    typedef OpenAddressingHashMap<Cell, Property> Properties;
 
     /**
      * Indices to cells map typedefs.
@@ -168,6 +177,12 @@ namespace DGtal
     typedef std::vector<SCell> SCells;
     typedef boost::array<SCells, dimEmbedded+1> IndexedSCells;
 
+    /**
+     * Cells properties in index order typedefs.
+     */
+    typedef std::vector<Property> IndexedProperties;
+    typedef boost::array<IndexedProperties, dimEmbedded+1> IndexedPropertiesByOrder;
+
     /**
      * Vector field typedefs.
      */
@@ -329,7 +344,9 @@ namespace DGtal
 
     /**
      * Update indexes for all cells.
-     * Cell insertion order == index may not be preserved.
+     * Cell insertion order == index may not be preserved: cells of
+     * each order are indexed in increasing order of cells. Use
+     * getCellIndex or getSCell to map cells to k-form indices.
      */
     void
     updateIndexes();
@@ -351,6 +368,16 @@ namespace DGtal
     const SCells&
     getIndexedSCells() const;
 
+    /**
+     * Get the properties of all cells with specific @a order and @a duality in index order.
+     * @tparam order order of cells.
+     * @tparam duality duality of cells.
+     * @return index ordered cell properties.
+     */
+    template <Order order, Duality duality>
+    const IndexedProperties&
+    getIndexedProperties() const;
+
     /**
      * Reorder operator from _order_-forms to _order_-forms.
      * Reorder indexes from internal index order to iterator range traversal induced order.
@@ -558,6 +585,35 @@ namespace DGtal
      */
     IndexedSCells myIndexSignedCells;
 
+    /**
+     * Cells properties indexed by their order, in index order.
+     */
+    IndexedPropertiesByOrder myIndexedProperties;
+
+    /**
+     * Compressed sparse rows of a matrix whose rows are cells of one
+     * order: the entries of row i are indexes[offsets[i]..offsets[i+1][,
+     * with their values.
+     */
+    struct CompressedRows
+    {
+        std::vector<Index> offsets;
+        std::vector<Index> indexes;
+        std::vector<Scalar> values;
+    };
+
+    /**
+     * Incidences of k-cells to the (k-1)-cells of the calculus, sorted
+     * by index, with their relative orientation (index k > 0).
+     */
+    boost::array<CompressedRows, dimEmbedded+1> myLowerIncidences;
+
+    /**
+     * Incidences of k-cells to the (k+1)-cells of the calculus, sorted
+     * by index, with their relative orientation (index k < dimEmbedded).
+     */
+    boost::array<CompressedRows, dimEmbedded+1> myUpperIncidences;
+
     /**
      * Cached flat operator matrix.
      */
@@ -578,6 +634,11 @@ namespace DGtal
      */
     bool myIndexesNeedUpdate;
 
+    /**
+     * Index ordered properties generation flag.
+     */
+    bool myIndexedPropertiesNeedUpdate;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -591,6 +652,36 @@ namespace DGtal
     void
     updateCachedOperators();
 
+    /**
+     * Update the index ordered copy of cells properties.
+     */
+    void
+    updateIndexedProperties();
+
+    /**
+     * Update incidences between indexed cells of consecutive orders.
+     */
+    void
+    updateIncidences();
+
+    /**
+     * Sparse matrix from its compressed columns.
+     * @param rows number of rows.
+     * @param columns compressed columns, the row indexes being sorted in each column.
+     * @return sparse matrix.
+     */
+    static SparseMatrix
+    matrixFromCompressedColumns(const Index rows, const CompressedRows& columns);
+
+    /**
+     * Sparse matrix from its compressed rows.
+     * @param cols number of columns.
+     * @param rows compressed rows.
+     * @return sparse matrix.
+     */
+    static SparseMatrix
+    matrixFromCompressedRows(const Index cols, const CompressedRows& rows);
+
     /**
      * Update flat operator cache.
      * @tparam duality duality of updated flat operator.
@@ -39,6 +39,7 @@
 #define DiscreteExteriorCalculusFactory_h
 
 //////////////////////////////////////////////////////////////////////////////
+#include <boost/array.hpp>
 #include "DGtal/dec/DiscreteExteriorCalculus.h"
 #include "DGtal/topology/DigitalSurface.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -131,6 +132,21 @@ private:
     // ------------------------- Hidden services ------------------------------
 protected:
 
+    /**
+     * Compute the lower incident cells of a cell, as KSpace::uLowerIncident,
+     * without allocating a cell collection.
+     * Internal use only.
+     * @tparam KSpace Khalimsky space type.
+     * @param kspace Khalimsky space instance.
+     * @param cell unsigned cell.
+     * @param border array filled with the lower incident cells.
+     * @return number of lower incident cells.
+     */
+    template <typename KSpace>
+    static
+    DGtal::Dimension
+    lowerIncidentCells(const KSpace& kspace, const typename KSpace::Cell& cell, boost::array<typename KSpace::Cell, 2*KSpace::dimension>& border);
+
     /**
      * Insert recursively all lower incident cells into cells set, starting from cell.
      * Internal use only.
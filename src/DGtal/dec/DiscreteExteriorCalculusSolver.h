@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/base/Clone.h"
@@ -51,6 +52,45 @@
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /**
+     * Calls the optional services of linear algebra solvers
+     * (symbolic analysis, numerical factorization, initial guess),
+     * the integer parameter selecting the overload using the service
+     * when the solver has it.
+     */
+    struct LinearAlgebraSolverServices
+    {
+      template <typename Solver, typename Matrix>
+      static auto analyzePattern(Solver& solver, const Matrix& matrix, int)
+        -> decltype(solver.analyzePattern(matrix), void())
+      { solver.analyzePattern(matrix); }
+
+      template <typename Solver, typename Matrix>
+      static void analyzePattern(Solver&, const Matrix&, long)
+      {}
+
+      template <typename Solver, typename Matrix>
+      static auto factorize(Solver& solver, const Matrix& matrix, int)
+        -> decltype(solver.factorize(matrix), void())
+      { solver.factorize(matrix); }
+
+      template <typename Solver, typename Matrix>
+      static void factorize(Solver& solver, const Matrix& matrix, long)
+      { solver.compute(matrix); }
+
+      template <typename Solver, typename Vector>
+      static auto solveWithGuess(const Solver& solver, const Vector& input, const Vector& guess, int)
+        -> decltype(Vector(solver.solveWithGuess(input, guess)))
+      { return solver.solveWithGuess(input, guess); }
+
+      template <typename Solver, typename Vector>
+      static Vector solveWithGuess(const Solver& solver, const Vector& input, const Vector&, long)
+      { return solver.solve(input); }
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class DiscreteExteriorCalculusSolver
   /**
@@ -81,6 +121,7 @@ namespace DGtal
     typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
+    typedef typename Calculus::DenseMatrix DenseMatrix;
 
     /**
      * Constructor.
@@ -112,6 +153,27 @@ namespace DGtal
      */
     DiscreteExteriorCalculusSolver& compute(const Operator& linear_operator);
 
+    /**
+     * Symbolic analysis of the sparsity pattern of a problem operator
+     * (e.g. the fill-reducing ordering of a sparse Cholesky
+     * factorization). It can be done once for a sequence of operators
+     * sharing the same pattern, each one being then given to
+     * factorize. Solvers without analyzePattern method ignore it.
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& analyzePattern(const Operator& linear_operator);
+
+    /**
+     * Numerical factorization of a problem operator, whose sparsity
+     * pattern is the one given to the last call to analyzePattern.
+     * Solvers without factorize method compute the whole factorization.
+     * @param linear_operator linear operator, which must outlive the
+     * solving with iterative solvers.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& factorize(const Operator& linear_operator);
+
     /**
      * Solve prefactorized / set problem input.
      * @param input_kform input k-form.
@@ -119,6 +181,45 @@ namespace DGtal
      */
     SolutionKForm solve(const InputKForm& input_kform) const;
 
+    /**
+     * Solve prefactorized / set problem input, iterative solvers
+     * starting from an initial guess (e.g. the solution of a close
+     * problem). Direct solvers ignore the guess.
+     * @param input_kform input k-form.
+     * @param guess_kform initial guess of the solution.
+     * @return problem solution.
+     */
+    SolutionKForm solve(const InputKForm& input_kform, const SolutionKForm& guess_kform) const;
+
+    /**
+     * Solve prefactorized / set problem for several inputs at once,
+     * given as the columns of a dense matrix. Direct solvers perform
+     * a single blocked forward / backward substitution for all the
+     * columns.
+     * @param inputs dense matrix whose columns are the input k-form containers.
+     * @return dense matrix whose columns are the problem solutions.
+     */
+    DenseMatrix solve(const DenseMatrix& inputs) const;
+
+    /**
+     * Solve prefactorized / set problem for several input k-forms at
+     * once (e.g. the components of a vector field).
+     * @param input_kforms input k-forms.
+     * @return problem solutions, in the order of the inputs.
+     */
+    std::vector<SolutionKForm> solve(const std::vector<InputKForm>& input_kforms) const;
+
+    /**
+     * Solve prefactorized / set problem for several input k-forms at
+     * once, iterative solvers starting from initial guesses. Direct
+     * solvers ignore the guesses.
+     * @param input_kforms input k-forms.
+     * @param guess_kforms initial guesses of the solutions, one per input.
+     * @return problem solutions, in the order of the inputs.
+     */
+    std::vector<SolutionKForm> solve(const std::vector<InputKForm>& input_kforms,
+                                     const std::vector<SolutionKForm>& guess_kforms) const;
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -0,0 +1,261 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IntegralInvariantFFTConvolver.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module IntegralInvariantFFTConvolver.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IntegralInvariantFFTConvolver_RECURSES)
+#error Recursive header files inclusion detected in IntegralInvariantFFTConvolver.h
+#else // defined(IntegralInvariantFFTConvolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IntegralInvariantFFTConvolver_RECURSES
+
+#if !defined IntegralInvariantFFTConvolver_h
+/** Prevents repeated inclusion of headers. */
+#define IntegralInvariantFFTConvolver_h
+
+#ifndef WITH_FFTW3
+  #error You need to have activated FFTW3 (WITH_FFTW3) to include this file.
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/math/RealFFT.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class IntegralInvariantFFTConvolver
+/**
+ * Description of template class 'IntegralInvariantFFTConvolver' <p>
+ * \brief Aim: Computes, at many points at once, the moments of the
+ * intersection of a digital shape with a digital kernel, by a global
+ * convolution of the shape with the kernel in the Fourier domain.
+ *
+ * For a kernel K (a set of digital points centered on the origin), a
+ * monomial \f$ k^e = \prod_i k_i^{e_i} \f$ and a point c, the moment is
+ * \f$ \sum_{k \in K} k^e \chi(c + k) \f$, where \f$ \chi \f$ is the
+ * characteristic function of the shape restricted to the domain of the
+ * cellular grid space. The zeroth order moment is the volume
+ * computed by IntegralInvariantVolumeEstimator, the moments up to order
+ * two give the covariance matrix of IntegralInvariantCovarianceEstimator.
+ *
+ * Instead of summing the kernel over each point, which costs the
+ * volume (or the boundary of the kernel) per point, each moment is
+ * obtained by one forward and one backward transform of RealFFT
+ * over the whole domain, whatever the radius. The forward transform of
+ * the shape is computed once and kept: it is reused for all the
+ * monomials and for all the kernels whose radius fits in the padding of
+ * the domain (see reserve), e.g. when evaluating several radii.
+ *
+ * The weights being integers, the moments are rounded to the nearest
+ * integers and are thus exactly those of the direct summation.
+ *
+ * @note The transformed domain is the domain of the cellular grid
+ * space, padded by the kernel radius so that the circular convolution
+ * does not wrap around, its extents being rounded up to products of
+ * small primes for FFTW. Memory usage is therefore about two complex
+ * images of this size.
+ *
+ * @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
+ * in which the shape is defined.
+ *
+ * @tparam TPointPredicate a model of concepts::CPointPredicate, a
+ * predicate Point -> bool that defines a digital shape as a
+ * characteristic function.
+ *
+ * @see IntegralInvariantFFTVolumeEstimator, IntegralInvariantFFTCovarianceEstimator
+ */
+template <typename TKSpace, typename TPointPredicate>
+class IntegralInvariantFFTConvolver
+{
+public:
+  typedef IntegralInvariantFFTConvolver< TKSpace, TPointPredicate > Self;
+  typedef TKSpace KSpace;
+  typedef TPointPredicate PointPredicate;
+
+  BOOST_CONCEPT_ASSERT (( concepts::CCellularGridSpaceND< KSpace > ));
+  BOOST_CONCEPT_ASSERT (( concepts::CPointPredicate< PointPredicate > ));
+
+  typedef typename KSpace::Space Space;
+  typedef typename Space::Integer Integer;
+  typedef typename Space::Point Point;
+  typedef HyperRectDomain<Space> Domain;
+  /// Exponents of a monomial of the kernel coordinates.
+  typedef Point Monomial;
+  /// The type of the moments.
+  typedef double Quantity;
+  typedef RealFFT< Domain, double > FFT;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+   * Default constructor. The object is invalid. The user needs to call
+   * attach.
+   */
+  IntegralInvariantFFTConvolver();
+
+  /**
+   * Constructor.
+   *
+   * @param[in] K the cellular grid space in which the shape is defined.
+   * @param[in] aPointPredicate the shape of interest. The alias can be secured
+   * if a some counted pointer is handed.
+   */
+  IntegralInvariantFFTConvolver( ConstAlias< KSpace > K,
+                                 ConstAlias< PointPredicate > aPointPredicate );
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+   * Attach a shape, defined as a point predicate. The transform of
+   * the previous shape is released.
+   *
+   * @param[in] K the cellular grid space in which the shape is defined.
+   * @param[in] aPointPredicate the shape of interest. The alias can be secured
+   * if a some counted pointer is handed.
+   */
+  void attach( ConstAlias< KSpace > K,
+               ConstAlias< PointPredicate > aPointPredicate );
+
+  /**
+   * Ensures that the transform of the shape can be used with kernels
+   * included in the box [-aRadius,aRadius]^d. Computes it (again) if
+   * it has not been computed yet or if its padding is too small.
+   * Calling it first with the largest radius avoids recomputations
+   * when several kernels are used.
+   *
+   * @param[in] aRadius the half-width of the bounding box of the kernels.
+   */
+  void reserve( Integer aRadius );
+
+  /**
+   * @return the half-width of the bounding box of the largest kernel
+   * that the current transform of the shape supports (-1 if none).
+   */
+  Integer radius() const;
+
+  /**
+   * @tparam TDigitalKernel a digital shape with a domain, e.g. a
+   * GaussDigitizer.
+   * @param[in] aKernel a digital kernel.
+   * @return the half-width of the bounding box of the domain of @a aKernel.
+   */
+  template <typename TDigitalKernel>
+  static Integer kernelRadius( const TDigitalKernel & aKernel );
+
+  /**
+   * Computes the moments of the intersection of the shape with the
+   * kernel translated at each given point.
+   *
+   * @tparam TDigitalKernel a digital shape with a domain (getDomain())
+   * and a membership test (operator()), e.g. a GaussDigitizer.
+   *
+   * @param[in] aKernel the kernel, centered on the origin.
+   * @param[in] monomials the exponents of the monomials weighting the
+   * kernel points (Point::zero for the volume).
+   * @param[in] points the points where moments are evaluated. They
+   * must lie in the domain of the cellular grid space, or be adjacent
+   * to it (e.g. the spels incident to its surfels).
+   * @param[out] moments the moments, @a moments[ m ][ i ] being the
+   * moment of monomial @a m at point @a i.
+   */
+  template <typename TDigitalKernel>
+  void eval( const TDigitalKernel & aKernel,
+             const std::vector< Monomial > & monomials,
+             const std::vector< Point > & points,
+             std::vector< std::vector< Quantity > > & moments );
+
+  /**
+   * Writes/Displays the object on an output stream.
+   * @param out the output stream where the object is written.
+   */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+   * Checks the validity/consistency of the object.
+   * @return 'true' if the object is valid, 'false' otherwise.
+   */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  CountedConstPtrOrConstPtr<PointPredicate> myPointPredicate; ///< Smart pointer (if required) on a point predicate.
+  Domain myShapeDomain;       ///< Domain of the cellular grid space.
+  Integer myRadius;           ///< Largest kernel radius supported by the shape transform.
+  CountedPtr<FFT> myShapeFFT; ///< Forward transform of the shape (shared between copies).
+
+  // ------------------------- Internals ------------------------------------
+private:
+
+  /**
+   * @param[in] n a size.
+   * @return the smallest integer not smaller than @a n whose prime
+   * factors are 2, 3, 5 or 7.
+   */
+  static Integer fftSize( Integer n );
+
+}; // end of class IntegralInvariantFFTConvolver
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IntegralInvariantFFTConvolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IntegralInvariantFFTConvolver' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TPointPredicate>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IntegralInvariantFFTConvolver<TKSpace, TPointPredicate> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTConvolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IntegralInvariantFFTConvolver_h
+
+#undef IntegralInvariantFFTConvolver_RECURSES
+#endif // else defined(IntegralInvariantFFTConvolver_RECURSES)
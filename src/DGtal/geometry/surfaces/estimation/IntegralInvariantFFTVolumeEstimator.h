@@ -0,0 +1,318 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IntegralInvariantFFTVolumeEstimator.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module IntegralInvariantFFTVolumeEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IntegralInvariantFFTVolumeEstimator_RECURSES)
+#error Recursive header files inclusion detected in IntegralInvariantFFTVolumeEstimator.h
+#else // defined(IntegralInvariantFFTVolumeEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IntegralInvariantFFTVolumeEstimator_RECURSES
+
+#if !defined IntegralInvariantFFTVolumeEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define IntegralInvariantFFTVolumeEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTConvolver.h"
+//////////////////////////////////////////////////////////////////////////////
+
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class IntegralInvariantFFTVolumeEstimator
+/**
+* Description of template class 'IntegralInvariantFFTVolumeEstimator' <p>
+* \brief Aim: This class computes the same Integral Invariant volumes
+* as IntegralInvariantVolumeEstimator, the volume of the intersection
+* of the shape with a ball of given radius centered on each surfel, by
+* a global convolution of the shape with the ball in the Fourier domain
+* (see IntegralInvariantFFTConvolver).
+*
+* The cost no longer depends on the radius per surfel: it is one pair
+* of transforms of the (padded) domain per radius, plus one forward
+* transform of the shape that is shared by all radii. It is therefore
+* faster than IntegralInvariantVolumeEstimator for large radii and
+* for multiscale analysis (evalMultiscale), when many surfels are
+* evaluated at once.
+*
+* The volumes are computed in init for the given range of surfels,
+* eval then reads them. Evaluating surfels not given to init costs a
+* new convolution of the whole domain, done once per call to eval for
+* all its missing surfels. Their volumes are then kept, so that
+* each surfel is convolved at most once. Giving all the surfels of
+* interest to init is thus much faster than evaluating them one by one.
+* The const eval methods may be called concurrently: the kept values
+* are guarded by a mutex, hence evaluations of unknown surfels are
+* serialized.
+*
+* @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
+* in which the shape is defined.
+*
+* @tparam TPointPredicate a model of concepts::CPointPredicate, a predicate
+* Point -> bool that defines a digital shape as a characteristic
+* function.
+*
+* @tparam TVolumeFunctor a model of functor Real -> Quantity, that
+* defines how the volume is transformed into e.g. a curvature, etc.
+* Models include IIGeometricFunctors::IICurvatureFunctor,
+* IIGeometricFunctors::IIMeanCurvature3DFunctor.
+*
+* @note Requires FFTW3 (WITH_FFTW3).
+*
+* @see testIntegralInvariantFFTEstimators.cpp
+*/
+template <typename TKSpace, typename TPointPredicate, typename TVolumeFunctor>
+class IntegralInvariantFFTVolumeEstimator
+{
+public:
+  typedef IntegralInvariantFFTVolumeEstimator< TKSpace, TPointPredicate, TVolumeFunctor> Self;
+  typedef TKSpace KSpace;
+  typedef TPointPredicate PointPredicate;
+  typedef TVolumeFunctor VolumeFunctor;
+
+  typedef typename KSpace::Space Space;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef typename Space::RealPoint RealPoint;
+  typedef typename KSpace::SCell Spel;
+  typedef typename KSpace::Surfel Surfel;
+
+  /// The returned type of the estimator, depends on the functor
+  typedef typename VolumeFunctor::Quantity Quantity;
+  typedef double Scalar;
+
+  typedef ImplicitBall<Space> KernelSupport;
+  typedef GaussDigitizer< Space, KernelSupport > DigitalShapeKernel;
+  typedef IntegralInvariantFFTConvolver< KSpace, PointPredicate > Convolver;
+
+  BOOST_CONCEPT_ASSERT (( concepts::CUnaryFunctor< VolumeFunctor, Scalar, Quantity > ));
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+  * Default constructor. The object is invalid. The user needs to call
+  * setParams and attach.
+  *
+  * @param[in] fct the functor for transforming the volume into
+  * some quantity. If not precised, a default object is instantiated.
+  */
+  IntegralInvariantFFTVolumeEstimator( VolumeFunctor fct = VolumeFunctor() );
+
+  /**
+  * Constructor.
+  *
+  * @param[in] K the cellular grid space in which the shape is defined.
+  * @param[in] aPointPredicate the shape of interest. The alias can be secured
+  * if a some counted pointer is handed.
+  * @param[in] fct the functor for transforming the volume into
+  * some quantity. If not precised, a default object is instantiated.
+  */
+  IntegralInvariantFFTVolumeEstimator ( ConstAlias< KSpace > K,
+                                        ConstAlias< PointPredicate > aPointPredicate,
+                                        VolumeFunctor fct = VolumeFunctor() );
+
+  /**
+  * Clears the object. It is now invalid.
+  */
+  void clear();
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /// @return the grid step.
+  Scalar h() const;
+
+  /**
+  * Attach a shape, defined as a functor spel -> boolean
+  *
+  * @param[in] K the cellular grid space in which the shape is defined.
+  * @param aPointPredicate the shape of interest. The alias can be secured
+  * if a some counted pointer is handed.
+  */
+  void attach( ConstAlias< KSpace > K,
+               ConstAlias<PointPredicate> aPointPredicate );
+
+  /**
+  * Set specific parameters: the radius of the ball.
+  *
+  * @param[in] dRadius the "digital" radius of the kernel (buy may be non integer).
+  */
+  void setParams( const double dRadius );
+
+  /**
+  * Model of CDigitalSurfaceLocalEstimator. Initialisation: computes
+  * the volumes at the surfels of the range.
+  *
+  * @tparam SurfelConstIterator any model of forward readable iterator on Surfel.
+  * @param[in] _h grid size (must be >0).
+  * @param[in] itb iterator on the first surfel of the surface.
+  * @param[in] ite iterator after the last surfel of the surface.
+  */
+  template <typename SurfelConstIterator>
+  void init( const double _h, SurfelConstIterator itb, SurfelConstIterator ite );
+
+  /**
+  * -- Estimation --
+  *
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  * @param[in] it iterator pointing on the surfel of the shape where
+  * we wish to evaluate some geometric information. If it was not given
+  * to init, it costs a convolution of the whole domain.
+  * @return the VolumeFunctor applied to the volume at surfel *it.
+  */
+  template< typename SurfelConstIterator >
+  Quantity eval ( SurfelConstIterator it ) const;
+
+  /**
+  * -- Estimation --
+  *
+  * Applies the VolumeFunctor to the volumes of a range of surfels
+  * [itb,ite) and outputs the results.
+  *
+  * @tparam OutputIterator type of Iterator of an array of Quantity
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  * @param[in] itb iterator defining the start of the range of surfels.
+  * @param[in] ite iterator defining the end of the range of surfels.
+  * @param[in] result output iterator of results of the computation.
+  * @return the updated output iterator after all outputs.
+  * @note the surfels that were not given to init cost one convolution
+  * of the whole domain for all of them.
+  */
+  template <typename OutputIterator, typename SurfelConstIterator>
+  OutputIterator eval( SurfelConstIterator itb,
+                       SurfelConstIterator ite,
+                       OutputIterator result ) const;
+
+  /**
+  * -- Multiscale estimation --
+  *
+  * Estimates the quantities of a range of surfels for several radii.
+  * The transform of the shape is computed once, for the largest
+  * radius, and reused for the others. The volume functor is
+  * initialized with each radius in turn. The parameters set by
+  * setParams and init are left unchanged.
+  *
+  * @tparam SurfelConstIterator type of Iterator on a Surfel
+  * @param[in] _h grid size (must be >0).
+  * @param[in] radii the "digital" radii of the kernels.
+  * @param[in] itb iterator defining the start of the range of surfels.
+  * @param[in] ite iterator defining the end of the range of surfels.
+  * @return the quantities, one vector (in the order of the range) per radius.
+  */
+  template <typename SurfelConstIterator>
+  std::vector< std::vector< Quantity > >
+  evalMultiscale( const double _h, const std::vector< double > & radii,
+                  SurfelConstIterator itb, SurfelConstIterator ite );
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  VolumeFunctor myFct;                 ///< The volume functor that transforms the volume into a quantity.
+  CountedConstPtrOrConstPtr<KSpace> myKSpace; ///< Smart pointer (if required) on the cellular grid space.
+  CountedPtr<Convolver> myConvolver;   ///< FFT convolver (keeps the transform of the shape).
+  mutable std::map< Surfel, Scalar > myVolumes; ///< Volumes at the surfels given to init or evaluated since.
+  CountedPtr<std::mutex> myMutex;      ///< Guards the cache in the const eval methods (shared by copies, as the convolver).
+  Scalar myH;                          ///< precision of the grid
+  Scalar myRadius;                     ///< "digital" radius of the kernel (buy may be non integer).
+
+  // ------------------------- Internals ------------------------------------
+private:
+
+  /**
+  * Computes by one convolution the volumes of the surfels that
+  * are not known yet, and keeps them. The cache is locked during
+  * the call, so that const eval methods may be called concurrently.
+  *
+  * @param[in] surfels the surfels.
+  * @return the volumes of the surfels, in the same order.
+  */
+  std::vector< Scalar > extend( const std::vector< Surfel > & surfels ) const;
+
+  /**
+  * Computes the volumes of a range of surfels by convolution.
+  *
+  * @param[in] _h grid size.
+  * @param[in] dRadius the "digital" radius of the kernel.
+  * @param[in] surfels the surfels.
+  * @return the volumes (mean of the volumes at the inner and outer spels).
+  */
+  std::vector< Scalar > volumes( const double _h, const double dRadius,
+                                 const std::vector< Surfel > & surfels ) const;
+
+}; // end of class IntegralInvariantFFTVolumeEstimator
+
+  /**
+  * Overloads 'operator<<' for displaying objects of class 'IntegralInvariantFFTVolumeEstimator'.
+  * @param out the output stream where the object is written.
+  * @param object the object of class 'IntegralInvariantFFTVolumeEstimator' to write.
+  * @return the output stream after the writing.
+  */
+  template <typename TKSpace, typename TPointPredicate, typename TVolumeFunctor>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IntegralInvariantFFTVolumeEstimator<TKSpace, TPointPredicate, TVolumeFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTVolumeEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IntegralInvariantFFTVolumeEstimator_h
+
+#undef IntegralInvariantFFTVolumeEstimator_RECURSES
+#endif // else defined(IntegralInvariantFFTVolumeEstimator_RECURSES)
@@ -233,6 +233,22 @@ public:
   * @param[in] dRadius the "digital" radius of the kernel (buy may be non integer).
   */
   void setParams( const double dRadius );
+
+  /**
+  * Sets the number of threads used by eval on a range of surfels.
+  * With more than one thread, the range is split into contiguous
+  * chunks evaluated in parallel (the incremental convolution restarts
+  * at the beginning of each chunk) and the results are output in the
+  * order of the range. The point predicate must support concurrent
+  * calls.
+  *
+  * @param[in] nbThreads the number of threads, 1 (default) for a
+  * sequential evaluation, 0 for ParallelFor::nbThreads().
+  */
+  void setNbThreads( unsigned int nbThreads );
+
+  /// @return the number of threads used by eval on a range of surfels (see setNbThreads).
+  unsigned int nbThreads() const;
   
   /**
   * Model of CDigitalSurfaceLocalEstimator. Initialisation.
@@ -316,6 +332,7 @@ private:
   CountedPtr<Convolver>          myConvolver;   ///< Convolver
   Scalar myH;                               ///< precision of the grid
   Scalar myRadius;                          ///< "digital" radius of the kernel (buy may be non integer).
+  unsigned int myNbThreads;                 ///< number of threads of eval on a range (see setNbThreads).
 
 private:
 
@@ -127,7 +127,7 @@ namespace DGtal
     ///Definition of the image.
     typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric> Self;
 
-    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric> Parent;
+    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer> Parent;
 
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
@@ -165,6 +165,26 @@ namespace DGtal
                                                                             aPeriodicitySpec)
     {}
 
+    /**
+     *  Constructor with a user provided storage of the Voronoi map
+     *  (e.g. a TiledImage spilled to the disk for volumes larger than
+     *  the memory).
+     *
+     * See documentation of VoronoiMap constructor.
+     */
+    DistanceTransformation(ConstAlias<Domain> aDomain,
+                           ConstAlias<PointPredicate> predicate,
+                           ConstAlias<SeparableMetric> aMetric,
+                           Clone<typename Parent::OutputImage> anOutputImage,
+                           typename Parent::PeriodicitySpec const & aPeriodicitySpec
+                             = typename Parent::PeriodicitySpec())
+      : VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
+                                                                            predicate,
+                                                                            aMetric,
+                                                                            anOutputImage,
+                                                                            aPeriodicitySpec)
+    {}
+
     /**
      * Default destructor
      */
@@ -48,9 +48,12 @@
 #include <limits>
 #include <map>
 #include <set>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/ImageHelper.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -96,6 +99,115 @@ namespace DGtal
 	  return ( std::abs(a.second) < std::abs(b.second) ); 
       }
     };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FMMHandles
+  /**
+   * Description of template class 'FMMHandles' <p>
+   * \brief Aim: Small class storing, for each candidate point
+   * of the FMM, its position in the heap of candidates.
+   *
+   * In the general case, no position is stored: a point may
+   * appear several times in the heap and the outdated pairs are
+   * skipped when they reach the top of the heap, because their
+   * point has already been accepted.
+   *
+   * @tparam TImage model of CImage
+   */
+    template<typename TImage>
+    class FMMHandles {
+    public:
+      typedef typename TImage::Point Point;
+      typedef std::size_t Index;
+      /// 'true' if positions and accepted points are recorded
+      static const bool tracksAccepted = false;
+      /// @return the index of the points that are not candidates
+      static Index none() { return std::numeric_limits<Index>::max(); }
+      /// @return the index of the accepted points
+      static Index accepted() { return none() - 1; }
+
+      /**
+       * Constructor.
+       * @param aImg the image of the FMM (not used)
+       */
+      FMMHandles(const TImage& aImg) { boost::ignore_unused_variable_warning( aImg ); }
+
+      /**
+       * @param aPoint any point
+       * @return none()
+       */
+      Index get(const Point& aPoint) const
+      {
+	boost::ignore_unused_variable_warning( aPoint );
+	return none();
+      }
+
+      /**
+       * Does nothing.
+       * @param aPoint any point
+       * @param aIndex a position, none() or accepted()
+       */
+      void set(const Point& aPoint, Index aIndex)
+      {
+	boost::ignore_unused_variable_warning( aPoint );
+	boost::ignore_unused_variable_warning( aIndex );
+      }
+    };
+
+  /**
+   * Description of template class 'FMMHandles' <p>
+   * \brief Aim: Specialization of FMMHandles for images stored in
+   * a STL vector: positions and accepted points are stored in
+   * a dense image of the same domain (constant time accesses).
+   *
+   * @tparam TDomain a HyperRectDomain
+   * @tparam TValue the image value type
+   */
+    template<typename TDomain, typename TValue>
+    class FMMHandles< ImageContainerBySTLVector<TDomain, TValue> > {
+    public:
+      typedef typename TDomain::Point Point;
+      typedef std::size_t Index;
+      /// 'true' if positions and accepted points are recorded
+      static const bool tracksAccepted = true;
+      /// @return the index of the points that are not candidates
+      static Index none() { return std::numeric_limits<Index>::max(); }
+      /// @return the index of the accepted points
+      static Index accepted() { return none() - 1; }
+
+      /**
+       * Constructor.
+       * @param aImg the image of the FMM
+       */
+      FMMHandles(const ImageContainerBySTLVector<TDomain, TValue>& aImg)
+	: myHandles( aImg.domain() )
+      {
+	std::fill( myHandles.begin(), myHandles.end(), none() );
+      }
+
+      /**
+       * @param aPoint any point of the domain
+       * @return the heap position of @a aPoint, none() or accepted()
+       */
+      Index get(const Point& aPoint) const
+      {
+	return myHandles[ myHandles.linearized( aPoint ) ];
+      }
+
+      /**
+       * Sets the heap position of @a aPoint.
+       * @param aPoint any point of the domain
+       * @param aIndex a position, none() or accepted()
+       */
+      void set(const Point& aPoint, Index aIndex)
+      {
+	myHandles[ myHandles.linearized( aPoint ) ] = aIndex;
+      }
+
+    private:
+      /// Positions of the candidates and accepted points
+      ImageContainerBySTLVector<TDomain, Index> myHandles;
+    };
   }
 
   /////////////////////////////////////////////////////////////////////////////
@@ -122,8 +234,13 @@ namespace DGtal
    * accepted points. The tentative values of the candidates adjacent 
    * to the newly added point are updated using the distance value
    * of the newly added point. The search of the point of smallest
-   * tentative value is accelerated using a STL set of pairs (point, 
-   * tentative value).  
+   * tentative value is accelerated using a binary heap of pairs (point, 
+   * tentative value). When the image is an ImageContainerBySTLVector, 
+   * the position of each candidate in the heap and the accepted points 
+   * are stored in a dense image of the same domain: each candidate 
+   * appears once in the heap and its tentative value is decreased in 
+   * place. Otherwise, a candidate may appear several times in the heap 
+   * and the outdated pairs are skipped (see detail::FMMHandles). 
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -182,8 +299,10 @@ namespace DGtal
 
     //intern data types
     typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     detail::PointValueCompare<PointValue> > CandidatePointSet; 
+    typedef std::vector<PointValue> CandidatePointSet; 
+    typedef detail::PointValueCompare<PointValue> CandidateCompare; 
+    typedef detail::FMMHandles<Image> Handles; 
+    typedef typename Handles::Index Index; 
     typedef DGtal::uint64_t Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -200,10 +319,16 @@ namespace DGtal
     AcceptedPointSet& myAcceptedPoints; 
 
     /**
-     * Set of candidate points
+     * Binary heap of candidate points
      */
     CandidatePointSet myCandidatePoints; 
 
+    /**
+     * Positions of the candidate points in the heap
+     * (see detail::FMMHandles)
+     */
+    Handles myHandles; 
+
     /**
      * Pointer on the point functor used to deduce 
      * the distance of a new point
@@ -510,6 +635,42 @@ namespace DGtal
      */
     bool addNewCandidate(const Point& aPoint);
 
+    /**
+     * @param aPoint any point
+     * @return 'true' if @a aPoint is accepted
+     */
+    bool isAccepted(const Point& aPoint) const;
+
+    /**
+     * Inserts a candidate in the heap, or decreases its tentative
+     * value if it is already a candidate with a greater value
+     * (if positions are stored, see detail::FMMHandles).
+     *
+     * @param aPair a pair (point, tentative value)
+     */
+    void pushCandidate(const PointValue& aPair);
+
+    /**
+     * Removes the candidate of smallest tentative value from the heap.
+     *
+     * @pre the heap is not empty
+     */
+    void popCandidate();
+
+    /**
+     * Moves up the candidate at position @a aIndex until the heap 
+     * property holds.
+     * @param aIndex a position in the heap
+     */
+    void siftUp(Index aIndex);
+
+    /**
+     * Moves down the candidate at position @a aIndex until the heap 
+     * property holds.
+     * @param aIndex a position in the heap
+     */
+    void siftDown(Index aIndex);
+
 
   }; // end of class FMM
 
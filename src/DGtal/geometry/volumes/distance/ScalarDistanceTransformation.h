@@ -0,0 +1,457 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ScalarDistanceTransformation.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ScalarDistanceTransformation.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ScalarDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in ScalarDistanceTransformation.h
+#else // defined(ScalarDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ScalarDistanceTransformation_RECURSES
+
+#if !defined ScalarDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define ScalarDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class L2SquaredSeparableDistance
+  /**
+   * Description of template class 'L2SquaredSeparableDistance' <p>
+   * \brief Aim: squared Euclidean distance functions for
+   * ScalarDistanceTransformation.
+   *
+   * Given the raw distance @a g(i) of a point @a i of a line to the
+   * sites in the previous dimensions, the raw distance at @a x from
+   * @a i is @f$ f(x,i) = (x-i)^2 + g(i) @f$, and @a sep(i,u) is the
+   * last abscissa where @a i is closer than @a u (see
+   * @cite Meijster2000).
+   *
+   * @tparam TRawValue the type used to store the squared distances.
+   */
+  template <typename TRawValue = DGtal::uint32_t>
+  struct L2SquaredSeparableDistance
+  {
+    /// Type of the stored (squared) distances
+    typedef TRawValue RawValue;
+    /// Type of the distances
+    typedef double Value;
+    /// Type of intermediate computations
+    typedef DGtal::int64_t Integer;
+
+    /// @return the raw distance at @a dx from a point at raw distance @a g.
+    static Integer f( Integer dx, Integer g )
+    {
+      return dx * dx + g;
+    }
+
+    /// @return the last abscissa where @a i is closer than @a u (i < u).
+    static Integer sep( Integer i, Integer u, Integer gi, Integer gu )
+    {
+      return ( u * u - i * i + gu - gi ) / ( 2 * ( u - i ) );
+    }
+
+    /// @return the distance associated to the raw distance @a r.
+    static Value value( RawValue r )
+    {
+      return std::sqrt( static_cast<Value>( r ) );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class L1SeparableDistance
+  /**
+   * Description of template class 'L1SeparableDistance' <p>
+   * \brief Aim: l_1 (Manhattan) distance functions for
+   * ScalarDistanceTransformation, @f$ f(x,i) = |x-i| + g(i) @f$
+   * (see @cite Meijster2000).
+   *
+   * @tparam TRawValue the type used to store the distances.
+   */
+  template <typename TRawValue = DGtal::uint32_t>
+  struct L1SeparableDistance
+  {
+    /// Type of the stored distances
+    typedef TRawValue RawValue;
+    /// Type of the distances
+    typedef double Value;
+    /// Type of intermediate computations
+    typedef DGtal::int64_t Integer;
+
+    /// @return the raw distance at @a dx from a point at raw distance @a g.
+    static Integer f( Integer dx, Integer g )
+    {
+      return ( dx < 0 ? -dx : dx ) + g;
+    }
+
+    /// @return the last abscissa where @a i is closer than @a u (i < u).
+    static Integer sep( Integer i, Integer u, Integer gi, Integer gu )
+    {
+      if ( gu >= gi + u - i )
+        return std::numeric_limits<Integer>::max() / 4;
+      if ( gi > gu + u - i )
+        return std::numeric_limits<Integer>::min() / 4;
+      return ( gu - gi + u + i ) / 2;
+    }
+
+    /// @return the distance associated to the raw distance @a r.
+    static Value value( RawValue r )
+    {
+      return static_cast<Value>( r );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LinfSeparableDistance
+  /**
+   * Description of template class 'LinfSeparableDistance' <p>
+   * \brief Aim: l_infinity (chessboard) distance functions for
+   * ScalarDistanceTransformation, @f$ f(x,i) = max(|x-i|, g(i)) @f$
+   * (see @cite Meijster2000).
+   *
+   * @tparam TRawValue the type used to store the distances.
+   */
+  template <typename TRawValue = DGtal::uint32_t>
+  struct LinfSeparableDistance
+  {
+    /// Type of the stored distances
+    typedef TRawValue RawValue;
+    /// Type of the distances
+    typedef double Value;
+    /// Type of intermediate computations
+    typedef DGtal::int64_t Integer;
+
+    /// @return the raw distance at @a dx from a point at raw distance @a g.
+    static Integer f( Integer dx, Integer g )
+    {
+      return std::max( dx < 0 ? -dx : dx, g );
+    }
+
+    /// @return the last abscissa where @a i is closer than @a u (i < u).
+    static Integer sep( Integer i, Integer u, Integer gi, Integer gu )
+    {
+      if ( gi <= gu )
+        return std::max( i + gu, ( i + u ) / 2 );
+      return std::min( u - gi, ( i + u ) / 2 );
+    }
+
+    /// @return the distance associated to the raw distance @a r.
+    static Value value( RawValue r )
+    {
+      return static_cast<Value>( r );
+    }
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ScalarDistanceTransformation
+  /**
+   * Description of template class 'ScalarDistanceTransformation' <p>
+   * \brief Aim: Implementation of the linear in time distance
+   * transformation storing only one scalar per point.
+   *
+   * Contrary to DistanceTransformation, which is built on a
+   * VoronoiMap and stores a vector to the closest site at each point,
+   * this class only stores the raw distance to the closest site (the
+   * squared distance for the Euclidean metric) in an integer per
+   * point, typically a DGtal::uint32_t (instead of three coordinates
+   * in 3D). It is thus suited to thresholding or morphological
+   * operations, when the closest sites are not needed.
+   *
+   * The separable algorithm of @cite Meijster2000 is used: the
+   * first pass computes the 1D distances along the first axis, and
+   * each subsequent pass computes the lower envelope of the distance
+   * functions of the previous pass along one axis. Lines of a pass are
+   * processed in parallel by tiles of neighbouring lines (see
+   * ParallelFor), each thread reusing its own buffers.
+   *
+   * The distance functions are given by the TSeparableDistance
+   * parameter: L2SquaredSeparableDistance (default),
+   * L1SeparableDistance or LinfSeparableDistance. Points without site
+   * along the processed lines (e.g. if there is no site at all) get
+   * the infinity() raw value and an infinite distance. Periodic
+   * domains are not supported.
+   *
+   * This class is a model of concepts::CConstImage, operator() returns
+   * the distance (e.g. the Euclidean distance, as DistanceTransformation
+   * with ExactPredicateLpSeparableMetric) and rawDistance() the stored
+   * value.
+   *
+   * @tparam TSpace type of Digital Space (model of concepts::CSpace).
+   * @tparam TPointPredicate point predicate returning false for points
+   * from which we compute the distance (model of concepts::CPointPredicate)
+   * @tparam TSeparableDistance the distance functions (see above).
+   *
+   * @see DistanceTransformation
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableDistance = L2SquaredSeparableDistance<> >
+  class ScalarDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( concepts::CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointPredicate<TPointPredicate> ));
+
+    ///Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Point,
+                          typename TPointPredicate::Point >::value ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Copy of the distance functions type.
+    typedef TSeparableDistance SeparableDistance;
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+
+    ///Definition of the underlying domain type.
+    typedef HyperRectDomain<Space> Domain;
+
+    ///Type of the stored raw distances.
+    typedef typename SeparableDistance::RawValue RawValue;
+
+    ///Definition of the image value type (distances).
+    typedef typename SeparableDistance::Value Value;
+
+    ///Type of the image storing the raw distances.
+    typedef ImageContainerBySTLVector<Domain, RawValue> RawImage;
+
+    ///Self type
+    typedef ScalarDistanceTransformation<TSpace, TPointPredicate,
+                                         TSeparableDistance> Self;
+
+    ///Definition of the image constRange
+    typedef DefaultConstImageRange<Self> ConstRange;
+
+    /**
+     * Constructor. Computes the distance transformation.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     *
+     * @param aPredicate a pointer to the point predicate to define the
+     * sites (false points).
+     *
+     * @pre the raw distance between opposite corners of the domain
+     * is lower than infinity(). For L2SquaredSeparableDistance, it is
+     * the sum of the squared (extent - 1) along the axes, hence at
+     * most 37838 points per axis in 3D with DGtal::uint32_t raw values.
+     */
+    ScalarDistanceTransformation( ConstAlias<Domain> aDomain,
+                                  ConstAlias<PointPredicate> aPredicate );
+
+    /**
+     * Default destructor
+     */
+    ~ScalarDistanceTransformation() = default;
+
+    /**
+     * Disabling default constructor.
+     */
+    ScalarDistanceTransformation() = delete;
+
+    // ------------------- ConstImage model ------------------------
+  public:
+
+    /**
+     * @return the domain of the distance map.
+     */
+    const Domain & domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * @return a const range on the distance values.
+     */
+    ConstRange constRange() const
+    {
+      return ConstRange( *this );
+    }
+
+    /**
+     * Access to the distance value at a point.
+     *
+     * @param aPoint the point to probe.
+     * @return the distance to the closest site (infinite if there is
+     * no site).
+     */
+    Value operator()( const Point & aPoint ) const
+    {
+      const RawValue r = myImage( aPoint );
+      return r == infinity() ? std::numeric_limits<Value>::infinity()
+                             : SeparableDistance::value( r );
+    }
+
+    /**
+     * Access to the raw distance value (e.g. squared Euclidean
+     * distance) at a point.
+     *
+     * @param aPoint the point to probe.
+     * @return the stored raw distance.
+     */
+    RawValue rawDistance( const Point & aPoint ) const
+    {
+      return myImage( aPoint );
+    }
+
+    /**
+     * @return the image of the raw distances.
+     */
+    const RawImage & rawImage() const
+    {
+      return myImage;
+    }
+
+    /**
+     * @return the raw value of points without site.
+     */
+    static RawValue infinity()
+    {
+      return DGtal::NumberTraits<RawValue>::max();
+    }
+
+    /**
+     * @return the wall-time (in ms) of each dimension pass, indexed by
+     * dimension.
+     */
+    const std::vector<double> & passDurations() const
+    {
+      return myPassDurations;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return true;
+    }
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    typedef typename SeparableDistance::Integer Integer;
+
+    /// Per-thread buffers of the 1D problems.
+    struct LineBuffers
+    {
+      std::vector<Integer> g;
+      std::vector<Integer> s;
+      std::vector<Integer> t;
+      std::vector<Integer> out;
+    };
+
+    /**
+     * Computes the distance pass along the dimension @a dim.
+     *
+     * @param [in] dim the dimension to process.
+     */
+    void computePass( const Dimension dim );
+
+    /**
+     * Replaces the raw distances in @a buffers.g by the lower envelope
+     * of the distance functions along the line (result in @a buffers.out).
+     *
+     * @param [in,out] buffers line buffers.
+     * @return false if there is no finite value along the line.
+     */
+    static bool lowerEnvelope( LineBuffers & buffers );
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Raw distances
+    RawImage myImage;
+
+    /// Wall-time (in ms) of each dimension pass.
+    std::vector<double> myPassDurations;
+
+  }; // end of class ScalarDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ScalarDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ScalarDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P, typename D>
+  std::ostream&
+  operator<< ( std::ostream & out, const ScalarDistanceTransformation<S,P,D> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ScalarDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ScalarDistanceTransformation_h
+
+#undef ScalarDistanceTransformation_RECURSES
+#endif // else defined(ScalarDistanceTransformation_RECURSES)
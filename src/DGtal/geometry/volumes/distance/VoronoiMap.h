@@ -55,11 +55,79 @@
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/images/TiledImage.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class VoronoiMapStorageTraits
+    /**
+     * Description of template class 'VoronoiMapStorageTraits' <p>
+     * \brief Aim: tells VoronoiMap how the 1D problems of a dimension
+     * pass should be scheduled on its output image.
+     *
+     * The lines of a pass are processed block by block, a block
+     * being the set of lines crossing a box of size blockSize()
+     * (the size along the pass dimension is ignored). If
+     * concurrentWrites is true, the lines of a block are processed in
+     * parallel.
+     *
+     * By default, the whole domain is a single block and values at
+     * distinct points can be written concurrently.
+     *
+     * @tparam TImage the type of the output image of VoronoiMap.
+     */
+    template <typename TImage>
+    struct VoronoiMapStorageTraits
+    {
+      /// True if values at distinct points can be set concurrently.
+      static const bool concurrentWrites = true;
+
+      /**
+       * @param anImage the output image.
+       * @return the size of the blocks.
+       */
+      static typename TImage::Point blockSize( const TImage & anImage )
+      {
+        return anImage.domain().upperBound() - anImage.domain().lowerBound()
+          + TImage::Point::diagonal( 1 );
+      }
+    };
+
+    /**
+     * Specialization for TiledImage: blocks are the tiles, so that
+     * the lines of a column of tiles are processed while these tiles
+     * are in the cache, and the cache is accessed sequentially.
+     */
+    template <typename TImageContainer, typename TImageFactory,
+              typename TReadPolicy, typename TWritePolicy>
+    struct VoronoiMapStorageTraits< TiledImage<TImageContainer, TImageFactory,
+                                               TReadPolicy, TWritePolicy> >
+    {
+      typedef TiledImage<TImageContainer, TImageFactory, TReadPolicy, TWritePolicy> Image;
+
+      /// The image cache is not thread safe.
+      static const bool concurrentWrites = false;
+
+      /**
+       * @param anImage the output image.
+       * @return the size of the tiles.
+       */
+      static typename Image::Point blockSize( const Image & anImage )
+      {
+        const typename Image::Domain tile =
+          anImage.findSubDomainFromBlockCoords( Image::Point::zero );
+        return tile.upperBound() - tile.lowerBound() + Image::Point::diagonal( 1 );
+      }
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class VoronoiMap
   /**
@@ -97,10 +165,23 @@ namespace DGtal
    * l_2@f$ metric, the overall computation is in @f$ O(d.n^d)@f$,
    * which is optimal.
    *
-   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
-   * to "true"), the computation is done in parallel (multithreaded)
-   * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * The 1D problems of each dimension pass are independent: they are
+   * grouped into tiles of neighbouring lines and processed in parallel
+   * (see ParallelFor), with OpenMP if DGtal has been built with OpenMP
+   * support (WITH_OPENMP flag set to "true") and with std::thread
+   * otherwise. Each thread reuses its own site buffer from one line
+   * to the next. On @a p processors, expected runtime is in
+   * @f$ O(h.d.n^d / p)@f$ and the result does not depend on the
+   * number of threads (see ParallelFor::setNbThreads). The wall-time
+   * of each dimension pass is available with passDurations().
+   *
+   * For volumes larger than the memory, the map can be stored in a
+   * TiledImage whose tiles are spilled to the disk (see
+   * ImageFactoryOnDisk) and given to the constructor. The passes are
+   * then processed column of tiles by column of tiles, sequentially,
+   * so that the memory is bounded by the cache size of the TiledImage
+   * (see ImageFactoryOnDisk::tilesPerDimension to choose it from a
+   * memory budget).
    *
    * This class is a model of concepts::CConstImage.
    *
@@ -237,6 +318,34 @@ namespace DGtal
                ConstAlias<PointPredicate> predicate,
                ConstAlias<SeparableMetric> aMetric,
                PeriodicitySpec const & aPeriodicitySpec);
+
+    /**
+     * Constructor with a user provided output image.
+     *
+     * Same as the other constructors but the Voronoi map is stored in
+     * @a anOutputImage (e.g. a TiledImage for out-of-core
+     * computations) instead of a new image.
+     *
+     * @param aDomain a pointer to the (hyper-rectangular) domain on
+     * which the computation is performed.
+     *
+     * @param predicate a pointer to the point predicate to define the
+     * Voronoi sites (false points).
+     *
+     * @param aMetric a pointer to the separable metric instance.
+     *
+     * @param anOutputImage the image storing the map, defined on
+     * @a aDomain (pass a CountedPtr to avoid its duplication).
+     *
+     * @param aPeriodicitySpec an array of size equal to the space dimension
+     *        where the i-th value is \c true if the i-th dimension of the
+     *        space is periodic, \c false otherwise.
+     */
+    VoronoiMap(ConstAlias<Domain> aDomain,
+               ConstAlias<PointPredicate> predicate,
+               ConstAlias<SeparableMetric> aMetric,
+               Clone<OutputImage> anOutputImage,
+               PeriodicitySpec const & aPeriodicitySpec = PeriodicitySpec());
     /**
      * Default destructor
      */
@@ -314,6 +423,15 @@ namespace DGtal
         return myPeriodicitySpec[ n ];
       }
 
+    /**
+     * @return the wall-time (in ms) of each dimension pass of the
+     * last computation, indexed by dimension.
+     */
+    const std::vector<double> & passDurations() const
+      {
+        return myPassDurations;
+      }
+
     /**
      * Project point coordinates into the domain, taking into account
      * the periodicity.
@@ -359,9 +477,12 @@ namespace DGtal
      *
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in,out] Sites site buffer, cleared and reused by the
+     * method (one buffer per thread).
      */
     void computeOtherStep1D (const Point &row,
-                             const Dimension dim) const;
+                             const Dimension dim,
+                             std::vector<Point> & Sites) const;
 
     /**
      * Project a coordinate into the domain, taking into account
@@ -400,6 +521,9 @@ namespace DGtal
     /// Domain extent.
     Point myDomainExtent;
 
+    /// Wall-time (in ms) of each dimension pass.
+    std::vector<double> myPassDurations;
+
   protected:
 
     ///Pointer to the separable metric instance
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <cstdlib>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -99,8 +100,15 @@ namespace DGtal
    *
    * @tparam TKSpace any cellular grid space, a model of
    * concepts::CCellularGridSpaceND like KhalimskySpaceND.
+   *
+   * @tparam TBinaryImage the type of binary images, a model of
+   * concepts::CImage with boolean values on an (hyper-)rectangular
+   * domain, providing begin() and end() iterators on its values in
+   * the order of the domain, like ImageContainerBySTLVector (default)
+   * or BitPackedBinaryImage.
    */
-  template  < typename TKSpace >
+  template  < typename TKSpace,
+              typename TBinaryImage = ImageContainerBySTLVector< HyperRectDomain< typename TKSpace::Space >, bool > >
     class Shortcuts
     {
       BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
@@ -138,7 +146,7 @@ namespace DGtal
       /// defines the digitization of an implicit shape.
       typedef GaussDigitizer< Space, ImplicitShape3D >     DigitizedImplicitShape3D;
       /// defines a black and white image with (hyper-)rectangular domain.
-      typedef ImageContainerBySTLVector<Domain, bool>      BinaryImage;
+      typedef TBinaryImage                                 BinaryImage;
       /// defines a grey-level image with (hyper-)rectangular domain.
       typedef ImageContainerBySTLVector<Domain, GrayScale> GrayScaleImage;
       /// defines a float image with (hyper-)rectangular domain.
@@ -990,7 +998,7 @@ namespace DGtal
       /// related to digital surfaces.
       ///   - surfelAdjacency     [        0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - nbTriesToFindABel   [   100000]: number of tries in method Surfaces::findABel
-      ///   - surfaceComponents   [ "AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough componen
+      ///   - surfaceComponents   [ "AnyBig"]: "AnyBig"|"Largest"|"All", "AnyBig": any big-enough componen, "Largest": the largest component
       ///   - surfaceTraversal    ["Default"]: "Default"|"DepthFirst"|"BreadthFirst": "Default" default surface traversal, "DepthFirst": depth-first surface traversal, "BreadthFirst": breadth-first surface traversal.
       static Parameters parametersDigitalSurface()
       {
@@ -1109,10 +1117,11 @@ namespace DGtal
       /// @param[in] params the parameters:
       ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - nbTriesToFindABel [  100000]: number of tries in method Surfaces::findABel
-      ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough component (> twice space width), "All": all components
+      ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"Largest"|"All", "AnyBig": any big-enough component (> twice space width), "Largest": the largest component, "All": all components
       ///
       /// @return a vector of smart pointers to the connected (light)
-      /// digital surfaces present in the binary image.
+      /// digital surfaces present in the binary image, ordered by their
+      /// smallest surfels.
       static std::vector< CountedPtr<LightDigitalSurface> >
         makeLightDigitalSurfaces
         ( CountedPtr<BinaryImage> bimage,
@@ -1128,7 +1137,9 @@ namespace DGtal
       /// components according to parameters.
       ///
       /// @param[out] surfel_reps a vector of surfels, one surfel per
-      /// digital surface component.
+      /// digital surface component. It is the smallest surfel of the
+      /// component, and the components are ordered by their smallest
+      /// surfels.
       ///
       /// @param[in] bimage a binary image representing the
       /// characteristic function of a digital shape.
@@ -1139,10 +1150,11 @@ namespace DGtal
       /// @param[in] params the parameters:
       ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - nbTriesToFindABel [  100000]: number of tries in method Surfaces::findABel
-      ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough component (> twice space width), "All": all components
+      ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"Largest"|"All", "AnyBig": any big-enough component (> twice space width), "Largest": the largest component, "All": all components
       ///
       /// @return a vector of smart pointers to the connected (light)
-      /// digital surfaces present in the binary image.
+      /// digital surfaces present in the binary image, ordered by their
+      /// smallest surfels.
       static std::vector< CountedPtr<LightDigitalSurface> >
         makeLightDigitalSurfaces
         ( SurfelRange&            surfel_reps,
@@ -1160,29 +1172,100 @@ namespace DGtal
           }	
         bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
         SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
-        // Extracts all boundary surfels
-        SurfelSet all_surfels;
-        Surfaces<KSpace>::sMakeBoundary( all_surfels, K, *bimage,
-                                         K.lowerBound(), K.upperBound() );
-        // Builds all connected components of surfels.
-        SurfelSet marked_surfels;
-        CountedPtr<LightDigitalSurface> ptrSurface;
-        for ( auto bel : all_surfels )
+        // Extracts all connected components of boundary surfels in one pass.
+        auto components = getSurfelComponents( bimage, K, params );
+        if ( component == "Largest" && components.size() > 1 )
+          components.resize( 1 );
+        // Each component is represented by its smallest surfel, and the
+        // components are ordered by their representatives.
+        SurfelRange bels;
+        for ( auto&& surfels : components )
+          bels.push_back( *std::min_element( surfels.begin(), surfels.end() ) );
+        std::sort( bels.begin(), bels.end() );
+        for ( auto&& bel : bels )
           {
-            if ( marked_surfels.count( bel ) != 0 ) continue;
             surfel_reps.push_back( bel );
             LightSurfaceContainer* surfContainer
               = new LightSurfaceContainer( K, *bimage, surfAdj, bel );
-            ptrSurface = CountedPtr<LightDigitalSurface>
-              ( new LightDigitalSurface( surfContainer ) ); // acquired
-            // mark all surfels of the surface component.
-            marked_surfels.insert( ptrSurface->begin(), ptrSurface->end() );
-            // add surface component to result.
-            result.push_back( ptrSurface );
+            result.push_back( CountedPtr<LightDigitalSurface>
+                              ( new LightDigitalSurface( surfContainer ) ) ); // acquired
           }
         return result;
       }
 
+      /// Returns all the connected components of the boundary of the
+      /// binary image \a bimage, each one as a range of surfels,
+      /// sorted by decreasing size (components of the same size are in
+      /// the order of the image scan). The image is scanned once and
+      /// the components are labelled with a union-find over the surfel
+      /// adjacency (see Surfaces::sMakeBoundaryComponents), so that the
+      /// result is deterministic and computed in almost linear time,
+      /// whatever the number of components.
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      ///
+      /// @param[in] K the Khalimsky space whose domain encompasses the
+      /// digital shape.
+      ///
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///
+      /// @return a vector of ranges of surfels, one per connected
+      /// component of the boundary, the largest first.
+      static std::vector< SurfelRange >
+        getSurfelComponents
+        ( CountedPtr<BinaryImage> bimage,
+          const KSpace&           K,
+          const Parameters&       params = parametersDigitalSurface() )
+      {
+        bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
+        SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
+        std::vector< SurfelRange > components;
+        Surfaces<KSpace>::sMakeBoundaryComponents( components, K, surfAdj, *bimage,
+                                                   K.lowerBound(), K.upperBound() );
+        std::stable_sort( components.begin(), components.end(),
+                          [] ( const SurfelRange& c1, const SurfelRange& c2 )
+                          { return c1.size() > c2.size(); } );
+        return components;
+      }
+
+      /// Creates an explicit digital surface representing the largest
+      /// connected component of the boundary of the binary image \a
+      /// bimage. Contrary to makeLightDigitalSurface, the component is
+      /// not searched by random tries, but by labelling all the
+      /// components in one pass (see getSurfelComponents).
+      ///
+      /// @param[in] bimage a binary image representing the
+      /// characteristic function of a digital shape.
+      ///
+      /// @param[in] K the Khalimsky space whose domain encompasses the
+      /// digital shape.
+      ///
+      /// @param[in] params the parameters:
+      ///   - surfelAdjacency   [       0]: specifies the surfel adjacency (1:ext, 0:int)
+      ///
+      /// @return a smart pointer on the explicit digital surface
+      /// representing the largest boundary component (empty if the
+      /// shape has no boundary).
+      static CountedPtr< DigitalSurface >
+        makeLargestDigitalSurface
+        ( CountedPtr<BinaryImage> bimage,
+          const KSpace&           K,
+          const Parameters&       params = parametersDigitalSurface() )
+      {
+        bool surfel_adjacency      = params[ "surfelAdjacency" ].as<int>();
+        SurfelAdjacency< KSpace::dimension > surfAdj( surfel_adjacency );
+        auto components = getSurfelComponents( bimage, K, params );
+        SurfelSet surfels;
+        if ( ! components.empty() )
+          surfels.insert( components[ 0 ].begin(), components[ 0 ].end() );
+        ExplicitSurfaceContainer* surfContainer
+          = new ExplicitSurfaceContainer( K, surfAdj, surfels );
+        return CountedPtr< DigitalSurface >
+          ( new DigitalSurface( surfContainer ) ); // acquired
+      }
+
     
       /// Creates a explicit digital surface representing the boundaries in
       /// the binary image \a bimage, or any one of its big components
@@ -1266,7 +1349,7 @@ namespace DGtal
       /// @param[in] params the parameters:
       ///   - surfelAdjacency   [     0]: specifies the surfel adjacency (1:ext, 0:int)
       ///   - nbTriesToFindABel [100000]: number of tries in method Surfaces::findABel
-      ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"All", "AnyBig": any big-enough component (> twice space width), "All": all components
+      ///   - surfaceComponents ["AnyBig"]: "AnyBig"|"Largest"|"All", "AnyBig": any big-enough component (> twice space width), "Largest": the largest component, "All": all components
       ///
       /// @return a smart pointer on the required indexed digital surface.
       static CountedPtr<IdxDigitalSurface>
@@ -1282,6 +1365,12 @@ namespace DGtal
             auto light_surface = makeLightDigitalSurface( bimage, K, params );
             surfels.insert( light_surface->begin(), light_surface->end() );
           }
+        else if ( component == "Largest" )
+          {
+            auto components = getSurfelComponents( bimage, K, params );
+            if ( ! components.empty() )
+              surfels.insert( components[ 0 ].begin(), components[ 0 ].end() );
+          }
         else if ( component == "All" )
           {
             Surfaces<KSpace>::sMakeBoundary( surfels, K, *bimage,
@@ -3238,9 +3327,9 @@ namespace DGtal
    * @param object the object of class 'Shortcuts' to write.
    * @return the output stream after the writing.
    */
-  template <typename T>
+  template <typename T, typename TBinaryImage>
     std::ostream&
-    operator<< ( std::ostream & out, const Shortcuts<T> & object );
+    operator<< ( std::ostream & out, const Shortcuts<T, TBinaryImage> & object );
 
 } // namespace DGtal
 
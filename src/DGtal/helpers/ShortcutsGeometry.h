@@ -71,14 +71,17 @@ namespace DGtal
    *
    * @tparam TKSpace any cellular grid space, a model of
    * concepts::CCellularGridSpaceND like KhalimskySpaceND.
+   *
+   * @tparam TBinaryImage the type of binary images (see Shortcuts).
    */
-  template  < typename TKSpace >
-    class ShortcutsGeometry : public Shortcuts< TKSpace >
+  template  < typename TKSpace,
+              typename TBinaryImage = ImageContainerBySTLVector< HyperRectDomain< typename TKSpace::Space >, bool > >
+    class ShortcutsGeometry : public Shortcuts< TKSpace, TBinaryImage >
     {
       BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
     public:
-      typedef Shortcuts< TKSpace >                     Base;
-      typedef ShortcutsGeometry< TKSpace >             Self;
+      typedef Shortcuts< TKSpace, TBinaryImage >       Base;
+      typedef ShortcutsGeometry< TKSpace, TBinaryImage > Self;
       using Base::parametersKSpace;
       using Base::getKSpace;
       using Base::parametersDigitizedImplicitShape3D;
@@ -117,7 +120,7 @@ namespace DGtal
       /// defines the digitization of an implicit shape.
       typedef GaussDigitizer< Space, ImplicitShape3D >     DigitizedImplicitShape3D;
       /// defines a black and white image with (hyper-)rectangular domain.
-      typedef ImageContainerBySTLVector<Domain, bool>      BinaryImage;
+      typedef TBinaryImage                                 BinaryImage;
       /// defines a grey-level image with (hyper-)rectangular domain.
       typedef ImageContainerBySTLVector<Domain, GrayScale> GrayScaleImage;
       /// defines a float image with (hyper-)rectangular domain.
@@ -641,6 +644,7 @@ namespace DGtal
       ///   - kernel          [ "hat"]: the kernel integration function chi_r, either "hat" or "ball". )
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - surfelEmbedding [     0]: the surfel -> point embedding for VCM estimator: 0: Pointels, 1: InnerSpel, 2: OuterSpel.
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       static Parameters parametersGeometryEstimation()
       {
         return Parameters
@@ -650,7 +654,8 @@ namespace DGtal
           ( "R-radius",       10.0 )
           ( "r-radius",        3.0 )
           ( "alpha",          0.33 )
-          ( "surfelEmbedding",   0 );
+          ( "surfelEmbedding",   0 )
+          ( "nb-threads",        1 );
       }
 
       /// Given a digital space \a K and a vector of \a surfels,
@@ -834,6 +839,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -869,6 +875,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -910,6 +917,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///
       /// @return the vector containing the estimated normals, in the
       /// same order as \a surfels.
@@ -938,6 +946,7 @@ namespace DGtal
           Scalar     h       = params[ "gridstep"  ].as<Scalar>();
           Scalar     r       = params[ "r-radius"  ].as<Scalar>();
           Scalar     alpha   = params[ "alpha"     ].as<Scalar>();
+          int        nbThreads = params[ "nb-threads" ].as<int>();
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -950,6 +959,7 @@ namespace DGtal
           IINormalEstimator   ii_estimator( functor );
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
+          ii_estimator.setNbThreads( nbThreads );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( n_estimations ) );
@@ -971,6 +981,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1002,6 +1013,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1041,6 +1053,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///
       /// @return the vector containing the estimated mean curvatures, in the
       /// same order as \a surfels.
@@ -1065,6 +1078,7 @@ namespace DGtal
           Scalar   h       = params[ "gridstep"  ].as<Scalar>();
           Scalar   r       = params[ "r-radius"  ].as<Scalar>();
           Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+          int    nbThreads = params[ "nb-threads" ].as<int>();
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -1077,6 +1091,7 @@ namespace DGtal
           IIMeanCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
+          ii_estimator.setNbThreads( nbThreads );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -1095,6 +1110,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1126,6 +1142,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1165,6 +1182,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1189,6 +1207,7 @@ namespace DGtal
           Scalar   h       = params[ "gridstep"  ].as<Scalar>();
           Scalar   r       = params[ "r-radius"  ].as<Scalar>();
           Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+          int    nbThreads = params[ "nb-threads" ].as<int>();
           if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
           if ( verbose > 0 )
             {
@@ -1201,6 +1220,7 @@ namespace DGtal
           IIGaussianCurvEstimator ii_estimator( functor );
           ii_estimator.attach( K, shape );
           ii_estimator.setParams( r );
+          ii_estimator.setNbThreads( nbThreads );
           ii_estimator.init( h, surfels.begin(), surfels.end() );
           ii_estimator.eval( surfels.begin(), surfels.end(),
                              std::back_inserter( mc_estimations ) );
@@ -1220,6 +1240,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///
       /// @return the vector containing the estimated Gaussian curvatures, in the
       /// same order as \a surfels.
@@ -1252,6 +1273,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///   - minAABB         [ -10.0]: the min value of the AABB bounding box (domain)
       ///   - maxAABB         [  10.0]: the max value of the AABB bounding box (domain)
       ///   - offset          [   5.0]: the digital dilation of the digital space,
@@ -1291,6 +1313,7 @@ namespace DGtal
       ///   - r-radius        [   3.0]: the constant for kernel radius parameter r in r(h)=r h^alpha (VCM,II,Trivial).
       ///   - alpha           [  0.33]: the parameter alpha in r(h)=r h^alpha (VCM, II)."
       ///   - gridstep        [   1.0]: the digitization gridstep (often denoted by h).
+      ///   - nb-threads      [     1]: the number of threads of the II estimators (0: all available threads, see ParallelFor).
       ///
       /// @return the vector containing the estimated principal curvatures and directions,
       ///  in the same order as \a surfels.
@@ -1314,6 +1337,7 @@ namespace DGtal
         Scalar   h       = params[ "gridstep"  ].as<Scalar>();
         Scalar   r       = params[ "r-radius"  ].as<Scalar>();
         Scalar   alpha   = params[ "alpha"     ].as<Scalar>();
+        int    nbThreads = params[ "nb-threads" ].as<int>();
         if ( alpha != 1.0 ) r *= pow( h, alpha-1.0 );
         if ( verbose > 0 )
         {
@@ -1326,6 +1350,7 @@ namespace DGtal
         IICurvEstimator ii_estimator( functor );
         ii_estimator.attach( K, shape );
         ii_estimator.setParams( r );
+        ii_estimator.setNbThreads( nbThreads );
         ii_estimator.init( h, surfels.begin(), surfels.end() );
         ii_estimator.eval( surfels.begin(), surfels.end(),
                           std::back_inserter( mc_estimations ) );
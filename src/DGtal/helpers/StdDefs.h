@@ -97,7 +97,7 @@ namespace DGtal
     typedef Space::RealPoint RealPoint;
     typedef Space::RealVector RealVector;
     typedef HyperRectDomain< Space > Domain; 
-    typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+    typedef DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > DigitalSet;
     typedef Object<DT4_8, DigitalSet> Object4_8;
     typedef Object<DT4_8, DigitalSet>::ComplementObject ComplementObject4_8;
     typedef Object<DT4_8, DigitalSet>::SmallObject SmallObject4_8;
@@ -170,7 +170,7 @@ namespace DGtal
     typedef Space::RealPoint RealPoint;
     typedef Space::RealVector RealVector;
     typedef HyperRectDomain< Space > Domain; 
-    typedef DigitalSetSelector< Domain, BIG_DS+HIGH_BEL_DS >::Type DigitalSet;
+    typedef DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > DigitalSet;
     typedef Object<DT6_18, DigitalSet> Object6_18;
     typedef Object<DT6_18, DigitalSet>::ComplementObject ComplementObject6_18;
     typedef Object<DT6_18, DigitalSet>::SmallObject SmallObject6_18;
@@ -0,0 +1,468 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BitPackedBinaryImage.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module BitPackedBinaryImage
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BitPackedBinaryImage_RECURSES)
+#error Recursive header files inclusion detected in BitPackedBinaryImage.h
+#else // defined(BitPackedBinaryImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BitPackedBinaryImage_RECURSES
+
+#if !defined BitPackedBinaryImage_h
+/** Prevents repeated inclusion of headers. */
+#define BitPackedBinaryImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BitPackedBinaryImage
+  /**
+   * Description of template class 'BitPackedBinaryImage' <p>
+   * \brief Aim: Model of concepts::CImage storing a binary image on a
+   * (hyper-)rectangular domain with one bit per point, 64 points per
+   * word along the first axis.
+   *
+   * Each row of the image (the points with the same coordinates but
+   * the first one) is stored in wordsPerRow() consecutive words, the
+   * last one being padded with zeros, and rows are stored in the
+   * lexicographic order of the domain. Contrary to
+   * ImageContainerBySTLVector<Domain,bool>, whose std::vector<bool>
+   * storage is only accessed bit by bit through proxies, this image
+   * provides services that process 64 points at once:
+   * - boolean operations between images (operator&=, operator|=,
+   *   operator^=) and complement (flip);
+   * - count of the points set to true (a population count per word);
+   * - extraction of the boundary points, i.e. the points set to true
+   *   with at least one of their 2*dimension direct neighbors set to
+   *   false or outside the domain (by shifting and combining words).
+   *
+   * It also provides begin() and end() iterators on its values in the
+   * order of the domain, as ImageContainerBySTLVector does, and
+   * conversions from and to ImageContainerBySTLVector. It can thus be
+   * used as the BinaryImage type of Shortcuts and ShortcutsGeometry.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   *
+   * @see testBitPackedBinaryImage.cpp
+   */
+  template <typename TDomain>
+  class BitPackedBinaryImage
+  {
+  public:
+    typedef BitPackedBinaryImage<TDomain> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = Domain::dimension;
+
+    /// range of values
+    typedef bool Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// The type of the words storing the values.
+    typedef std::uint64_t Word;
+    /// The number of values stored per word.
+    static const unsigned int wordBits = 64;
+
+    /// A reference on a bit of a word.
+    class BitReference
+    {
+    public:
+      /// Constructor.
+      /// @param word the referenced word.
+      /// @param mask the mask of the referenced bit.
+      BitReference( Word & word, Word mask ) : myWord( &word ), myMask( mask ) {}
+      /// @return the referenced value.
+      operator bool() const { return ( *myWord & myMask ) != 0; }
+      /// Sets the referenced value.
+      /// @param v any value.
+      /// @return a reference on 'this'.
+      BitReference & operator=( bool v )
+      {
+        if ( v ) *myWord |= myMask;
+        else     *myWord &= ~myMask;
+        return *this;
+      }
+      /// Sets the referenced value.
+      /// @param other any other reference.
+      /// @return a reference on 'this'.
+      BitReference & operator=( const BitReference & other )
+      { return *this = static_cast<bool>( other ); }
+    private:
+      Word * myWord; ///< The referenced word.
+      Word myMask;   ///< The mask of the referenced bit.
+    };
+
+    /// Iterator on the values of the image, in the order of the domain.
+    template <bool isConst>
+    class ScanIterator
+    {
+    public:
+      friend class BitPackedBinaryImage;
+      typedef std::forward_iterator_tag iterator_category;
+      typedef bool value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef void pointer;
+      typedef typename std::conditional< isConst, bool, BitReference >::type reference;
+      typedef typename std::conditional< isConst, const Word *, Word * >::type WordPointer;
+
+      /// Default constructor (singular iterator).
+      ScanIterator() : myWords( 0 ), myIndex( 0 ), myBit( 0 ), myX( 0 ), myWidth( 0 ) {}
+
+      /// @return the current value.
+      reference operator*() const
+      { return value( myWords[ myIndex ], Word( 1 ) << myBit ); }
+
+      /// Pre-increment operator.
+      /// @return a reference to itself.
+      ScanIterator & operator++()
+      {
+        if ( ++myX == myWidth )
+          { // next row starts with the next word.
+            myX = 0;
+            myBit = 0;
+            ++myIndex;
+          }
+        else if ( ++myBit == wordBits )
+          {
+            myBit = 0;
+            ++myIndex;
+          }
+        return *this;
+      }
+
+      /// Post-increment operator.
+      /// @return the iterator before incrementation.
+      ScanIterator operator++( int )
+      {
+        ScanIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      /// @param other any other iterator.
+      /// @return 'true' iff the iterators points on the same value.
+      bool operator==( const ScanIterator & other ) const
+      { return myIndex == other.myIndex && myBit == other.myBit; }
+
+      /// @param other any other iterator.
+      /// @return 'true' iff the iterators points on different values.
+      bool operator!=( const ScanIterator & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// Constructor. Internal. Used by BitPackedBinaryImage.
+      ScanIterator( WordPointer words, Size index, Size width )
+        : myWords( words ), myIndex( index ), myBit( 0 ), myX( 0 ), myWidth( width ) {}
+
+      /// @return the value of a bit of a constant word.
+      static bool value( const Word & word, Word mask )
+      { return ( word & mask ) != 0; }
+      /// @return a reference on a bit of a mutable word.
+      static BitReference value( Word & word, Word mask )
+      { return BitReference( word, mask ); }
+
+      WordPointer myWords; ///< The words of the image.
+      Size myIndex;        ///< The index of the current word.
+      unsigned int myBit;  ///< The current bit in the current word.
+      Size myX;            ///< The position of the current value in its row.
+      Size myWidth;        ///< The number of values of a row.
+    };
+
+    /// built-in iterators
+    typedef ScanIterator<false> Iterator;
+    typedef ScanIterator<true> ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. All the values are initialized to false.
+     * @param aDomain the image domain, a HyperRectDomain.
+     */
+    BitPackedBinaryImage( const Domain & aDomain );
+
+    /**
+     * Conversion from an image stored in a vector. The points whose
+     * values differ from TValue(0) are set to true.
+     *
+     * @tparam TValue the type of the values of @a image.
+     * @param image any image on the same type of domain.
+     */
+    template <typename TValue>
+    explicit BitPackedBinaryImage( const ImageContainerBySTLVector<Domain, TValue> & image );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    BitPackedBinaryImage( const BitPackedBinaryImage & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    BitPackedBinaryImage & operator=( const BitPackedBinaryImage & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~BitPackedBinaryImage() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the extent of the domain.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /// @return an iterator on the first value (in the order of the domain).
+    Iterator begin();
+    /// @return an iterator after the last value.
+    Iterator end();
+    /// @return a constant iterator on the first value (in the order of the domain).
+    ConstIterator begin() const;
+    /// @return a constant iterator after the last value.
+    ConstIterator end() const;
+
+    /**
+     * Copies the image into an image stored in a vector.
+     *
+     * @tparam TValue the type of the values of @a image.
+     * @param[out] image an image on the same domain.
+     * @param foreground the value of the points set to true.
+     * @param background the value of the points set to false.
+     */
+    template <typename TValue>
+    void copyTo( ImageContainerBySTLVector<Domain, TValue> & image,
+                 TValue foreground = TValue( 1 ),
+                 TValue background = TValue( 0 ) ) const;
+
+    // ----------------------- Word-level services ----------------------------
+  public:
+
+    /// @return the number of words storing a row of the image.
+    Size wordsPerRow() const;
+
+    /// @return the number of rows of the image.
+    Size nbRows() const;
+
+    /// @return the words storing the image (bits after the end of
+    /// each row must remain zero).
+    std::vector<Word> & words();
+
+    /// @return the words storing the image.
+    const std::vector<Word> & words() const;
+
+    /**
+     * Sets all the values of the image.
+     * @param aValue the value.
+     */
+    void fill( Value aValue );
+
+    /**
+     * Intersection: sets to false the points that are false in @a other.
+     * @pre both images have the same domain.
+     * @param other any other image.
+     * @return a reference on 'this'.
+     */
+    Self & operator&=( const Self & other );
+
+    /**
+     * Union: sets to true the points that are true in @a other.
+     * @pre both images have the same domain.
+     * @param other any other image.
+     * @return a reference on 'this'.
+     */
+    Self & operator|=( const Self & other );
+
+    /**
+     * Symmetric difference: flips the points that are true in @a other.
+     * @pre both images have the same domain.
+     * @param other any other image.
+     * @return a reference on 'this'.
+     */
+    Self & operator^=( const Self & other );
+
+    /**
+     * Complement: flips all the values of the image.
+     */
+    void flip();
+
+    /**
+     * @return the number of points set to true (the volume of the
+     * shape).
+     */
+    Size count() const;
+
+    /**
+     * @return the image of the boundary points, i.e. the points set to
+     * true with at least one of their 2*dimension direct neighbors that
+     * is false or outside the domain.
+     */
+    Self boundary() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image domain.
+    Domain myDomain;
+    /// The extent of the domain.
+    Vector myExtent;
+    /// The number of words per row.
+    Size myWordsPerRow;
+    /// The number of rows.
+    Size myNbRows;
+    /// The words storing the values, row by row.
+    std::vector<Word> myWords;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /**
+     * @param aPoint any point of the domain.
+     * @param[out] mask the mask of the bit of @a aPoint in its word.
+     * @return the index of the word storing the value of @a aPoint.
+     */
+    Size index( const Point & aPoint, Word & mask ) const;
+
+    /// @return the mask of the meaningful bits of the last word of a row.
+    Word lastWordMask() const;
+
+  }; // end of class BitPackedBinaryImage
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BitPackedBinaryImage'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BitPackedBinaryImage' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain>
+  std::ostream&
+  operator<< ( std::ostream & out, const BitPackedBinaryImage<TDomain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/BitPackedBinaryImage.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BitPackedBinaryImage_h
+
+#undef BitPackedBinaryImage_RECURSES
+#endif // else defined(BitPackedBinaryImage_RECURSES)
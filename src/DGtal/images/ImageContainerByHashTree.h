@@ -42,6 +42,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/ConstRangeAdapter.h"
@@ -317,6 +318,16 @@ namespace DGtal
      */
     Value get(const Point & aPoint) const;
 
+    /**
+     * Returns the values at an array of points. The keys of the
+     * points are computed by blocks with getKeys().
+     *
+     * @param points an array of @a nb points of the domain.
+     * @param nb the number of points.
+     * @param[out] values an array of @a nb values.
+     */
+    void getValues(const Point * points, const std::size_t nb, Value * values) const;
+
 
     /**
      * Returns the value corresponding to a key making the assumption
@@ -405,6 +416,16 @@ namespace DGtal
     //stuff that might be moved out of the class for reusability
     HashKey getKey(const Point & aPoint) const;
 
+    /**
+     * Computes the keys of an array of points at once (see
+     * Morton::interleaveBits).
+     *
+     * @param points an array of @a nb points of the domain.
+     * @param nb the number of points.
+     * @param[out] keys an array of @a nb keys.
+     */
+    void getKeys(const Point * points, const std::size_t nb, HashKey * keys) const;
+
     unsigned int getKeyDepth(HashKey key) const;
 
     int* getCoordinatesFromKey(HashKey key) const;
@@ -0,0 +1,661 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerBySparseBlocks.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerBySparseBlocks
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerBySparseBlocks_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerBySparseBlocks.h
+#else // defined(ImageContainerBySparseBlocks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerBySparseBlocks_RECURSES
+
+#if !defined ImageContainerBySparseBlocks_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerBySparseBlocks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerBySparseBlocks
+  /**
+   * Description of template class 'ImageContainerBySparseBlocks' <p>
+   * \brief Aim: Model of concepts::CImage storing a sparse image on a
+   * (hyper-)rectangular domain in a fixed-depth tree of dense blocks,
+   * in the spirit of OpenVDB grids.
+   *
+   * The domain is cut into leaf blocks of 2^TLog2LeafSize points per
+   * axis (8^3 points by default in 3D), grouped into internal nodes of
+   * 2^TLog2NodeSize leaf blocks per axis (16^3 leaves, i.e. 128^3
+   * points, by default). The tree has three levels:
+   * - the root, an OpenAddressingHashMap from the internal nodes
+   *   coordinates to the internal nodes, so that only the occupied
+   *   regions of the domain use memory;
+   * - the internal nodes, dense arrays of indices of leaves;
+   * - the leaves, dense arrays of values with a bit mask of the active
+   *   points.
+   *
+   * A point is @e active once a value has been set at this point with
+   * setValue() (even if this value is the background value), and
+   * inactive again after setValueOff(). Inactive points have the
+   * background value given at construction. Leaves are allocated on
+   * the first activation of one of their points, and are never freed
+   * before clear().
+   *
+   * Besides the services of concepts::CImage, the image provides:
+   * - cached accessors (Accessor and ConstAccessor) which remember
+   *   the last visited leaf and internal node, so that coherent
+   *   accesses (scans, neighborhoods) are done in constant time
+   *   without hash lookup;
+   * - iterators on the active points only (activeBegin(),
+   *   activeEnd()), which visit the leaves and skip the inactive
+   *   points 64 at a time with the bit masks;
+   * - bulk loads (setValues()) which allocate the missing leaves then
+   *   write the values leaf by leaf in parallel (see setNbThreads());
+   * - conversions from and to ImageContainerBySTLVector and digital
+   *   sets.
+   *
+   * @code
+   * typedef ImageContainerBySparseBlocks<Z3i::Domain, float> Image;
+   * Image image( domain, 0.0f );
+   * Image::Accessor acc = image.accessor();
+   * for ( auto p : region ) acc.setValue( p, f( p ) );
+   * for ( auto it = image.activeBegin(), itE = image.activeEnd(); it != itE; ++it )
+   *   trace.info() << (*it).first << " " << (*it).second << std::endl;
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue the type of the values, a model of concepts::CLabel.
+   * @tparam TLog2LeafSize the log2 of the size of the leaves along each axis.
+   * @tparam TLog2NodeSize the log2 of the number of leaves of the
+   * internal nodes along each axis.
+   *
+   * @see testImageContainerBySparseBlocks.cpp
+   */
+  template <typename TDomain, typename TValue,
+            unsigned int TLog2LeafSize = 3, unsigned int TLog2NodeSize = 4>
+  class ImageContainerBySparseBlocks
+  {
+  public:
+    typedef ImageContainerBySparseBlocks<TDomain, TValue, TLog2LeafSize, TLog2NodeSize> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = Domain::dimension;
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( concepts::CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// The type of the indices of the leaves and of the internal nodes.
+    typedef std::uint32_t Index;
+    /// The type of the words of the masks of active points.
+    typedef std::uint64_t Word;
+    /// The type of the linearized coordinates of the internal nodes.
+    typedef std::uint64_t NodeKey;
+
+    /// The log2 of the size of the leaves along each axis.
+    static const unsigned int leafLog2Size = TLog2LeafSize;
+    /// The log2 of the number of leaves of the internal nodes along each axis.
+    static const unsigned int nodeLog2Size = TLog2NodeSize;
+    /// The number of points of a leaf.
+    static const std::size_t leafVolume = std::size_t( 1 ) << ( TLog2LeafSize * Domain::dimension );
+    /// The number of leaves of an internal node.
+    static const std::size_t nodeVolume = std::size_t( 1 ) << ( TLog2NodeSize * Domain::dimension );
+    /// The number of words of the mask of active points of a leaf.
+    static const std::size_t maskWords = ( leafVolume + 63 ) / 64;
+    /// The index of missing leaves.
+    static const Index noIndex = std::numeric_limits<Index>::max();
+
+    BOOST_STATIC_ASSERT(( ( TLog2LeafSize + TLog2NodeSize ) * Domain::dimension < 32 ));
+
+    /// A leaf: a dense block of values.
+    struct Leaf
+    {
+      /// The point of the block with the lowest coordinates.
+      Point origin;
+      /// The values of the points of the block, x varying first.
+      std::array<Value, leafVolume> values;
+      /// The mask of the active points of the block.
+      std::array<Word, maskWords> active;
+    };
+
+    /**
+     * Accessor to the values of the image which caches the last
+     * visited leaf and internal node. Accesses to the points of these
+     * blocks take constant time without hash lookup.
+     *
+     * An accessor is invalidated by clear() and when the image is
+     * copied, moved or destroyed. Setting values with other accessors
+     * or with the image does not invalidate it.
+     *
+     * @tparam isConst when 'true', the accessor only reads the image.
+     */
+    template <bool isConst>
+    class CachedAccessor
+    {
+    public:
+      typedef typename std::conditional< isConst, const Self *, Self * >::type ImagePointer;
+
+      /// Constructor.
+      /// @param image the accessed image.
+      CachedAccessor( ImagePointer image );
+
+      /**
+       * @param aPoint any point of the domain.
+       * @return the value at @a aPoint.
+       */
+      Value operator()( const Point & aPoint );
+
+      /**
+       * @param aPoint any point of the domain.
+       * @return 'true' iff @a aPoint is active.
+       */
+      bool isActive( const Point & aPoint );
+
+      /**
+       * Sets a value at @a aPoint and activates it (non-const accessors only).
+       * @param aPoint any point of the domain.
+       * @param aValue the value.
+       */
+      void setValue( const Point & aPoint, const Value & aValue );
+
+      /**
+       * Deactivates @a aPoint and resets its value to the background
+       * value (non-const accessors only).
+       * @param aPoint any point of the domain.
+       */
+      void setValueOff( const Point & aPoint );
+
+      /**
+       * @param aPoint any point of the domain.
+       * @param[out] offset the position of @a aPoint in its leaf.
+       * @return the index of the leaf of @a aPoint, or noIndex if
+       * this leaf is not allocated.
+       */
+      Index findLeaf( const Point & aPoint, std::size_t & offset );
+
+      /**
+       * Allocates the leaf of @a aPoint if needed (non-const accessors only).
+       * @param aPoint any point of the domain.
+       * @param[out] offset the position of @a aPoint in its leaf.
+       * @return the index of the leaf of @a aPoint.
+       */
+      Index touchLeaf( const Point & aPoint, std::size_t & offset );
+
+    private:
+      /// @return 'true' iff @a aPoint is in the cached leaf, then sets @a offset.
+      bool inCachedLeaf( const Point & aPoint, std::size_t & offset ) const;
+      /// @return 'true' iff @a aPoint is in the cached internal node.
+      bool inCachedNode( const Point & aPoint ) const;
+
+      ImagePointer myImage; ///< The accessed image.
+      Index myLeaf;         ///< The cached leaf (or noIndex).
+      Point myLeafOrigin;   ///< The origin of the cached leaf.
+      Index myNode;         ///< The cached internal node (or noIndex).
+      Point myNodeOrigin;   ///< The origin of the cached internal node.
+    };
+
+    /// Read/write cached accessor.
+    typedef CachedAccessor<false> Accessor;
+    /// Read-only cached accessor.
+    typedef CachedAccessor<true> ConstAccessor;
+
+    /**
+     * Iterator on the active points of the image and their values,
+     * leaf by leaf in the order of allocation of the leaves, then in
+     * the order of the points in the leaves (x varying first).
+     */
+    class ActiveConstIterator
+    {
+    public:
+      friend class ImageContainerBySparseBlocks;
+      typedef std::forward_iterator_tag iterator_category;
+      typedef std::pair<Point, Value> value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef void pointer;
+      typedef value_type reference;
+
+      /// Default constructor (singular iterator).
+      ActiveConstIterator() : myImage( 0 ), myLeaf( 0 ), myOffset( 0 ) {}
+
+      /// @return the current active point and its value.
+      reference operator*() const { return value_type( point(), value() ); }
+
+      /// @return the current active point.
+      Point point() const;
+
+      /// @return the value of the current active point.
+      Value value() const
+      { return myImage->myLeaves[ myLeaf ].values[ myOffset ]; }
+
+      /// Pre-increment operator.
+      /// @return a reference to itself.
+      ActiveConstIterator & operator++()
+      {
+        ++myOffset;
+        skipInactive();
+        return *this;
+      }
+
+      /// Post-increment operator.
+      /// @return the iterator before incrementation.
+      ActiveConstIterator operator++( int )
+      {
+        ActiveConstIterator tmp( *this );
+        ++( *this );
+        return tmp;
+      }
+
+      /// @param other any other iterator.
+      /// @return 'true' iff the iterators points on the same value.
+      bool operator==( const ActiveConstIterator & other ) const
+      { return myLeaf == other.myLeaf && myOffset == other.myOffset; }
+
+      /// @param other any other iterator.
+      /// @return 'true' iff the iterators points on different values.
+      bool operator!=( const ActiveConstIterator & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      /// Constructor. Internal. Used by ImageContainerBySparseBlocks.
+      ActiveConstIterator( const Self * image, std::size_t leaf, std::size_t offset )
+        : myImage( image ), myLeaf( leaf ), myOffset( offset )
+      { skipInactive(); }
+
+      /// Moves to the first active point at or after the current position.
+      void skipInactive();
+
+      const Self * myImage;  ///< The image.
+      std::size_t myLeaf;    ///< The index of the current leaf.
+      std::size_t myOffset;  ///< The position of the current point in its leaf.
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. All the points are inactive.
+     * @param aDomain the image domain, a HyperRectDomain.
+     * @param aBackground the value of the inactive points.
+     * @throw std::runtime_error if the internal nodes of @a aDomain
+     * cannot be numbered with a NodeKey.
+     */
+    ImageContainerBySparseBlocks( const Domain & aDomain,
+                                  const Value & aBackground = NumberTraits<Value>::ZERO );
+
+    /**
+     * Conversion from an image stored in a vector. The points whose
+     * values differ from @a aBackground are activated. The blocks of
+     * the domain are scanned row by row in parallel.
+     *
+     * @param image any image on the same type of domain.
+     * @param aBackground the value of the inactive points.
+     * @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+     */
+    ImageContainerBySparseBlocks( const ImageContainerBySTLVector<Domain, Value> & image,
+                                  const Value & aBackground = NumberTraits<Value>::ZERO,
+                                  unsigned int nbThreads = 0 );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ImageContainerBySparseBlocks( const ImageContainerBySparseBlocks & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ImageContainerBySparseBlocks & operator=( const ImageContainerBySparseBlocks & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerBySparseBlocks() = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point,
+     * which becomes active.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * Deactivates a point and resets its value to the background value.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     */
+    void setValueOff( const Point & aPoint );
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return 'true' iff @a aPoint is active.
+     */
+    bool isActive( const Point & aPoint ) const;
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the extent of the domain.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the value of the inactive points.
+     */
+    const Value & background() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return a read/write cached accessor on the image, which must
+     * not be used after clear().
+     */
+    Accessor accessor();
+
+    /**
+     * @return a read-only cached accessor on the image, which must
+     * not be used after clear().
+     */
+    ConstAccessor constAccessor() const;
+
+    /// @return an iterator on the first active point.
+    ActiveConstIterator activeBegin() const;
+
+    /// @return an iterator after the last active point.
+    ActiveConstIterator activeEnd() const;
+
+    /**
+     * Sets the number of threads of the bulk loads and of the
+     * conversions.
+     * @param nbThreads the number of threads, 0 (default) for
+     * ParallelFor::nbThreads().
+     */
+    void setNbThreads( unsigned int nbThreads );
+
+    /// @return the number of threads of the bulk loads and of the
+    /// conversions (see setNbThreads).
+    unsigned int nbThreads() const;
+
+    /**
+     * Bulk load: sets the values of several points, which become
+     * active. The leaves of the points are looked up in parallel and
+     * the missing ones are allocated, then the points are grouped by
+     * leaf and the leaves are written in parallel. With a single
+     * thread, the points are simply set with a cached accessor. If a
+     * point is given several times, its last value is kept.
+     *
+     * @param points the points, in the domain.
+     * @param values the values of the points.
+     * @param nb the number of points.
+     */
+    void setValues( const Point * points, const Value * values, std::size_t nb );
+
+    /**
+     * Bulk load: sets the same value to several points, which become
+     * active (see setValues).
+     *
+     * @param points the points, in the domain.
+     * @param nb the number of points.
+     * @param aValue the value.
+     */
+    void setValues( const Point * points, std::size_t nb, const Value & aValue );
+
+    /**
+     * Bulk load: sets the same value to the points of a digital set,
+     * which become active (see setValues).
+     *
+     * @tparam TDigitalSet a model of concepts::CDigitalSet on the same space.
+     * @param aSet any digital set included in the domain.
+     * @param aValue the value.
+     */
+    template <typename TDigitalSet>
+    void setValues( const TDigitalSet & aSet, const Value & aValue );
+
+    /**
+     * Inserts the active points into a digital set.
+     *
+     * @tparam TDigitalSet a model of concepts::CDigitalSet on the same space.
+     * @param[in,out] aSet the digital set.
+     */
+    template <typename TDigitalSet>
+    void insertActivePoints( TDigitalSet & aSet ) const;
+
+    /**
+     * Copies the image into an image stored in a vector, the inactive
+     * points getting the background value.
+     *
+     * @param[out] image an image on the same domain.
+     */
+    void copyTo( ImageContainerBySTLVector<Domain, Value> & image ) const;
+
+    /**
+     * Deactivates all the points and frees the leaves. The accessors
+     * and the iterators on active points given before are invalidated.
+     */
+    void clear();
+
+    /// @return the number of active points.
+    Size nbActive() const;
+
+    /// @return the number of allocated leaves.
+    Size nbLeaves() const;
+
+    /// @return the number of allocated internal nodes.
+    Size nbNodes() const;
+
+    /// @return the leaves of the image.
+    const std::vector<Leaf> & leaves() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The image domain.
+    Domain myDomain;
+    /// The value of the inactive points.
+    Value myBackground;
+    /// The strides of the linearized coordinates of the internal nodes.
+    std::array<NodeKey, Domain::dimension> myNodeStrides;
+    /// The root: the index of the internal nodes given their linearized coordinates.
+    OpenAddressingHashMap<NodeKey, Index> myRoot;
+    /// The internal nodes: nodeVolume indices of leaves per node.
+    std::vector<Index> myNodes;
+    /// The leaves.
+    std::vector<Leaf> myLeaves;
+    /// The number of threads of the bulk loads (see setNbThreads).
+    unsigned int myNbThreads = 0;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /**
+     * @param aPoint any point of the domain.
+     * @return the point of the block of 2^log2Size points per axis
+     * containing @a aPoint with the lowest coordinates.
+     */
+    Point blockOrigin( const Point & aPoint, unsigned int log2Size ) const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the key of the internal node containing @a aPoint in the root.
+     */
+    NodeKey nodeKey( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @return the position of the leaf of @a aPoint in its internal node.
+     */
+    std::size_t leafInNode( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint any point of the domain.
+     * @param origin the origin of the leaf containing @a aPoint.
+     * @return the position of @a aPoint in its leaf.
+     */
+    static std::size_t offsetInLeaf( const Point & aPoint, const Point & origin );
+
+    /**
+     * @param aPoint any point of the domain.
+     * @param create when 'true', allocates the internal node if missing.
+     * @return the index of the internal node containing @a aPoint, or
+     * noIndex.
+     */
+    Index findNode( const Point & aPoint, bool create );
+
+    /// @return the index of the internal node containing @a aPoint, or noIndex.
+    Index findNode( const Point & aPoint ) const;
+
+    /**
+     * @param node an internal node.
+     * @param aPoint any point of the node.
+     * @return the index of the leaf of @a aPoint, allocated if needed.
+     */
+    Index touchLeaf( Index node, const Point & aPoint );
+
+    /**
+     * Bulk load of the values given by a functor.
+     * @param points the points.
+     * @param nb the number of points.
+     * @param valueOf a functor giving the value of the i-th point.
+     */
+    template <typename TValueOf>
+    void bulkSetValues( const Point * points, std::size_t nb, const TValueOf & valueOf );
+
+  }; // end of class ImageContainerBySparseBlocks
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerBySparseBlocks'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerBySparseBlocks' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int TLog2LeafSize, unsigned int TLog2NodeSize>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerBySparseBlocks<TDomain, TValue, TLog2LeafSize, TLog2NodeSize> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerBySparseBlocks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerBySparseBlocks_h
+
+#undef ImageContainerBySparseBlocks_RECURSES
+#endif // else defined(ImageContainerBySparseBlocks_RECURSES)
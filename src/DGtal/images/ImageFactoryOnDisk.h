@@ -0,0 +1,265 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageFactoryOnDisk.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageFactoryOnDisk.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageFactoryOnDisk_RECURSES)
+#error Recursive header files inclusion detected in ImageFactoryOnDisk.h
+#else // defined(ImageFactoryOnDisk_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageFactoryOnDisk_RECURSES
+
+#if !defined ImageFactoryOnDisk_h
+/** Prevents repeated inclusion of headers. */
+#define ImageFactoryOnDisk_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <set>
+#include <cstddef>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImage.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /////////////////////////////////////////////////////////////////////////////
+  // Template class ImageFactoryOnDisk
+  /**
+   * Description of template class 'ImageFactoryOnDisk' <p>
+   * \brief Aim: implements a factory of images backed by raw files on
+   * the local disk, so that a TiledImage larger than the available
+   * memory can be built and modified.
+   *
+   * Each requested domain (a tile of the TiledImage) is stored in its
+   * own file, named after @a aFilePrefix and the lower bound of the
+   * domain. The first time a domain is requested, the image is filled
+   * with a default value. When the image cache flushes an image, its
+   * values are written to the file of its domain, and read back the
+   * next time this domain is requested. Files are removed when the
+   * factory is destroyed.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> Tile;
+   * typedef ImageFactoryOnDisk<Tile> Factory;
+   * typedef ImageCacheReadPolicyFIFO<Tile, Factory> ReadPolicy;
+   * typedef ImageCacheWritePolicyWB<Tile, Factory> WritePolicy;
+   *
+   * Factory factory( domain, "/tmp/tiles" );
+   * const auto N = Factory::tilesPerDimension( domain, memoryBudget );
+   * ReadPolicy readPolicy( factory, Factory::tilesPerColumn( domain, N ) );
+   * WritePolicy writePolicy( factory );
+   * TiledImage<Tile, Factory, ReadPolicy, WritePolicy> image( factory, readPolicy, writePolicy, N );
+   * @endcode
+   *
+   * @tparam TImageContainer an image container type (model of
+   * CImage) on an HyperRectDomain. Values are read and written as
+   * their memory representation, so they must be plain data (numbers,
+   * PointVector, ...).
+   *
+   * @see TiledImage, ImageCache, ImageFactoryFromImage
+   */
+  template <typename TImageContainer>
+  class ImageFactoryOnDisk
+  {
+
+    // ----------------------- Types ------------------------------
+
+  public:
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( concepts::CImage<TImageContainer> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Point Point;
+    typedef typename ImageContainer::Value Value;
+
+    ///New types
+    typedef ImageContainer OutputImage;
+
+    // ----------------------- Standard services ------------------------------
+
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the domain of the whole (tiled) image.
+     * @param aFilePrefix prefix of the tile file names (e.g. a
+     * path in an existing directory).
+     * @param aDefaultValue value of the images at their first request.
+     */
+    ImageFactoryOnDisk( const Domain & aDomain,
+                        const std::string & aFilePrefix,
+                        const Value & aDefaultValue = Value() );
+
+    /**
+     * Destructor. Removes the tile files and deletes the images that
+     * have not been detached.
+     */
+    ~ImageFactoryOnDisk();
+
+  private:
+
+    ImageFactoryOnDisk( const ImageFactoryOnDisk & other );
+
+    ImageFactoryOnDisk & operator=( const ImageFactoryOnDisk & other );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * @return the domain of the whole image.
+     */
+    const Domain & domain() const
+    {
+      return myDomain;
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return true;
+    }
+
+    /**
+     * Returns a pointer on an OutputImage on @a aDomain, read from
+     * its file if it has already been flushed.
+     *
+     * @param aDomain the domain.
+     * @return an OutputImage pointer.
+     * @throw IOException if the file cannot be read.
+     */
+    OutputImage * requestImage( const Domain & aDomain );
+
+    /**
+     * Writes the values of @a outputImage to the file of its domain.
+     *
+     * @param outputImage the image.
+     * @throw IOException if the file cannot be written.
+     */
+    void flushImage( OutputImage * outputImage );
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     *
+     * @param outputImage the image.
+     */
+    void detachImage( OutputImage * outputImage );
+
+    /**
+     * Number of tiles per dimension (the parameter N of TiledImage)
+     * such that a column of tiles along any axis, plus the buffer used
+     * to transfer a tile from or to its file, fits in @a aMemoryBudget
+     * bytes.
+     *
+     * @param aDomain the domain of the whole image.
+     * @param aMemoryBudget the memory budget in bytes.
+     * @return the smallest admissible number of tiles per dimension
+     * (the number of points along the smallest side of the domain if
+     * the budget cannot be met).
+     */
+    static typename Domain::Integer tilesPerDimension( const Domain & aDomain,
+                                                       std::size_t aMemoryBudget );
+
+    /**
+     * Maximal number of tiles of a TiledImage crossed by a line
+     * parallel to an axis, i.e. the cache size required to process a
+     * column of tiles without reloading them.
+     *
+     * @param aDomain the domain of the whole image.
+     * @param N the number of tiles per dimension of the TiledImage.
+     * @return the number of tiles in the longest column.
+     */
+    static unsigned int tilesPerColumn( const Domain & aDomain,
+                                        typename Domain::Integer N );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * @param aDomain a domain.
+     * @return the name of the file of the domain @a aDomain.
+     */
+    std::string fileName( const Domain & aDomain ) const;
+
+    ///Domain of the whole image
+    Domain myDomain;
+
+    ///Prefix of the tile files
+    std::string myFilePrefix;
+
+    ///Value of the images at their first request
+    Value myDefaultValue;
+
+    ///Lower bounds of the tiles stored on disk
+    std::set<Point> myStoredTiles;
+
+    ///Images requested and not detached yet
+    std::set<OutputImage *> myImages;
+
+  }; // end of class ImageFactoryOnDisk
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageFactoryOnDisk'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageFactoryOnDisk' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImageContainer>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageFactoryOnDisk<TImageContainer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageFactoryOnDisk.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageFactoryOnDisk_h
+
+#undef ImageFactoryOnDisk_RECURSES
+#endif // else defined(ImageFactoryOnDisk_RECURSES)
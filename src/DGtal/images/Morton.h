@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cstddef>
 #include <boost/array.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
@@ -54,6 +55,95 @@
 namespace DGtal
 {
 
+  /////////////////////////////////////////////////////////////////////////////
+  // struct MortonCodec
+  /**
+   * Description of struct 'MortonCodec' <p>
+   * @brief Aim: constant time Morton encoding and decoding of 2D and
+   * 3D unsigned coordinates into 64 bits words.
+   *
+   * Coordinates have 32 bits in 2D and 21 bits in 3D: bit i of
+   * coordinate n is bit (i*dimension+n) of the code. Several methods
+   * are provided:
+   * - MAGIC_BITS: bits are spread (and compacted) with shifts and
+   *   masks, in log(bits) steps;
+   * - LOOKUP_TABLE: bytes (resp. 8 or 9 bits words of codes) are
+   *   spread (resp. compacted) with precomputed tables;
+   * - BMI2: bits are spread (resp. compacted) with the PDEP (resp.
+   *   PEXT) instructions of x86-64 processors. It is only available
+   *   when the processor supports them, which is detected at runtime
+   *   (see hasBMI2()).
+   *
+   * bestMethod() returns BMI2 when it is available, MAGIC_BITS
+   * otherwise.
+   *
+   * @see Morton
+   */
+  struct MortonCodec
+  {
+    /// Morton encoding methods.
+    enum Method { MAGIC_BITS, LOOKUP_TABLE, BMI2 };
+
+    /// @return true if the processor supports the BMI2 instructions.
+    static bool hasBMI2();
+
+    /// @return the fastest available method (BMI2 if available).
+    static Method bestMethod();
+
+    /**
+     * @param x first coordinate (32 bits).
+     * @param y second coordinate (32 bits).
+     * @param method the encoding method (BMI2 must be available).
+     * @return the Morton code of (x,y).
+     */
+    static DGtal::uint64_t encode2( DGtal::uint64_t x, DGtal::uint64_t y, Method method );
+
+    /**
+     * @param x first coordinate (21 bits).
+     * @param y second coordinate (21 bits).
+     * @param z third coordinate (21 bits).
+     * @param method the encoding method (BMI2 must be available).
+     * @return the Morton code of (x,y,z).
+     */
+    static DGtal::uint64_t encode3( DGtal::uint64_t x, DGtal::uint64_t y, DGtal::uint64_t z, Method method );
+
+    /**
+     * @param code a 2D Morton code.
+     * @param[out] x first coordinate.
+     * @param[out] y second coordinate.
+     * @param method the decoding method (BMI2 must be available).
+     */
+    static void decode2( DGtal::uint64_t code, DGtal::uint64_t & x, DGtal::uint64_t & y, Method method );
+
+    /**
+     * @param code a 3D Morton code (63 bits).
+     * @param[out] x first coordinate.
+     * @param[out] y second coordinate.
+     * @param[out] z third coordinate.
+     * @param method the decoding method (BMI2 must be available).
+     */
+    static void decode3( DGtal::uint64_t code, DGtal::uint64_t & x, DGtal::uint64_t & y, DGtal::uint64_t & z, Method method );
+
+    /// @return x with a 0 inserted after each of its 32 lowest bits.
+    static DGtal::uint64_t spreadBy1( DGtal::uint64_t x );
+    /// @return x with two 0s inserted after each of its 21 lowest bits.
+    static DGtal::uint64_t spreadBy2( DGtal::uint64_t x );
+    /// @return the bits 0, 2, 4... of x packed in the lowest bits (inverse of spreadBy1).
+    static DGtal::uint64_t compactBy1( DGtal::uint64_t x );
+    /// @return the bits 0, 3, 6... of x packed in the lowest bits (inverse of spreadBy2).
+    static DGtal::uint64_t compactBy2( DGtal::uint64_t x );
+
+  private:
+    /// @return the table of spreadBy1 of the 256 bytes.
+    static const DGtal::uint64_t * spreadBy1Table();
+    /// @return the table of spreadBy2 of the 256 bytes.
+    static const DGtal::uint64_t * spreadBy2Table();
+    /// @return the table of the (x,y) nibbles (x | y << 4) of the 256 8-bits 2D codes.
+    static const DGtal::uint8_t * compact2Table();
+    /// @return the table of the (x,y,z) 3-bits words (x | y << 3 | z << 6) of the 512 9-bits 3D codes.
+    static const DGtal::uint16_t * compact3Table();
+  };
+
   /////////////////////////////////////////////////////////////////////////////
   // template class Morton
   /**
@@ -67,6 +157,12 @@ namespace DGtal
    * Main methods in this class are keyFromCoordinates to generate a
    * key and CoordinatesFromKey to generate a point from a code.
    *
+   * In 2D and 3D with keys of at most 64 bits, codes are computed in
+   * constant time by MortonCodec, with the fastest method available on
+   * the processor (see setMethod()). Otherwise, bits are interleaved
+   * one by one. Whole arrays of points (or keys) can be processed at
+   * once, the method being selected once per array.
+   *
    * @tparam THashKey type to store the morton code (should have
    * enough capacity to store the interleaved binary word).
    * @tparam TPoint type of points. 
@@ -87,11 +183,26 @@ namespace DGtal
 
     BOOST_STATIC_CONSTANT(Dimension, dimension = TPoint::dimension);
 
+    /// true if codes are computed by MortonCodec.
+    BOOST_STATIC_CONSTANT(bool, hasCodec = ( dimension == 2 || dimension == 3 ) && sizeof( HashKey ) <= 8 );
+
     /**
-     * Constructor
+     * Constructor. The method of MortonCodec is
+     * MortonCodec::bestMethod().
      *
      */
     Morton();
+
+    /**
+     * Sets the method used to compute codes (when hasCodec is true).
+     * When BMI2 is requested but not available, the method is
+     * MortonCodec::bestMethod() instead.
+     * @param method a method.
+     */
+    void setMethod( MortonCodec::Method method );
+
+    /// @return the method used to compute codes (when hasCodec is true).
+    MortonCodec::Method method() const;
     
     /**
      * Interleave the bits of the nbIn inputs.
@@ -100,6 +211,14 @@ namespace DGtal
      */ 
     void interleaveBits(const Point  & aPoint, HashKey & output) const;
 
+    /**
+     * Interleave the bits of an array of points.
+     * @param points an array of @a nb points.
+     * @param nb the number of points.
+     * @param[out] output an array of @a nb keys.
+     */
+    void interleaveBits(const Point * points, const std::size_t nb, HashKey * output) const;
+
 
     /**
      * Returns the key corresponding to the coordinates passed in the parameters.
@@ -112,6 +231,18 @@ namespace DGtal
      */
     HashKey keyFromCoordinates(const std::size_t treeDepth, const Point & coordinates) const;
 
+    /**
+     * Computes the keys of an array of points.
+     *
+     * @param treeDepth The depth at which the coordinates are to be
+     * read (usualy corresponds to the deepest leave).
+     * @param points an array of @a nb points.
+     * @param nb the number of points.
+     * @param[out] keys an array of @a nb keys.
+     */
+    void keysFromCoordinates(const std::size_t treeDepth, const Point * points,
+                             const std::size_t nb, HashKey * keys) const;
+
     /**
      * Computes the coordinates correspponding to a key.
      *
@@ -120,6 +251,15 @@ namespace DGtal
      */
     void coordinatesFromKey(const HashKey key, Point & coordinates) const;
 
+    /**
+     * Computes the coordinates corresponding to an array of keys.
+     *
+     * @param keys an array of @a nb keys.
+     * @param nb the number of keys.
+     * @param[out] coordinates an array of @a nb points.
+     */
+    void coordinatesFromKeys(const HashKey * keys, const std::size_t nb, Point * coordinates) const;
+
     /**
      * Returns the parent key of a key passed in parameter.
      *
@@ -149,10 +289,34 @@ namespace DGtal
     void childrenKeys(const HashKey key, HashKey* result ) const;
     
   private: 
-    
-    ///@todo Implements dilateMasks
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myDilateMasks;
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myContractMasks;
+
+    /// number of bits of each coordinate in a key.
+    BOOST_STATIC_CONSTANT(unsigned int, coordSize = ( sizeof( HashKey ) * 8 ) / dimension );
+
+    /**
+     * @param key a key.
+     * @return the key without its most significant bit equal to 1.
+     */
+    static HashKey removeDepthBit( HashKey key );
+
+    /**
+     * Interleave the bits of a point with the method @a aMethod of MortonCodec.
+     * @param aPoint a point.
+     * @param aMethod a method of MortonCodec.
+     * @return the interleaved bits.
+     */
+    static HashKey encode( const Point & aPoint, const MortonCodec::Method aMethod );
+
+    /**
+     * Deinterleave the bits of a code with the method @a aMethod of MortonCodec.
+     * @param code a code without depth bit.
+     * @param aMethod a method of MortonCodec.
+     * @param[out] coordinates the point.
+     */
+    static void decode( const HashKey code, const MortonCodec::Method aMethod, Point & coordinates );
+
+    /// Method of MortonCodec used to compute codes.
+    MortonCodec::Method myMethod;
   };
 } // namespace DGtal
 
@@ -46,6 +46,7 @@
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 
 #include "DGtal/math/AngleLinearMinimizer.h"
 #include "DGtal/geometry/curves/ArithmeticalDSS.h"
@@ -219,6 +220,12 @@ static void draw( DGtal::Board2D & board, const DGtal::DigitalSetByAssociativeCo
 template<typename Domain>
 static void draw( DGtal::Board2D & board, const DGtal::DigitalSetBySTLVector<Domain> & );
 // DigitalSetBySTLVector
+
+
+// DigitalSetByBitset
+template<typename Domain>
+static void draw( DGtal::Board2D & board, const DGtal::DigitalSetByBitset<Domain> & );
+// DigitalSetByBitset
     
     
 // FP
@@ -70,6 +70,7 @@
 #include "DGtal/dec/DiscreteExteriorCalculus.h"
 
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 
 //
 //////////////////////////////////////////////////////////////////////////////
@@ -276,6 +277,41 @@ namespace DGtal
     static void draw( Display & display, const DGtal::DigitalSetByAssociativeContainer<Domain, Container> & anObject );
     // DigitalSetByAssociativeContainer
 
+
+    // DigitalSetByBitset
+    /**
+     * @brief drawAsPavingTransparent
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain>
+    static void drawAsPavingTransparent( Display & display, const DGtal::DigitalSetByBitset<Domain> & anObject );
+
+    /**
+     * @brief drawAsPaving
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain>
+    static void drawAsPaving( Display & display, const DGtal::DigitalSetByBitset<Domain> & anObject );
+
+    /**
+     * @brief drawAsGrid
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain>
+    static void drawAsGrid( Display & display, const DGtal::DigitalSetByBitset<Domain> & anObject );
+
+    /**
+     * @brief draw
+     * @param display the display where to draw
+     * @param anObject the object to draw
+     */
+    template<typename Domain>
+    static void draw( Display & display, const DGtal::DigitalSetByBitset<Domain> & anObject );
+    // DigitalSetByBitset
+
     
     // DigitalSetBySTLSet
     /**
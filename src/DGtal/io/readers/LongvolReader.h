@@ -67,6 +67,10 @@ namespace DGtal
    * The private methods have been backported from the Simplelvol project
    * (see http://liris.cnrs.fr/david.coeurjolly).
    *
+   * As for VolReader, the payload is streamed by VolPayloadReader
+   * and written directly into the storage of ImageContainerBySTLVector
+   * images.
+   *
    * Example usage:
    * @code
    * ...
@@ -118,30 +122,6 @@ namespace DGtal
     
   private:
     
-    /**
-     * Generic read word (binary mode) in little-endian mode.
-     *
-     * @param fin input stream.
-     * @param aValue value to write.
-     *
-     * @return modified stream.
-     */
-    template <typename Word>
-    static
-    std::stringstream& read_word( std::stringstream & fin, Word& aValue )
-    {
-      aValue = 0;
-      char c;
-      for (unsigned int size = 0; size < sizeof( Word ); ++size)
-      {
-        fin.get( c ) ;
-        unsigned char cc=static_cast<unsigned char>(c);
-        aValue |= (cc << (8 * size));
-      }
-      return fin;
-    }
-    
-    
     typedef unsigned char voxel;
     /** This class help us to associate a field type and his value.
      * An object is a pair (type, value). You can copy and assign
@@ -172,7 +172,9 @@ namespace DGtal
   }; // end of class RawReader
 
   /**
-   * Generic read word (binary mode) in little-endian mode.
+   * Generic read word (binary mode). Integral words are decoded in
+   * little-endian order whatever the host, other words are read as
+   * their memory representation (see VolPayloadWriter).
    *
    * @param fin input FILE.
    * @param aValue value to write.
@@ -0,0 +1,239 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VolPayloadReader.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module VolPayloadReader.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VolPayloadReader_RECURSES)
+#error Recursive header files inclusion detected in VolPayloadReader.h
+#else // defined(VolPayloadReader_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VolPayloadReader_RECURSES
+
+#if !defined VolPayloadReader_h
+/** Prevents repeated inclusion of headers. */
+#define VolPayloadReader_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstdio>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class ScanOrderImageWriter
+    /**
+     * Description of template class 'ScanOrderImageWriter' <p>
+     * \brief Aim: Small helper that writes consecutive values into an
+     * image following the scan order of its domain.
+     *
+     * The generic version walks the domain with its ConstIterator and
+     * calls setValue() for each value. A specialization for
+     * ImageContainerBySTLVector writes directly into the underlying
+     * storage, whose layout matches the domain scan order, so that
+     * the functor pass is a plain std::transform.
+     *
+     * @tparam TImage any model of concepts::CImage.
+     */
+    template <typename TImage>
+    struct ScanOrderImageWriter
+    {
+      typedef typename TImage::Domain::ConstIterator ConstIterator;
+
+      /**
+       * Constructor.
+       * @param anImage the image to fill (aliased).
+       */
+      ScanOrderImageWriter( TImage & anImage )
+        : myImage( anImage ), myIt( anImage.domain().begin() )
+      {}
+
+      /**
+       * Writes the values of the range [first,last) transformed by
+       * @a aFunctor at the next positions of the scan.
+       *
+       * @param first an iterator on the first value.
+       * @param last an iterator past the last value.
+       * @param aFunctor the functor applied to each value.
+       */
+      template <typename TInputIterator, typename TFunctor>
+      void write( TInputIterator first, TInputIterator last,
+                  const TFunctor & aFunctor )
+      {
+        for ( ; first != last; ++first, ++myIt )
+          myImage.setValue( *myIt, aFunctor( *first ) );
+      }
+
+      /// The filled image.
+      TImage & myImage;
+      /// The current position in the domain.
+      ConstIterator myIt;
+    };
+
+    /**
+     * Specialization of ScanOrderImageWriter for ImageContainerBySTLVector.
+     */
+    template <typename TDomain, typename TValue>
+    struct ScanOrderImageWriter< ImageContainerBySTLVector<TDomain, TValue> >
+    {
+      typedef ImageContainerBySTLVector<TDomain, TValue> Image;
+      typedef typename Image::Iterator Iterator;
+
+      ScanOrderImageWriter( Image & anImage )
+        : myIt( anImage.begin() )
+      {}
+
+      template <typename TInputIterator, typename TFunctor>
+      void write( TInputIterator first, TInputIterator last,
+                  const TFunctor & aFunctor )
+      {
+        myIt = std::transform( first, last, myIt,
+                               [&aFunctor] ( typename std::iterator_traits<TInputIterator>::value_type v )
+                               { return aFunctor( v ); } );
+      }
+
+      /// The current position in the image storage.
+      Iterator myIt;
+    };
+
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class VolPayloadReader
+  /**
+   * Description of class 'VolPayloadReader' <p>
+   * \brief Aim: reads the binary payload of a vol or longvol file
+   * (everything after the header) in large chunks and hands it out
+   * to a consumer.
+   *
+   * Uncompressed payloads (Version 2) are read with bulk fread()
+   * calls. Compressed payloads (Version 3, zlib stream as produced by
+   * VolWriter or LongvolWriter) are inflated chunk by chunk, so that
+   * neither the compressed nor the uncompressed payload is ever held
+   * entirely in memory.
+   *
+   * The consumer must provide an
+   * <code>operator()( const unsigned char * data, std::size_t n )</code>
+   * which is called with consecutive pieces of the payload. Pieces
+   * have arbitrary sizes, in particular they are not aligned on
+   * multi-byte words.
+   *
+   * @see VolReader, LongvolReader
+   */
+  struct VolPayloadReader
+  {
+    /// Size in bytes of the buffers used for reading and inflating.
+    static const std::size_t chunkSize = 1 << 20;
+
+    /**
+     * Reads @a nbBytes bytes of payload from the current position of
+     * @a fin.
+     *
+     * @param fin an opened file, positioned at the start of the payload.
+     * @param nbBytes the number of (uncompressed) bytes expected.
+     * @param compressed if true, the payload is a zlib stream.
+     * @param aConsumer the consumer of the payload bytes.
+     *
+     * @throw IOException if the file is truncated or the zlib stream
+     * is corrupted.
+     */
+    template <typename TConsumer>
+    static void read( FILE * fin, std::size_t nbBytes, bool compressed,
+                      TConsumer & aConsumer );
+
+    /**
+     * Consumer of payload bytes that decodes little-endian words of
+     * type @a TWord and writes them, through a functor, in an image
+     * following the domain scan order.
+     *
+     * @tparam TImage any model of concepts::CImage.
+     * @tparam TWord an unsigned integer type.
+     * @tparam TFunctor the functor type applied to each decoded word.
+     */
+    template <typename TImage, typename TWord, typename TFunctor>
+    struct ImageFiller
+    {
+      /**
+       * Constructor.
+       * @param anImage the image to fill.
+       * @param aFunctor the functor applied to each word (aliased).
+       */
+      ImageFiller( TImage & anImage, const TFunctor & aFunctor );
+
+      /**
+       * Decodes the bytes [data, data+n) and writes the complete words
+       * into the image. Trailing bytes of an incomplete word are kept
+       * for the next call.
+       *
+       * @param data a pointer on the bytes.
+       * @param n the number of bytes.
+       */
+      void operator()( const unsigned char * data, std::size_t n );
+
+      /// Single byte words: values are written without decoding.
+      void write( const unsigned char * data, std::size_t n, std::true_type );
+      /// Multi-byte words: little-endian decoding.
+      void write( const unsigned char * data, std::size_t n, std::false_type );
+
+      /// Writer of values in the image.
+      detail::ScanOrderImageWriter<TImage> myWriter;
+      /// Functor applied to words.
+      const TFunctor & myFunctor;
+      /// Decoded words buffer.
+      std::vector<TWord> myWords;
+      /// Bytes of an incomplete word.
+      unsigned char myCarry[ sizeof( TWord ) ];
+      /// Number of bytes in myCarry.
+      std::size_t myNbCarry;
+    };
+
+  }; // end of struct VolPayloadReader
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/readers/VolPayloadReader.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VolPayloadReader_h
+
+#undef VolPayloadReader_RECURSES
+#endif // else defined(VolPayloadReader_RECURSES)
@@ -63,6 +63,11 @@ namespace DGtal
    * The private methods have been backported from the SimpleVol project 
    * (see http://liris.cnrs.fr/david.coeurjolly).
    *
+   * The voxel payload is read in large chunks (and inflated chunk by
+   * chunk for compressed files) by VolPayloadReader. When the image
+   * container is an ImageContainerBySTLVector, values are written
+   * directly into its storage instead of through setValue().
+   *
    * Example usage:
    * @code
    * ...
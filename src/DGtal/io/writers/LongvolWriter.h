@@ -60,6 +60,9 @@ namespace DGtal
    * A functor can be specified to convert image values to LongVol values
    * (DGtal::uint64_t).
    *
+   * As for VolWriter, the payload is written slab by slab by
+   * VolPayloadWriter, with a selectable zlib compression level.
+   *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
    *
@@ -86,31 +89,16 @@ namespace DGtal
      * @param aImage the image to export
      * @param compressed boolean to decide wether the vol must be compressed or not
      * @param aFunctor functor used to cast image values
+     * @param compressionLevel zlib compression level, from 0 (no
+     * compression) to 9 (best compression), -1 for the zlib default
+     * (only used if @a compressed is true)
      * @return true if no errors occur.
      */
     static bool exportLongvol(const std::string & filename, const Image &aImage,
                               const bool compressed = true,
-                              const Functor & aFunctor = Functor());
-    
+                              const Functor & aFunctor = Functor(),
+                              const int compressionLevel = -1);
     
-  private: 
-    
-    /** 
-     * Generic write word (binary mode) in little-endian.
-     * 
-     * @param outs output stream.
-     * @param value value to write.
-     * 
-     * @return modified stream.
-     */
-    template <typename Word>
-    static
-    std::ostream& write_word( std::ostream& outs, Word value )
-    {
-      for (unsigned size = sizeof( Word ); size; --size, value >>= 8)
-        outs.put( static_cast <char> (value & 0xFF) );
-      return outs;
-    }
     
   };
 }//namespace
@@ -65,6 +65,9 @@ namespace DGtal
    *
    * A functor can be specified to convert image values to raw values
    * (e.g. unsigned char for \c exportRaw8).
+   *
+   * Values are serialized slab by slab (along the last axis of the
+   * domain) by VolPayloadWriter and written with bulk writes.
    * 
    * Example usage:
    * @code
@@ -157,17 +160,6 @@ namespace DGtal
 
   };
 
-  /**
-   * Generic write word (binary mode) in little-endian.
-   *
-   * @param outs output stream.
-   * @param value value to write.
-   *
-   * @return modified stream.
-   */
-  template <typename Word>
-  std::ostream& raw_writer_write_word(std::ostream& outs, Word value);
-
 }//namespace
 
 ///////////////////////////////////////////////////////////////////////////////
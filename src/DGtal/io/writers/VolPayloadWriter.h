@@ -0,0 +1,179 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VolPayloadWriter.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module VolPayloadWriter.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VolPayloadWriter_RECURSES)
+#error Recursive header files inclusion detected in VolPayloadWriter.h
+#else // defined(VolPayloadWriter_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VolPayloadWriter_RECURSES
+
+#if !defined VolPayloadWriter_h
+/** Prevents repeated inclusion of headers. */
+#define VolPayloadWriter_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <vector>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class VolPayloadWriter
+  /**
+   * Description of class 'VolPayloadWriter' <p>
+   * \brief Aim: writes the binary payload of an image (vol, longvol
+   * or raw formats) slab by slab.
+   *
+   * The domain of the image is cut into slabs of consecutive slices
+   * along its last axis (z-slices in 3D). Each slab is serialized
+   * into a buffer of about @ref slabBytes bytes following the domain
+   * scan order, and written to the output stream before the next one
+   * is processed, so that the whole payload is never held in memory.
+   *
+   * When compression is requested, slabs are deflated independently
+   * (raw deflate blocks ended by a sync flush) and concatenated
+   * between a zlib header and an Adler-32 trailer. The result is a
+   * single standard zlib stream, readable by VolReader and
+   * LongvolReader. If DGtal is built with OpenMP (WITH_OPENMP), a
+   * batch of slabs is deflated in parallel, one slab per thread. The
+   * image itself is only read by the calling thread, so any model of
+   * concepts::CConstImage can be exported.
+   *
+   * Integral words are written in little-endian order, other word
+   * types are written as their memory representation.
+   *
+   * @see VolWriter, LongvolWriter, RawWriter, VolPayloadReader
+   */
+  struct VolPayloadWriter
+  {
+    /// Target size in bytes of the uncompressed slabs.
+    static const std::size_t slabBytes = 1 << 20;
+
+    /**
+     * Writes the payload of @a aImage at the current position of @a out.
+     *
+     * @tparam TWord the type of the values written in the file.
+     * @tparam TImage any model of concepts::CConstImage on an HyperRectDomain.
+     * @tparam TFunctor a functor from image values to TWord.
+     *
+     * @param out the output stream (binary mode).
+     * @param aImage the image to export.
+     * @param aFunctor the functor used to cast image values.
+     * @param compressed if true, the payload is written as a zlib stream.
+     * @param compressionLevel the zlib compression level, from 0
+     * (no compression) to 9 (best compression), or -1 for the zlib
+     * default level.
+     *
+     * @throw IOException if the compression level is invalid (nothing
+     * is written then) or if the compression fails.
+     */
+    template <typename TWord, typename TImage, typename TFunctor>
+    static void write( std::ostream & out, const TImage & aImage,
+                       const TFunctor & aFunctor,
+                       bool compressed = false, int compressionLevel = -1 );
+
+    /**
+     * @param compressionLevel a zlib compression level.
+     * @return true if it is -1 (zlib default level) or in [0,9].
+     */
+    static bool isValidCompressionLevel( int compressionLevel );
+
+    /**
+     * Appends to @a buffer the words of the image values on the domain
+     * @a aSlab, in scan order.
+     *
+     * @param aImage the image.
+     * @param aSlab a sub-domain of the image domain.
+     * @param aFunctor the functor used to cast image values.
+     * @param buffer the output buffer.
+     */
+    template <typename TWord, typename TImage, typename TFunctor>
+    static void serialize( const TImage & aImage,
+                           const typename TImage::Domain & aSlab,
+                           const TFunctor & aFunctor,
+                           std::vector<unsigned char> & buffer );
+
+    /**
+     * Raw deflate of the bytes in @a in.
+     *
+     * @param in the uncompressed bytes.
+     * @param compressionLevel the zlib compression level.
+     * @param last if true, the deflate stream is terminated, otherwise
+     * it is ended by a sync flush so that another block can follow.
+     * @param[out] out the compressed bytes.
+     *
+     * @return false if zlib reports an error.
+     */
+    static bool deflateSlab( const std::vector<unsigned char> & in,
+                             int compressionLevel, bool last,
+                             std::vector<unsigned char> & out );
+
+    /**
+     * Writes the two bytes header of a zlib stream.
+     *
+     * @param out the output stream.
+     * @param compressionLevel the zlib compression level (only stored
+     * as a hint in the header).
+     */
+    static void writeZlibHeader( std::ostream & out, int compressionLevel );
+
+  private:
+
+    /// Little-endian encoding of an integral word.
+    template <typename TWord>
+    static void appendWord( std::vector<unsigned char> & buffer,
+                            TWord w, std::true_type );
+
+    /// Memory representation of a non integral word.
+    template <typename TWord>
+    static void appendWord( std::vector<unsigned char> & buffer,
+                            const TWord & w, std::false_type );
+
+  }; // end of struct VolPayloadWriter
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/io/writers/VolPayloadWriter.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VolPayloadWriter_h
+
+#undef VolPayloadWriter_RECURSES
+#endif // else defined(VolPayloadWriter_RECURSES)
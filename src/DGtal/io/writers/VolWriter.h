@@ -61,6 +61,13 @@ namespace DGtal
    * A functor can be specified to convert image values to Vol values
    * (unsigned char).
    *
+   * The payload is written slab by slab (z-slices) by
+   * VolPayloadWriter, so that any model of concepts::CConstImage can
+   * be exported without building the whole payload in memory. The
+   * zlib compression level can be selected and, with OpenMP, slabs
+   * are compressed on several threads. Compressed files remain
+   * standard Version 3 vol files.
+   *
    * @tparam TImage the Image type.
    * @tparam TFunctor the type of functor used in the export.
    */
@@ -82,11 +89,15 @@ namespace DGtal
      * @param aImage the image to export
      * @param compressed boolean to decide wether the vol must be compressed or not
      * @param aFunctor functor used to cast image values
+     * @param compressionLevel zlib compression level, from 0 (no
+     * compression) to 9 (best compression), -1 for the zlib default
+     * (only used if @a compressed is true)
      * @return true if no errors occur.
      */
     static bool exportVol(const std::string & filename, const Image &aImage, 
                           const bool compressed=true,
-                          const Functor & aFunctor = Functor());
+                          const Functor & aFunctor = Functor(),
+                          const int compressionLevel = -1);
   };
 }//namespace
 
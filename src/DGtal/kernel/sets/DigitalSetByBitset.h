@@ -0,0 +1,457 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitset.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByBitset.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitset_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitset.h
+#else // defined(DigitalSetByBitset_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitset_RECURSES
+
+#if !defined DigitalSetByBitset_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitset_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/Bits.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitset
+  /**
+    Description of template class 'DigitalSetByBitset' <p>
+
+    \brief Aim: A set of digital points stored as a dense bitset over
+    a HyperRectDomain, one bit per point of the domain.
+
+    Points are numbered with Linearizer (column-major order), so that
+    membership tests, insertions and erasures are O(1) bit operations,
+    and the set uses domain().size() / 8 bytes whatever its number of
+    points. Iteration skips empty 64 bits words and finds the next
+    point of a word with Bits::leastSignificantBit: it visits points
+    in the order of the domain. Iterators stay valid when other points
+    are inserted or erased.
+
+    It is the representation chosen by DigitalSetSelector for big sets
+    with fast belonging tests. It should not be used for sparse sets
+    in huge domains, since memory and iteration times are proportional
+    to the size of the domain.
+
+    Model of CDigitalSet.
+
+    @code
+    typedef Z3i::Domain Domain;
+    Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 255, 255, 255 ) );
+    DigitalSetByBitset< Domain > aSet( domain ); // 2MB
+    aSet.insert( Z3i::Point( 3, 4, 5 ) );
+    bool in = aSet( Z3i::Point( 3, 4, 5 ) ); // true
+    @endcode
+
+    @tparam TDomain type of domain on which the set will be defined,
+    a HyperRectDomain.
+
+    @see testDigitalSet.cpp, benchmarkSetContainer.cpp
+   */
+  template <typename TDomain>
+  class DigitalSetByBitset
+  {
+  public:
+    ///Domain type.
+    typedef TDomain Domain;
+    ///Self Type.
+    typedef DigitalSetByBitset<Domain> Self;
+    ///Type of digital space.
+    typedef typename Domain::Space Space;
+    ///Type of points in the space.
+    typedef typename Domain::Point Point;
+    ///Value type of the set.
+    typedef Point value_type;
+    ///Size type of the set.
+    typedef typename Space::Size Size;
+    ///Type of the words storing bits.
+    typedef DGtal::uint64_t Word;
+    ///Linearization of the points of the domain.
+    typedef Linearizer< Domain, ColMajorStorage > Linearization;
+
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain< Space > >::value ));
+
+    /// Number of bits of a word.
+    static const unsigned int bitsPerWord = 64;
+
+    /**
+       Read-only forward iterator on the points of the set. Its
+       reference type is a Point (computed from the index of the
+       bit), not a reference.
+    */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::forward_traversal_tag,
+                                       Point const >
+    {
+    public:
+      /// Default constructor (singular iterator).
+      ConstIterator() : mySet( 0 ), myIndex( 0 ) {}
+
+      /**
+         Constructor.
+         @param aSet the visited set.
+         @param anIndex the index of a point of the set, or the size of the domain.
+      */
+      ConstIterator( const Self & aSet, Size anIndex )
+        : mySet( &aSet ), myIndex( anIndex ) {}
+
+      /// @return the index of the pointed point in the domain.
+      Size index() const { return myIndex; }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      void increment()
+      { myIndex = mySet->nextIndex( myIndex + 1 ); }
+
+      bool equal( const ConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+
+      Point dereference() const
+      { return mySet->pointOfIndex( myIndex ); }
+
+      /// The visited set.
+      const Self* mySet;
+      /// The index of the pointed point.
+      Size myIndex;
+    };
+    ///Iterator type of the set (like STL sets, it is read-only).
+    typedef ConstIterator Iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitset() = default;
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitset( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitset( const DigitalSetByBitset & other ) = default;
+
+    /**
+     * Assignment. Bits are copied if both sets have the same domain,
+     * points are inserted one by one otherwise.
+     *
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * @pre the domain of this set should include the domain of \a other.
+     */
+    DigitalSetByBitset & operator= ( const DigitalSetByBitset & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (O(1)).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @tparam PointInputIterator a model of input iterator on points.
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set if the point is not already in the
+     * set.
+     *
+     * @param p any digital point.
+     *
+     * @pre p should belong to the associated domain.
+     * @pre p should not belong to this.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @tparam PointInputIterator a model of input iterator on points.
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     *
+     * @pre all points should belong to the associated domain.
+     * @pre each point should not belong to this.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return an iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left. Words are or-ed if both sets have the same
+     * domain.
+     *
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitset & operator+=( const DigitalSetByBitset & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set (points
+       outside the domain do not).
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement( TOutputIterator& ito ) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this. Words are negated if both sets have the same domain.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const DigitalSetByBitset & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * @param i any index of a point of the domain, or the size of the domain.
+     * @return the smallest index of a point of the set greater or
+     * equal to \a i, or the size of the domain if there is none.
+     */
+    Size nextIndex( Size i ) const;
+
+    /**
+     * @param i any index of a point of the domain.
+     * @return the corresponding point.
+     */
+    Point pointOfIndex( Size i ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+    /// The lower bound of the domain.
+    Point myLowerBound;
+    /// The extent of the domain.
+    Point myExtent;
+    /// The number of points of the domain.
+    Size myDomainSize;
+    /// The bits of the points of the domain.
+    std::vector< Word > myWords;
+    /// The number of points of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitset();
+
+    /**
+     * @param p any point of the domain.
+     * @return its index.
+     */
+    Size indexOfPoint( const Point & p ) const;
+
+    /// @return 'true' iff \a other has the same domain as this set.
+    bool sameDomain( const DigitalSetByBitset & other ) const;
+
+    /// Clears the bits after the last point of the domain.
+    void clearPadding();
+
+  }; // end of class DigitalSetByBitset
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitset'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitset' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out, const DigitalSetByBitset<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitset.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitset_h
+
+#undef DigitalSetByBitset_RECURSES
+#endif // else defined(DigitalSetByBitset_RECURSES)
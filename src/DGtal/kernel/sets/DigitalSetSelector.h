@@ -48,8 +48,11 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
+#include <type_traits>
 #include <unordered_set>
 //////////////////////////////////////////////////////////////////////////////
 
@@ -69,6 +72,20 @@ namespace DGtal
    * Aim: Automatically defines an adequate digital set type according
    * to the hints given by the user.
    *
+   * The preferences are the sum of one value of each enumeration
+   * DigitalSetSize, DigitalSetVariability, DigitalSetIterability and
+   * DigitalSetBelongTestability. The selected type is:
+   *
+   * - DigitalSetByBitset for WHOLE_DS sets, or BIG_DS sets without
+   *   HIGH_ITER_DS, with HIGH_BEL_DS in a HyperRectDomain: one bit per
+   *   point of the domain. Its iteration scans the words of the whole
+   *   domain, hence big sets with HIGH_ITER_DS, which may still be
+   *   sparse in their domain, are not stored as bitsets;
+   * - DigitalSetBySTLVector for SMALL_DS sets with LOW_VAR_DS and
+   *   LOW_BEL_DS: a vector of points;
+   * - DigitalSetByAssociativeContainer over std::unordered_set
+   *   otherwise.
+   *
    * @code
    typedef SpaceND<int,4> Space4;
    typedef HyperRectDomain<Space4> Domain;
@@ -83,15 +100,44 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * @note Z2i::DigitalSet and Z3i::DigitalSet are not defined with
+   * this selector, since they are often used for sparse sets in large
+   * domains.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
   {
     // ----------------------- Local types ------------------------------
+    typedef typename Domain::Point Point;
+    /// The size preference (SMALL_DS, MEDIUM_DS, BIG_DS or WHOLE_DS).
+    static const int size = Preferences & 3;
+    /// 'true' for HIGH_VAR_DS.
+    static const bool highVariability = ( Preferences & HIGH_VAR_DS ) != 0;
+    /// 'true' for HIGH_ITER_DS.
+    static const bool highIterability = ( Preferences & HIGH_ITER_DS ) != 0;
+    /// 'true' for HIGH_BEL_DS.
+    static const bool highBelongTestability = ( Preferences & HIGH_BEL_DS ) != 0;
+    /// 'true' if the domain is a HyperRectDomain.
+    static const bool isHyperRectDomain =
+      std::is_same< Domain, HyperRectDomain< typename Domain::Space > >::value;
+
+    /// The set type when no bitset is selected.
+    typedef typename std::conditional
+    < size == SMALL_DS && ! highVariability && ! highBelongTestability,
+      DigitalSetBySTLVector< Domain >,
+      DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > >::type
+    NonBitsetType;
+
     /**
      * Adequate digital set representation for the given preferences.
      */
-    typedef DigitalSetByAssociativeContainer<Domain, std::unordered_set< typename Domain::Point> > Type;
+    typedef typename std::conditional
+    < isHyperRectDomain && highBelongTestability
+      && ( size == WHOLE_DS || ( size == BIG_DS && ! highIterability ) ),
+      DigitalSetByBitset< typename std::conditional< isHyperRectDomain, Domain,
+                                                     HyperRectDomain< typename Domain::Space > >::type >,
+      NonBitsetType >::type Type;
   }; // end of class DigitalSetSelector
 
 
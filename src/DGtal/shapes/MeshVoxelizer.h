@@ -32,7 +32,10 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <vector>
+#include <type_traits>
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/ParallelFor.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/shapes/IntersectionTarget.h"
@@ -40,6 +43,8 @@
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/BitPackedBinaryImage.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -72,6 +77,13 @@ namespace DGtal
    @image html 26-sep.png "Template for 26-separating digitization"
 
 
+   Closed meshes can also be voxelized as solids with
+   voxelizeInterior(): the voxels whose centers lie inside the mesh
+   (even-odd or non-zero winding rule) are set in an image. Rays
+   parallel to the x-axis are cast through the voxel centers, the
+   crossings with the triangles being computed slab by slab (constant
+   z) in parallel, each slab in its own buffers.
+
    @tparam TDigitalSet a DigitalSet (model of concepts::CDigitalSet)
    @tparam Separation strategy of the voxelization (6 or 26)
    */
@@ -104,6 +116,12 @@ namespace DGtal
     using IntersectionTarget = typename IntersectionTargetTrait<Space, Separation, 1>::Type;
     /*********************************************/
 
+    /// Rule deciding which voxel centers are inside a closed mesh.
+    enum InteriorRule {
+      EVEN_ODD, ///< odd number of crossings of the ray with the mesh
+      NON_ZERO  ///< non-zero winding number of the mesh around the voxel center
+    };
+
   public:
 
     /**
@@ -112,6 +130,18 @@ namespace DGtal
     MeshVoxelizer() = default;
 
     // ----------------------- Standard services ------------------------------
+
+    /**
+     * Sets the number of threads of the mesh voxelizations.
+     * @param[in] nbThreads the number of threads, 0 for
+     * ParallelFor::nbThreads(), 1 (default) for a sequential
+     * voxelization.
+     */
+    void setNbThreads( unsigned int nbThreads );
+
+    /// @return the number of threads of the mesh voxelizations (see setNbThreads).
+    unsigned int nbThreads() const;
+
     /**
      * Voxelize the mesh into the digital set.
      * @warning if the mesh has non-trianuglar faces, we naively triangulate
@@ -121,6 +151,11 @@ namespace DGtal
      * If one voxel is outside the digtial set (@a outputSet) domain, the voxel
      * is skipped.
      *
+     * Faces may be voxelized in parallel (see setNbThreads), each
+     * thread collecting its voxels in its own set. These sets are
+     * merged into @a outputSet at the end, so that each additional
+     * thread costs one digital set on the domain of @a outputSet.
+     *
      * @param [out] outputSet the set that collects the voxels.
      * @param [in] aMesh the mesh to voxelize (vertex coordinates will
      * be casted to @e PointR3 points.
@@ -151,6 +186,42 @@ namespace DGtal
                   const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
                   const double scaleFactor = 1.0);
 
+    /**
+     * Voxelize the interior of a closed mesh into an image: the values
+     * at the points of the image domain which are inside the mesh are
+     * set to true (the other values are left unchanged).
+     *
+     * A ray parallel to the x-axis is cast through each row of voxel
+     * centers (y,z). Its crossings with the (fan triangulated) faces
+     * are computed with a top-left tie-breaking rule, so that a ray
+     * through an edge or a vertex shared by several triangles crosses
+     * the mesh once. The voxels between consecutive crossings are
+     * inside or outside depending on @a rule.
+     *
+     * Slabs of constant z are processed in parallel (see
+     * setNbThreads) with per-thread crossing buffers and without
+     * lock. The values are also written in parallel when rows can be
+     * written concurrently (BitPackedBinaryImage, whose rows are
+     * padded to whole words, and ImageContainerBySTLVector of non bool
+     * values), sequentially otherwise.
+     *
+     * @param [in,out] outputImage the image whose interior voxels are
+     * set to true.
+     * @param [in] aMesh a closed mesh (vertex coordinates will be
+     * casted to @e PointR3 points).
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @param [in] rule the interior rule (default=EVEN_ODD).
+     * @tparam TImage an image type on the domain of the digital set
+     * (e.g. BitPackedBinaryImage or ImageContainerBySTLVector).
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename TImage, typename MeshPoint>
+    void voxelizeInterior(TImage &outputImage,
+                          const Mesh<MeshPoint> &aMesh,
+                          const double scaleFactor = 1.0,
+                          const InteriorRule rule = EVEN_ODD);
+
 
 
     // ----------------------- Internal services ------------------------------
@@ -214,8 +285,89 @@ namespace DGtal
 
   private:
 
+    /**
+     * Tells if the values of distinct rows (along x) of an image can
+     * be set by concurrent threads.
+     */
+    template <typename TImage>
+    struct ConcurrentRowWrites
+    { static const bool value = false; };
+    template <typename TDomain>
+    struct ConcurrentRowWrites< BitPackedBinaryImage<TDomain> >
+    { static const bool value = true; };
+    template <typename TDomain, typename TValue>
+    struct ConcurrentRowWrites< ImageContainerBySTLVector<TDomain, TValue> >
+    { static const bool value = ! std::is_same<TValue, bool>::value; };
+
+    /// A crossing of a ray (row y of a slab) with a triangle at abscissa x.
+    struct Crossing
+    {
+      typename Space::Integer y; ///< row of the ray in its slab.
+      double x;                  ///< abscissa of the crossing.
+      int sign;                  ///< +1 or -1 with the orientation of the triangle.
+      bool operator<( const Crossing & other ) const
+      { return y < other.y || ( y == other.y && x < other.x ); }
+    };
+
+    /// Interior run [xFirst, xLast] of voxels of row y.
+    struct Run
+    {
+      typename Space::Integer y;
+      typename Space::Integer xFirst;
+      typename Space::Integer xLast;
+    };
+
+    /**
+     * Signed edge function of the edge (a,b) at point p in a 2D
+     * projection: twice the signed area of (a,b,p). It is computed
+     * from the lexicographically smallest endpoint, so that the values
+     * for (a,b) and (b,a) are exactly opposite.
+     * @param a first endpoint.
+     * @param b second endpoint.
+     * @param p point.
+     * @return the edge function value.
+     */
+    static
+    double edgeFunction(const PointR2& a,
+                        const PointR2& b,
+                        const PointR2& p);
+
+    /**
+     * Top-left tie-breaking rule: tells if a point lying on the edge
+     * from @a a to @a b belongs to the triangle on the left of this
+     * edge. Exactly one of (a,b) and (b,a) owns its points.
+     * @param a first endpoint.
+     * @param b second endpoint.
+     * @return true if the edge owns its points.
+     */
+    static
+    bool ownsEdgePoints(const PointR2& a,
+                        const PointR2& b);
+
+    /**
+     * Compute the crossings of the rays of slab @a z with a triangle.
+     * @param [out] crossings the buffer collecting the crossings.
+     * @param A Point A (scaled)
+     * @param B Point B (scaled)
+     * @param C Point C (scaled)
+     * @param z the slab.
+     * @param yFirst the first row of the domain.
+     * @param yLast the last row of the domain.
+     */
+    static
+    void crossTriangle(std::vector<Crossing> &crossings,
+                       const PointR3& A,
+                       const PointR3& B,
+                       const PointR3& C,
+                       const typename Space::Integer z,
+                       const typename Space::Integer yFirst,
+                       const typename Space::Integer yLast);
+
     ///Intersection target
     IntersectionTarget myIntersectionTarget;
+
+    ///Number of threads of the mesh voxelizations (see setNbThreads).
+    unsigned int myNbThreads = 1;
   };
 }
 
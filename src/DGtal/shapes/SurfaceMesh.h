@@ -45,10 +45,14 @@
 #include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/base/CompressedRanges.h"
 #include "DGtal/helpers/StdDefs.h"
 
 namespace DGtal
 {
+  template < typename TRealPoint, typename TRealVector >
+  class SurfaceMeshBVH;
+
   /////////////////////////////////////////////////////////////////////////////
   // template class SurfaceMesh
   /**
@@ -116,6 +120,15 @@ namespace DGtal
     typedef std::vector< Face >                     Faces;
     typedef std::vector< WeightedFace >             WeightedFaces;
     typedef std::pair< Vertex, Vertex >             VertexPair;
+    /// The type that stores the adjacency relations: one contiguous
+    /// range of indices per element (CSR layout).
+    typedef CompressedRanges< Index >               IndexRanges;
+    /// A non-mutable view on a stored range of vertices, which
+    /// converts implicitly to Vertices.
+    typedef typename IndexRanges::Range             VertexRange;
+    /// A non-mutable view on a stored range of faces, which converts
+    /// implicitly to Faces.
+    typedef typename IndexRanges::Range             FaceRange;
 
     // Required by CUndirectedSimpleLocalGraph
     typedef std::set<Vertex>                   VertexSet;
@@ -296,29 +309,40 @@ namespace DGtal
     /// @param j any vertex of the mesh
     /// @return the edge index of edge (i,j) or `nbEdges()` if this
     /// edge does not exist.
-    /// @note O(log E) time complexity.
+    /// @note O(log d) time complexity, d the degree of min(i,j).
     Edge makeEdge( Vertex i, Vertex j ) const;
 
+    /// Sets the number of threads used by init() to compute the
+    /// adjacency relations (vertices to faces, neighbors, edges).
+    /// @param n the number of threads, 0 means ParallelFor::nbThreads().
+    void setNbThreads( unsigned int n )
+    { myNbThreads = n; }
+
+    /// @return the number of threads used by init(), 0 means
+    /// ParallelFor::nbThreads().
+    unsigned int nbThreads() const
+    { return myNbThreads; }
+
     /// @param f any face
-    /// @return a const reference to the range giving for face \a f 
+    /// @return a view on the range giving for face \a f 
     /// its incident vertices.
-    const Vertices&  incidentVertices( Face f ) const
+    VertexRange incidentVertices( Face f ) const
     { return myIncidentVertices[ f ]; }
 
     /// @param v any vertex
-    /// @return a const reference to the range giving for vertex \a v
+    /// @return a view on the range giving for vertex \a v
     /// its incident faces.
-    const Faces& incidentFaces( Vertex v ) const
+    FaceRange incidentFaces( Vertex v ) const
     { return myIncidentFaces[ v ]; }
     
     /// @param f any face
-    /// @return a const reference to the range of neighbor faces for face \a f.
-    const Faces& neighborFaces( Face f ) const
+    /// @return a view on the range of neighbor faces for face \a f.
+    FaceRange neighborFaces( Face f ) const
     { return myNeighborFaces[ f ]; }
 
     /// @param v any vertex
-    /// @return a const reference to the range of neighbor vertices for vertex \a v.
-    const Vertices& neighborVertices( Vertex v ) const
+    /// @return a view on the range of neighbor vertices for vertex \a v.
+    VertexRange neighborVertices( Vertex v ) const
     { return myNeighborVertices[ v ]; }
 
     /// @param e any edge
@@ -328,49 +352,49 @@ namespace DGtal
     { return myEdgeVertices[ e ]; }
     
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
+    /// @return a view on the range giving for edge \a e
     /// its incident faces (one, two, or more if non manifold)
-    const Faces& edgeFaces( Edge e ) const
+    FaceRange edgeFaces( Edge e ) const
     { return myEdgeFaces[ e ]; }
 
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
+    /// @return a view on the range giving for edge \a e
     /// its incident faces to its right (zero if open, one, or more if
     /// non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    const Faces& edgeRightFaces( Edge e ) const 
+    FaceRange edgeRightFaces( Edge e ) const
     { return myEdgeRightFaces[ e ]; }
 
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
+    /// @return a view on the range giving for edge \a e
     /// its incident faces to its left (zero if open, one, or more if
     /// non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    const Faces& edgeLeftFaces( Edge e ) const 
+    FaceRange edgeLeftFaces( Edge e ) const
     { return myEdgeLeftFaces[ e ]; }
 
-    /// @return a const reference to the vector giving for each face
+    /// @return a const reference to the ranges giving for each face
     /// its incident vertices.
-    const std::vector< Vertices >& allIncidentVertices() const
+    const IndexRanges& allIncidentVertices() const
     { return myIncidentVertices; }
 
-    /// @return a const reference to the vector giving for each vertex
+    /// @return a const reference to the ranges giving for each vertex
     /// its incident faces.
-    const std::vector< Faces >& allIncidentFaces() const
+    const IndexRanges& allIncidentFaces() const
     { return myIncidentFaces; }
     
-    /// @return a const reference to the vector of neighbor faces for each face.
-    const std::vector< Faces >& allNeighborFaces() const
+    /// @return a const reference to the ranges of neighbor faces for each face.
+    const IndexRanges& allNeighborFaces() const
     { return myNeighborFaces; }
 
-    /// @return a const reference to the vector of neighbor vertices for each vertex.
-    const std::vector< Vertices >& allNeighborVertices() const
+    /// @return a const reference to the ranges of neighbor vertices for each vertex.
+    const IndexRanges& allNeighborVertices() const
     { return myNeighborVertices; }
 
     /// @return a const reference to the vector giving for each edge
@@ -379,29 +403,29 @@ namespace DGtal
     const std::vector< VertexPair >& allEdgeVertices() const
     { return myEdgeVertices; }
     
-    /// @return a const reference to the vector giving for each edge
+    /// @return a const reference to the ranges giving for each edge
     /// its incident faces (one, two, or more if non manifold)
-    const std::vector< Faces >& allEdgeFaces() const
+    const IndexRanges& allEdgeFaces() const
     { return myEdgeFaces; }
 
-    /// @return a const reference to the vector giving for each edge
+    /// @return a const reference to the ranges giving for each edge
     /// its incident faces to its right (zero if open, one, or more if
     /// non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    const std::vector< Faces >& allEdgeRightFaces() const 
+    const IndexRanges& allEdgeRightFaces() const
     { return myEdgeRightFaces; }
 
-    /// @return a const reference to the vector giving for each edge
+    /// @return a const reference to the ranges giving for each edge
     /// its incident faces to its left (zero if open, one, or more if
     /// non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    const std::vector< Faces >& allEdgeLeftFaces() const 
+    const IndexRanges& allEdgeLeftFaces() const
     { return myEdgeLeftFaces; }
     
     /// @}
@@ -656,6 +680,47 @@ namespace DGtal
     /// @note a vertex is either included or not, so no weight is necessary.
     std::tuple< Vertices, WeightedEdges, WeightedFaces >
     computeCellsInclusionsInBall( Scalar r, Index f ) const;
+
+    /// Same as computeFacesInclusionsInBall( Scalar, Index ), but the
+    /// faces are found with the bounding volume hierarchy \a bvh
+    /// built on this mesh instead of a breadth-first traversal from
+    /// \a f. Faces are returned by increasing index.
+    ///
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @param bvh a bounding volume hierarchy on this mesh (include
+    /// SurfaceMeshBVH.h to call this method).
+    ///
+    /// @return the range of faces having an non empty intersection
+    /// with this ball, each one weighted by its ratio of inclusion.
+    ///
+    /// @note Contrary to the breadth-first traversal, the result
+    /// includes the faces intersecting the ball that are not
+    /// connected to \a f through such faces, hence it is a superset
+    /// of the former one.
+    WeightedFaces
+    computeFacesInclusionsInBall( Scalar r, Index f,
+                                  const SurfaceMeshBVH< RealPoint, RealVector > & bvh ) const;
+
+    /// Same as computeCellsInclusionsInBall( Scalar, Index ), but the
+    /// faces are found with the bounding volume hierarchy \a bvh
+    /// built on this mesh instead of a breadth-first traversal from
+    /// \a f.
+    ///
+    /// @param r the radius of the ball.
+    /// @param f the face where the ball is centered.
+    /// @param bvh a bounding volume hierarchy on this mesh (include
+    /// SurfaceMeshBVH.h to call this method).
+    ///
+    /// @return the range of vertices/edges/faces having an non empty
+    /// intersection with this ball, each edge/face weighted by its
+    /// ratio of inclusion.
+    ///
+    /// @note As for computeFacesInclusionsInBall, the result may
+    /// include cells not connected to \a f within the ball.
+    std::tuple< Vertices, WeightedEdges, WeightedFaces >
+    computeCellsInclusionsInBall( Scalar r, Index f,
+                                  const SurfaceMeshBVH< RealPoint, RealVector > & bvh ) const;
     
     /// Computes an approximation of the inclusion ratio of a given
     /// face \a f with a ball of radius \a r and center \a p.
@@ -718,35 +783,42 @@ namespace DGtal
     // ------------------------- Protected Datas ------------------------------
   protected:
     /// For each face, its range of incident vertices
-    std::vector< Vertices >     myIncidentVertices;
-    /// For each vertex, its range of incident faces
-    std::vector< Faces >        myIncidentFaces;
+    IndexRanges                 myIncidentVertices;
+    /// For each vertex, its range of incident faces (increasing order)
+    IndexRanges                 myIncidentFaces;
     /// For each vertex, its position
     std::vector< RealPoint >    myPositions;
     /// For each vertex, its normal vector
     std::vector< RealVector >   myVertexNormals;
     /// For each face, its normal vector
     std::vector< RealVector >   myFaceNormals;
-    /// For each face, its range of neighbor faces (no particular order)
-    std::vector< Faces >        myNeighborFaces;
-    /// For each vertex, its range of neighbor vertices (no particular order)
-    std::vector< Vertices >     myNeighborVertices;
+    /// For each face, its range of neighbor faces (increasing order)
+    IndexRanges                 myNeighborFaces;
+    /// For each vertex, its range of neighbor vertices (increasing order)
+    IndexRanges                 myNeighborVertices;
     /// For each edge, its two vertices
     std::vector< VertexPair >   myEdgeVertices;
+    /// For each vertex v, the index of the first edge (v,w) with v <= w
+    /// (edges are sorted lexicographically), nbVertices()+1 of them.
+    std::vector< Edge >         myVertexEdgeOffsets;
     /// For each edge, its faces (one, two, or more if non manifold)
-    std::vector< Faces >        myEdgeFaces;
+    IndexRanges                 myEdgeFaces;
     /// For each edge, its faces to its right  (zero if open, one, or more if
     /// non manifold).
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    std::vector< Faces >        myEdgeRightFaces;
+    IndexRanges                 myEdgeRightFaces;
     /// For each edge, its faces to its left  (zero if open, one, or more if
     /// non manifold).
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    std::vector< Faces >        myEdgeLeftFaces;
+    IndexRanges                 myEdgeLeftFaces;
+
+    /// The number of threads used to compute the adjacency relations,
+    /// 0 means ParallelFor::nbThreads().
+    unsigned int                myNbThreads = 0;
 
     // ------------------------- Private Datas --------------------------------
   private:
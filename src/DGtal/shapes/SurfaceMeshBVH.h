@@ -0,0 +1,357 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SurfaceMeshBVH.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SurfaceMeshBVH.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SurfaceMeshBVH_RECURSES)
+#error Recursive header files inclusion detected in SurfaceMeshBVH.h
+#else // defined(SurfaceMeshBVH_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SurfaceMeshBVH_RECURSES
+
+#if !defined SurfaceMeshBVH_h
+/** Prevents repeated inclusion of headers. */
+#define SurfaceMeshBVH_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SurfaceMeshBVH
+  /**
+   * Description of template class 'SurfaceMeshBVH' <p>
+   * \brief Aim: A bounding volume hierarchy (BVH) over the faces of a
+   * SurfaceMesh, i.e. a binary tree of axis-aligned bounding boxes
+   * whose leaves hold a few faces. It answers proximity queries in
+   * logarithmic time instead of visiting all the faces: faces
+   * intersecting a ball, k nearest faces, closest point and first
+   * intersection with a ray.
+   *
+   * The tree is built with the surface area heuristic (SAH) evaluated
+   * on 16 bins along the largest axis of the face centroids. The top
+   * of the tree is split sequentially, then its subtrees are built in
+   * parallel (see setNbThreads). After the vertices have moved (e.g.
+   * SurfaceMesh::perturbateWithUniformRandomNoise), refit() updates
+   * the boxes while keeping the tree, which is much faster than a new
+   * build but may lower the quality of the tree for large moves.
+   *
+   * Faces are polygons of the 3D space, triangulated as fans around
+   * their first vertex for the exact distance and ray queries. The
+   * ball measures of SurfaceMesh (e.g.
+   * SurfaceMesh::computeFacesInclusionsInBall) optionally use this
+   * hierarchy.
+   *
+   * @code
+   * SurfaceMeshBVH< RealPoint, RealVector > bvh( smesh );
+   * auto cp  = bvh.closestPoint( p );         // cp.face, cp.point, cp.distance
+   * auto hit = bvh.intersectRay( p, dir );    // hit.face == bvh.nbFaces() if none
+   * auto kf  = bvh.kNearestFaces( p, 10 );    // ( face, distance ) sorted by distance
+   * smesh.perturbateWithUniformRandomNoise( 0.1 );
+   * bvh.refit();
+   * @endcode
+   *
+   * @note The hierarchy refers to the mesh, which must exist and keep
+   * its faces as long as the hierarchy is used.
+   *
+   * @tparam TRealPoint an arbitrary model of 3D RealPoint.
+   * @tparam TRealVector an arbitrary model of 3D RealVector.
+   *
+   * @see testSurfaceMeshBVH.cpp
+   */
+  template < typename TRealPoint, typename TRealVector >
+  class SurfaceMeshBVH
+  {
+  public:
+    typedef TRealPoint                              RealPoint;
+    typedef TRealVector                             RealVector;
+    typedef SurfaceMeshBVH< RealPoint, RealVector > Self;
+    typedef DGtal::SurfaceMesh< RealPoint, RealVector > SurfaceMesh;
+    typedef typename SurfaceMesh::Scalar            Scalar;
+    typedef typename SurfaceMesh::Size              Size;
+    typedef typename SurfaceMesh::Index             Index;
+    typedef typename SurfaceMesh::Face              Face;
+    typedef typename SurfaceMesh::Faces             Faces;
+    typedef typename SurfaceMesh::WeightedFaces     WeightedFaces;
+
+    BOOST_STATIC_ASSERT( RealPoint::dimension == 3 );
+
+    /// A point of a face, as returned by closest point and ray queries.
+    struct FacePoint
+    {
+      /// The face, or nbFaces() when there is none.
+      Face      face;
+      /// The point of the face.
+      RealPoint point;
+      /// The distance to the query point, or the parameter t of the
+      /// point along the ray (point = origin + t * direction).
+      Scalar    distance;
+    };
+
+    /// A node of the hierarchy. Children of inner nodes are
+    /// consecutive, and stored after their parent.
+    struct Node
+    {
+      /// The lowest point of the bounding box.
+      RealPoint lo;
+      /// The highest point of the bounding box.
+      RealPoint hi;
+      /// The index of the first child (inner node), or the index of
+      /// the first face in faces() (leaf).
+      Index     first;
+      /// The number of faces of a leaf, 0 for an inner node.
+      Size      count;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The object is not valid.
+    SurfaceMeshBVH();
+
+    /**
+     * Constructor. Builds the hierarchy.
+     * @param smesh the mesh, aliased.
+     * @param nbThreads the number of threads of the builds and refits,
+     * 0 means ParallelFor::nbThreads().
+     */
+    SurfaceMeshBVH( ConstAlias< SurfaceMesh > smesh, unsigned int nbThreads = 0 );
+
+    /**
+     * (Re)builds the hierarchy on the faces of a mesh.
+     * @param smesh the mesh, aliased.
+     */
+    void init( ConstAlias< SurfaceMesh > smesh );
+
+    /// Updates the bounding boxes after the vertices of the mesh have
+    /// moved. The faces of the mesh must be the same as at init().
+    void refit();
+
+    /// Sets the number of threads used by init() and refit().
+    /// @param n the number of threads, 0 means ParallelFor::nbThreads().
+    void setNbThreads( unsigned int n )
+    { myNbThreads = n; }
+
+    /// @return the number of threads used by init() and refit(), 0
+    /// means ParallelFor::nbThreads().
+    unsigned int nbThreads() const
+    { return myNbThreads; }
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the mesh.
+    const SurfaceMesh & mesh() const
+    { return *myMesh; }
+
+    /// @return the number of faces of the mesh.
+    Size nbFaces() const
+    { return myFaces.size(); }
+
+    /// @return the nodes of the hierarchy, the root being the first one.
+    const std::vector< Node > & nodes() const
+    { return myNodes; }
+
+    /// @return the faces, ordered so that each leaf refers to a
+    /// contiguous range of them.
+    const Faces & faces() const
+    { return myFaces; }
+
+    /// @return the depth of the hierarchy (1 for a single leaf).
+    Size depth() const;
+
+    // ----------------------- Queries ----------------------------------------
+  public:
+
+    /**
+     * Calls \a visitor on every face whose bounding box intersects
+     * the ball of center \a p and radius \a r.
+     *
+     * @tparam TVisitor the type of a functor (Face).
+     * @param p the center of the ball.
+     * @param r the radius of the ball.
+     * @param visitor the functor called on each face.
+     */
+    template < typename TVisitor >
+    void visitFacesNearBall( const RealPoint & p, Scalar r, TVisitor visitor ) const;
+
+    /**
+     * @param p the center of the ball.
+     * @param r the radius of the ball.
+     * @return the faces at distance at most \a r from \a p, in increasing order.
+     */
+    Faces facesInBall( const RealPoint & p, Scalar r ) const;
+
+    /**
+     * @param p any point.
+     * @param k the number of faces.
+     * @return the (at most) \a k faces nearest to \a p, with their
+     * distance to \a p, in increasing order of distance.
+     */
+    WeightedFaces kNearestFaces( const RealPoint & p, Size k ) const;
+
+    /**
+     * @param p any point.
+     * @return the closest point to \a p on the mesh, its face and its
+     * distance to \a p (face is nbFaces() if the mesh has no face).
+     */
+    FacePoint closestPoint( const RealPoint & p ) const;
+
+    /**
+     * @param origin the origin of the ray.
+     * @param direction the direction of the ray, a non-null vector.
+     * @param tmax the maximal parameter of the intersection.
+     * @return the first intersection of the ray with a face, whose
+     * distance is its parameter t in [0,tmax] along the ray (face is
+     * nbFaces() if there is no intersection).
+     */
+    FacePoint intersectRay( const RealPoint & origin, const RealVector & direction,
+                            Scalar tmax = std::numeric_limits< Scalar >::max() ) const;
+
+    /**
+     * @param p any point.
+     * @param f any face.
+     * @return the closest point to \a p on face \a f.
+     */
+    RealPoint closestPointOnFace( const RealPoint & p, Face f ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Sets the box of node \a idx to the boxes of faces [b,e) of
+     * myFaces, then splits them with the binned SAH or makes a leaf.
+     *
+     * @param[in,out] nodes the nodes, where the two children are appended.
+     * @param idx the index of the node in \a nodes.
+     * @param b,e the range of the faces of the node in myFaces.
+     * @param los,his the lowest and highest points of the face boxes.
+     * @return the index of the first child, or 0 for a leaf.
+     */
+    Index splitNode( std::vector< Node > & nodes, Index idx, Index b, Index e,
+                     const std::vector< RealPoint > & los,
+                     const std::vector< RealPoint > & his );
+
+    /**
+     * Builds the whole subtree of node \a idx.
+     * @param[in,out] nodes the nodes.
+     * @param idx the index of the root of the subtree in \a nodes.
+     * @param b,e the range of the faces of the subtree in myFaces.
+     * @param los,his the lowest and highest points of the face boxes.
+     */
+    void buildSubtree( std::vector< Node > & nodes, Index idx, Index b, Index e,
+                       const std::vector< RealPoint > & los,
+                       const std::vector< RealPoint > & his );
+
+    /// Computes the bounding box of face \a f.
+    void faceBox( Face f, RealPoint & lo, RealPoint & hi ) const;
+
+    /// @return the squared distance from \a p to the box [lo,hi].
+    static Scalar squaredDistanceToBox( const RealPoint & p,
+                                        const RealPoint & lo, const RealPoint & hi );
+
+    /// @return the closest point to \a p on the segment [a,b].
+    static RealPoint closestPointOnSegment( const RealPoint & p,
+                                            const RealPoint & a, const RealPoint & b );
+
+    /// @return the closest point to \a p on the triangle (a,b,c).
+    static RealPoint closestPointOnTriangle( const RealPoint & p, const RealPoint & a,
+                                             const RealPoint & b, const RealPoint & c );
+
+    /**
+     * Intersects a ray with a triangle (both sides).
+     * @param[in,out] t the parameter of the intersection, updated if
+     * the triangle is hit before \a t.
+     * @return 'true' iff the triangle is hit before \a t.
+     */
+    static bool intersectTriangle( const RealPoint & origin, const RealVector & direction,
+                                   const RealPoint & a, const RealPoint & b,
+                                   const RealPoint & c, Scalar & t );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The mesh.
+    CountedConstPtrOrConstPtr< SurfaceMesh > myMesh;
+    /// The nodes, the root being the first one.
+    std::vector< Node > myNodes;
+    /// The faces, each leaf refers to a contiguous range of them.
+    Faces myFaces;
+    /// The number of threads, 0 means ParallelFor::nbThreads().
+    unsigned int myNbThreads = 0;
+
+  }; // end of class SurfaceMeshBVH
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SurfaceMeshBVH'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SurfaceMeshBVH' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TRealPoint, typename TRealVector >
+  std::ostream&
+  operator<< ( std::ostream & out, const SurfaceMeshBVH< TRealPoint, TRealVector > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/SurfaceMeshBVH.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SurfaceMeshBVH_h
+
+#undef SurfaceMeshBVH_RECURSES
+#endif // else defined(SurfaceMeshBVH_RECURSES)
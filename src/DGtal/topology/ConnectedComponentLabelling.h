@@ -0,0 +1,312 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabelling.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ConnectedComponentLabelling.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabelling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabelling.h
+#else // defined(ConnectedComponentLabelling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabelling_RECURSES
+
+#if !defined ConnectedComponentLabelling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabelling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/UnionFind.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/topology/MetricAdjacency.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabellingTraits
+  /**
+   * Description of template class 'ConnectedComponentLabellingTraits' <p>
+   * \brief Aim: tells if an adjacency can be handled by
+   * ConnectedComponentLabelling, i.e. if it is a MetricAdjacency of
+   * the whole space, and gives its maximal l1 norm.
+   *
+   * @tparam TAdjacency any type of adjacency.
+   */
+  template <typename TAdjacency>
+  struct ConnectedComponentLabellingTraits
+  {
+    /// 'true' iff the adjacency is handled by ConnectedComponentLabelling.
+    static const bool isMetric = false;
+    /// The maximal l1 norm of the displacement between adjacent points.
+    static const Dimension maxNorm1 = 0;
+  };
+
+  /**
+   * Specialization for MetricAdjacency.
+   */
+  template <typename TSpace, Dimension norm1, Dimension dimension>
+  struct ConnectedComponentLabellingTraits< MetricAdjacency< TSpace, norm1, dimension > >
+  {
+    static const bool isMetric = ( dimension == TSpace::dimension );
+    static const Dimension maxNorm1 = norm1;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabelling
+  /**
+   * Description of template class 'ConnectedComponentLabelling' <p>
+   * \brief Aim: labels the connected components of a binary image or of
+   * a digital set in a HyperRectDomain, for the metric adjacencies
+   * (4 and 8 in 2D, 6, 18 and 26 in 3D, see MetricAdjacency).
+   *
+   * The labelling is the classical two-pass raster scan: each
+   * foreground point gets the label of its already visited neighbors,
+   * labels of a same component being merged with a UnionFind, and a
+   * second pass replaces them by the final labels. With several
+   * threads, the domain is cut into slabs along its last axis that
+   * are labelled independently, then the components touching the
+   * slab boundaries are merged.
+   *
+   * Components are labelled from 1 to nbComponents() in the raster
+   * order of their first point (the background is labelled 0), so
+   * that the result does not depend on the number of threads. The
+   * size and the bounding box of each component are computed along.
+   *
+   * @code
+   * ConnectedComponentLabelling< Z3i::Space > ccl( 3 ); // 26-adjacency
+   * ccl.labelSet( aSet );
+   * for ( ConnectedComponentLabelling< Z3i::Space >::Label l = 1;
+   *       l <= ccl.nbComponents(); ++l )
+   *   trace.info() << ccl.componentSize( l ) << std::endl;
+   * @endcode
+   *
+   * @tparam TSpace any digital space.
+   * @tparam TLabel an unsigned integral type for the labels.
+   *
+   * @see Object::writeComponents
+   * @see testConnectedComponentLabelling.cpp
+   */
+  template < typename TSpace, typename TLabel = DGtal::uint32_t >
+  class ConnectedComponentLabelling
+  {
+  public:
+    typedef TSpace Space;
+    typedef TLabel Label;
+    typedef HyperRectDomain< Space > Domain;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef std::size_t Size;
+    /// The label of each point of the domain.
+    typedef ImageContainerBySTLVector< Domain, Label > LabelImage;
+    /// The lowest and uppermost points of a component.
+    typedef std::pair< Point, Point > BoundingBox;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param maxNorm1 the maximal l1 norm of the displacement between
+     * two adjacent points, between 1 and the dimension (e.g. 1 for
+     * the 6-adjacency and 3 for the 26-adjacency in 3D).
+     * @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+     */
+    explicit ConnectedComponentLabelling( Dimension maxNorm1 = 1,
+                                          unsigned int nbThreads = 1 );
+
+    /// @return the maximal l1 norm of the adjacency.
+    Dimension maxNorm1() const;
+
+    /**
+     * Sets the number of threads used by the labelling.
+     * @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+     */
+    void setNbThreads( unsigned int nbThreads );
+
+    /// @return the number of threads used by the labelling.
+    unsigned int nbThreads() const;
+
+    // ----------------------- Labelling services -----------------------------
+  public:
+
+    /**
+     * Labels the points of the image domain whose value is different
+     * from the default value (e.g. non zero or true).
+     *
+     * @tparam TImage a model of concepts::CConstImage over a
+     * HyperRectDomain of Space.
+     * @param image any image.
+     * @return the number of components.
+     */
+    template <typename TImage>
+    Size labelImage( const TImage & image );
+
+    /**
+     * Labels the points of the image domain whose value satisfies a
+     * predicate.
+     *
+     * @tparam TImage a model of concepts::CConstImage over a
+     * HyperRectDomain of Space.
+     * @tparam TValuePredicate a predicate on the image values.
+     * @param image any image.
+     * @param isForeground a predicate which is 'true' for foreground values.
+     * @return the number of components.
+     */
+    template <typename TImage, typename TValuePredicate>
+    Size labelImage( const TImage & image, const TValuePredicate & isForeground );
+
+    /**
+     * Labels the points of a digital set in its bounding box.
+     *
+     * @tparam TDigitalSet a model of concepts::CDigitalSet of Space.
+     * @param aSet any digital set.
+     * @return the number of components.
+     */
+    template <typename TDigitalSet>
+    Size labelSet( const TDigitalSet & aSet );
+
+    /**
+     * Labels the points of a digital set in a given domain, the
+     * points of the set outside the domain being ignored.
+     *
+     * @tparam TDigitalSet a model of concepts::CDigitalSet of Space.
+     * @param aSet any digital set.
+     * @param aDomain the labelled domain.
+     * @return the number of components.
+     */
+    template <typename TDigitalSet>
+    Size labelSet( const TDigitalSet & aSet, const Domain & aDomain );
+
+    /// @return the number of components of the last labelling.
+    Size nbComponents() const;
+
+    /// @return the domain of the last labelling.
+    const Domain & domain() const;
+
+    /**
+     * @return the label image of the last labelling: 0 for the
+     * background, and from 1 to nbComponents() for the components.
+     */
+    const LabelImage & labels() const;
+
+    /**
+     * @param l any label between 1 and nbComponents().
+     * @return the number of points of component @a l.
+     */
+    Size componentSize( Label l ) const;
+
+    /**
+     * @param l any label between 1 and nbComponents().
+     * @return the bounding box of component @a l.
+     */
+    BoundingBox boundingBox( Label l ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// A displacement towards a neighbor visited before in raster order.
+    struct Offset
+    {
+      Vector displacement;
+      std::ptrdiff_t index;
+    };
+
+    /// The maximal l1 norm of the adjacency.
+    Dimension myMaxNorm1;
+    /// The number of threads (0 for ParallelFor::nbThreads()).
+    unsigned int myNbThreads;
+    /// The label image (initially 1 for the foreground, 0 for the background).
+    CountedPtr< LabelImage > myLabels;
+    /// The number of points of each component (index 0 is unused).
+    std::vector< Size > mySizes;
+    /// The bounding box of each component (index 0 is unused).
+    std::vector< BoundingBox > myBoxes;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /// @return the displacements towards the neighbors preceding a
+    /// point in raster order.
+    std::vector< Offset > backwardOffsets( const Vector & extent ) const;
+
+    /**
+     * Labels the foreground (non zero) points of myLabels and computes
+     * the component sizes and bounding boxes.
+     * @return the number of components.
+     */
+    Size compute();
+
+  }; // end of class ConnectedComponentLabelling
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabelling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabelling' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TSpace, typename TLabel >
+  std::ostream&
+  operator<< ( std::ostream & out, const ConnectedComponentLabelling< TSpace, TLabel > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/ConnectedComponentLabelling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabelling_h
+
+#undef ConnectedComponentLabelling_RECURSES
+#endif // else defined(ConnectedComponentLabelling_RECURSES)
@@ -42,7 +42,11 @@
 // Inclusions
 #include <iostream>
 #include <array>
+#include <vector>
+#include <map>
+#include <set>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -114,12 +118,20 @@ namespace DGtal
 
     /// An arc is a directed edge from a first vertex to a second vertex.
     typedef std::pair<VertexIndex, VertexIndex> Arc;
+    /// A hash functor for arcs, which mixes both vertex indices.
+    struct ArcHash
+    {
+      std::size_t operator()( const Arc& arc ) const
+      {
+        return static_cast<std::size_t>
+          ( static_cast<DGtal::uint64_t>( arc.first ) * 0x9e3779b97f4a7c15ULL )
+          ^ arc.second;
+      }
+    };
     // A map from an arc (a std::pair of VertexIndex's) to its
     // half edge index (i.e. and offset into the 'halfedge' sequence).
-    typedef std::map< Arc, Index > Arc2Index;
-    // A map from an arc (a std::pair of VertexIndex's) to its face
-    // index.
-    typedef std::map< Arc, FaceIndex > Arc2FaceIndex;
+    // It is an open addressing hash map, hence it is not ordered.
+    typedef OpenAddressingHashMap< Arc, Index, ArcHash > Arc2Index;
     
     /// Represents an unoriented edge as two vertex indices, the first
     /// lower than the second.
@@ -148,6 +160,10 @@ namespace DGtal
         return ( start() < other.start() )
           || ( ( start() == other.start() ) && ( end() < other.end() ) );
       }
+      bool operator==( const Edge& other ) const
+      {
+        return ( start() == other.start() ) && ( end() == other.end() );
+      }
     };
 
     /// Represents an unoriented triangle as three vertices.
@@ -215,6 +231,11 @@ namespace DGtal
     /** 
      * Computes all the unoriented edges of the given triangles. 
      *
+     * The arcs of the triangles are packed as (min,max) pairs of
+     * vertex indices, sorted (in parallel when there are many of them)
+     * and made unique, hence the edges are output in lexicographic
+     * order.
+     *
      * @note Method build() needs the unordered edges of the mesh.  If
      * you don't have them, call this first.
      *
@@ -223,39 +244,27 @@ namespace DGtal
      * @param[out] edges_out the vector of all the unoriented edges of
      * the given triangles.
      *
+     * @param[in] nbThreads the number of threads used for sorting the
+     * edges, 0 means ParallelFor::nbThreads().
+     *
      * @return the total number of different vertices (note that the
      * vertex numbering should be between 0 and this number minus
      * one).
      */
     static Size getUnorderedEdgesFromTriangles
-    ( const std::vector<Triangle>& triangles, std::vector< Edge >& edges_out )
+    ( const std::vector<Triangle>& triangles, std::vector< Edge >& edges_out,
+      unsigned int nbThreads = 0 )
     {
-      typedef std::set< Edge > EdgeSet;
-      typedef std::set< VertexIndex > VertexIndexSet;
-      VertexIndexSet vertexSet;
-      EdgeSet edgeSet;
-      for( const Triangle& T : triangles )
-        {
-          edgeSet.insert( Edge( T.i(), T.j() ) );
-          edgeSet.insert( Edge( T.j(), T.k() ) );
-          edgeSet.insert( Edge( T.k(), T.i() ) );
-          vertexSet.insert( T.i() );
-          vertexSet.insert( T.j() );
-          vertexSet.insert( T.k() );
-        }
-      edges_out.resize( edgeSet.size() );
-      Size e = 0;
-      for ( const Edge& edge : edgeSet )
-        {
-          edges_out.at(e) = edge;
-          ++e;
-        }
-      return vertexSet.size();
+      return getUnorderedEdgesFromFaces( triangles, edges_out, nbThreads );
     }
 
     /** 
      * Computes all the unoriented edges of the given polygonal faces.
      *
+     * The arcs of the faces are packed as (min,max) pairs of vertex
+     * indices, sorted (in parallel when there are many of them) and
+     * made unique, hence the edges are output in lexicographic order.
+     *
      * @note Method build() needs the unordered edges of the mesh.  If
      * you don't have them, call this first.
      *
@@ -264,12 +273,19 @@ namespace DGtal
      * @param[out] edges_out the vector of all the unoriented edges of
      * the given triangles.
      *
+     * @param[in] nbThreads the number of threads used for sorting the
+     * edges, 0 means ParallelFor::nbThreads().
+     *
      * @return the total number of different vertices (note that the
      * vertex numbering should be between 0 and this number minus
      * one).
      */
     static Size getUnorderedEdgesFromPolygonalFaces
-    ( const std::vector<PolygonalFace>& polygonal_faces, std::vector< Edge >& edges_out );
+    ( const std::vector<PolygonalFace>& polygonal_faces, std::vector< Edge >& edges_out,
+      unsigned int nbThreads = 0 )
+    {
+      return getUnorderedEdgesFromFaces( polygonal_faces, edges_out, nbThreads );
+    }
     
     /**
      * Builds the half-edge data structures from the given triangles
@@ -334,7 +350,7 @@ namespace DGtal
     bool build( const std::vector<Triangle>& triangles )
     {
       std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromTriangles( triangles, edges );
+      const Size nbVtx = getUnorderedEdgesFromTriangles( triangles, edges, myNbThreads );
       return build( nbVtx, triangles, edges );
     }
 
@@ -349,10 +365,17 @@ namespace DGtal
     bool build( const std::vector<PolygonalFace>& polygonal_faces )
     {
       std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromPolygonalFaces( polygonal_faces, edges );
+      const Size nbVtx = getUnorderedEdgesFromPolygonalFaces( polygonal_faces, edges, myNbThreads );
       return build( nbVtx, polygonal_faces, edges );
     }
 
+    /// Sets the number of threads used to compute the edges in build().
+    /// @param n the number of threads, 0 means ParallelFor::nbThreads().
+    void setNbThreads( unsigned int n ) { myNbThreads = n; }
+
+    /// @return the number of threads used to compute the edges in build().
+    unsigned int nbThreads() const { return myNbThreads; }
+
     /// Clears the data structure.
     void clear()
     {
@@ -1391,6 +1414,8 @@ namespace DGtal
     std::vector< Index > myEdgeHalfEdges;
     /// The mapping between arcs to their half-edge index.
     Arc2Index myArc2Index;
+    /// The number of threads used to compute the edges (0 is the default).
+    unsigned int myNbThreads = 0;
     
 
     // ----------------------- Interface --------------------------------------
@@ -1409,23 +1434,89 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
-    static
-    FaceIndex arc2FaceIndex( const Arc2FaceIndex& de2fi,
-                             VertexIndex vi, VertexIndex vj )
+    /// An arc of a face, as stored by origin vertex in the arc table
+    /// computed by build(), which associates faces and half-edges to arcs.
+    struct FaceArc
     {
-      ASSERT( !de2fi.empty() );
+      /// The destination vertex of the arc.
+      VertexIndex to;
+      /// The face of the arc.
+      FaceIndex face;
+      /// The half-edge of the arc, once it is created.
+      Index he;
 
-      Arc2FaceIndex::const_iterator it = de2fi.find( Arc( vi, vj ) );
-      // If no such directed edge exists, then there's no such face in the mesh.
-      // The edge must be a boundary edge.
-      // In this case, the reverse orientation edge must have a face.
-      if( it == de2fi.end() )
-        {
-          ASSERT( de2fi.find( Arc( vj, vi ) ) != de2fi.end() );
-          return HALF_EDGE_INVALID_INDEX;
-        }
-      return it->second;
-    }
+      FaceArc() {}
+      FaceArc( VertexIndex aTo, FaceIndex aFace )
+        : to( aTo ), face( aFace ), he( HALF_EDGE_INVALID_INDEX ) {}
+      bool operator<( const FaceArc& other ) const
+      {
+        return ( to < other.to ) || ( ( to == other.to ) && ( face < other.face ) );
+      }
+    };
+
+    /**
+     * Builds the half-edge data structure from the given faces and
+     * edges, see build(). The arcs of the faces are sorted per origin
+     * vertex (in parallel), hence the faces of the arcs are found
+     * without any map.
+     *
+     * @tparam TFace either Triangle or PolygonalFace.
+     * @param[in] num_vertices the number of vertices.
+     * @param[in] faces the vector of input faces.
+     * @param[in] edges the vector of input unoriented edges.
+     * @return 'true' if everything went well.
+     */
+    template <typename TFace>
+    bool buildFromFaces( const Size                num_vertices,
+                         const std::vector<TFace>& faces,
+                         const std::vector<Edge>&  edges );
+
+    /// @param T any triangle.
+    /// @return its vertices.
+    static const std::array<VertexIndex,3>& faceVertices( const Triangle& T )
+    { return T.v; }
+
+    /// @param P any polygonal face.
+    /// @return its vertices.
+    static const PolygonalFace& faceVertices( const PolygonalFace& P )
+    { return P; }
+
+    /**
+     * Computes all the unoriented edges of the given faces, see
+     * getUnorderedEdgesFromTriangles and getUnorderedEdgesFromPolygonalFaces.
+     *
+     * @tparam TFace either Triangle or PolygonalFace.
+     * @param[in] faces the vector of input oriented faces.
+     * @param[out] edges_out the vector of all the unoriented edges of
+     * the given faces, in lexicographic order.
+     * @param[in] nbThreads the number of threads, 0 means ParallelFor::nbThreads().
+     * @return the total number of different vertices.
+     */
+    template <typename TFace>
+    static Size getUnorderedEdgesFromFaces
+    ( const std::vector<TFace>& faces, std::vector< Edge >& edges_out,
+      unsigned int nbThreads );
+
+    /**
+     * Sorts the given range and removes its duplicates. Slices of the
+     * range are sorted in parallel, then merged pairwise.
+     *
+     * @param[in,out] v any vector of comparable elements.
+     * @param[in] sortSlice a functor (T*, T*) that sorts a slice of @a v.
+     * @param[in] nbThreads the number of threads, 0 means ParallelFor::nbThreads().
+     */
+    template <typename T, typename TSort>
+    static void sortUnique( std::vector<T>& v, TSort sortSlice, unsigned int nbThreads );
+
+    /**
+     * Sorts the given integers by a least significant digit radix
+     * sort, in passes of 11 bits.
+     *
+     * @param[in,out] first the beginning of the range.
+     * @param[in,out] last the end of the range.
+     * @param[in] nbBits the number of significant bits of the integers.
+     */
+    static void radixSort( DGtal::uint64_t* first, DGtal::uint64_t* last, unsigned int nbBits );
         
   }; // end of class HalfEdgeDataStructure
 
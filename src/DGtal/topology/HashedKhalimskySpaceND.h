@@ -0,0 +1,210 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HashedKhalimskySpaceND.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module HashedKhalimskySpaceND
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HashedKhalimskySpaceND_RECURSES)
+#error Recursive header files inclusion detected in HashedKhalimskySpaceND.h
+#else // defined(HashedKhalimskySpaceND_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HashedKhalimskySpaceND_RECURSES
+
+#if !defined HashedKhalimskySpaceND_h
+/** Prevents repeated inclusion of headers. */
+#define HashedKhalimskySpaceND_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellPackedHash
+  /**
+   * Description of template class 'KhalimskyCellPackedHash' <p>
+   * \brief Aim: A hash functor for (signed or unsigned) Khalimsky
+   * cells, cheaper than the std::hash specializations of
+   * KhalimskyCellHashFunctions.h.
+   *
+   * Space is cut into blocks of 2^b Khalimsky coordinates along each
+   * axis (b = 9/dim, i.e. 3 in 3D and 4 in 2D). The block coordinates
+   * are packed into one 64 bits word, each one on 64/dim bits, which
+   * is then scrambled by the (bijective) finalizer of splitmix64. The
+   * hash value is this word, shifted to make room for the position of
+   * the cell in its block and for the sign of signed cells, which
+   * thus both keep their own bits: opposite signed cells, and distinct
+   * cells of the same block, never collide.
+   *
+   * These low bits are declared as \c locality_bits, so that
+   * OpenAddressingHashTable stores the cells of a block in nearby
+   * slots: adjacency queries on the cells of a set then mostly hit
+   * the cache, whatever the order in which cells are visited.
+   *
+   * @tparam TCell either KhalimskyCell or SignedKhalimskyCell.
+   */
+  template < typename TCell >
+  struct KhalimskyCellPackedHash
+  {
+    typedef TCell Cell;
+    /// The dimension of the cells.
+    static constexpr Dimension dimension = Cell::Point::dimension;
+    /// Number of bits of each coordinate within its block.
+    static constexpr unsigned int blockBits = dimension <= 9 ? 9 / dimension : 0;
+    /// Number of low bits of the hash value giving the position of a
+    /// cell in its block and its sign (see OpenAddressingHashTable).
+    static constexpr unsigned int locality_bits = blockBits * dimension + 1;
+    /// Number of bits of each block coordinate in the packed word.
+    static constexpr unsigned int shift = dimension < 64 ? 64 / dimension : 1;
+    /// Mask of the bits of one block coordinate.
+    static constexpr std::uint64_t mask = shift < 64 ? ( std::uint64_t( 1 ) << ( shift % 64 ) ) - 1 : ~std::uint64_t( 0 );
+
+    /**
+     * @param c any cell.
+     * @return the hash value of @a c.
+     */
+    std::size_t operator()( const Cell & c ) const noexcept
+    {
+      auto const & p = c.preCell();
+      std::uint64_t h = 0;
+      std::uint64_t o = 0;
+      for ( auto x : p.coordinates )
+        {
+          h = ( h << ( shift % 64 ) ) | ( static_cast< std::uint64_t >( x >> blockBits ) & mask );
+          o = ( o << blockBits ) | ( static_cast< std::uint64_t >( x ) & ( ( 1u << blockBits ) - 1 ) );
+        }
+      h = ( h ^ ( h >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+      h = ( h ^ ( h >> 27 ) ) * 0x94d049bb133111ebULL;
+      h = h ^ ( h >> 31 );
+      return static_cast< std::size_t >( ( h << locality_bits ) | ( o << 1 ) | sign( p ) );
+    }
+
+  private:
+    template < typename TPreCell >
+    static std::uint64_t sign( const TPreCell & )
+    { return 0; }
+    template < Dimension dim, typename TInteger >
+    static std::uint64_t sign( const SignedKhalimskyPreCell< dim, TInteger > & p )
+    { return p.positive ? 0 : 1; }
+  }; // end of struct KhalimskyCellPackedHash
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class HashedKhalimskySpaceND
+  /**
+   * Description of template class 'HashedKhalimskySpaceND' <p>
+   * \brief Aim: A KhalimskySpaceND whose associated containers of
+   * cells (CellSet, SCellSet, SurfelSet, CellMap, SCellMap and
+   * SurfelMap) are open addressing hash tables (OpenAddressingHashSet
+   * and OpenAddressingHashMap) instead of balanced trees.
+   *
+   * The space itself behaves exactly as KhalimskySpaceND, and it is
+   * also a model of concepts::CCellularGridSpaceND. Only the types of
+   * the containers change, so that every algorithm parameterized by
+   * the space (surface tracking in Surfaces, SetOfSurfels,
+   * ExplicitDigitalSurface, DigitalSurface, CubicalComplex, ...) uses
+   * constant-time lookups instead of logarithmic ones. Cells are hashed
+   * with KhalimskyCellPackedHash.
+   *
+   * @note The containers are not sorted: iterating over a set of cells
+   * visits them in an unspecified order. Use KhalimskySpaceND when this
+   * order matters. Furthermore, inserting cells may invalidate
+   * references to other cells of the containers (see
+   * OpenAddressingHashTable).
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   *
+   * @see testHashedKhalimskySpaceND.cpp, testHashedKhalimskySpaceND-benchmark.cpp
+   */
+  template <
+      Dimension dim,
+      typename TInteger = DGtal::int32_t
+  >
+  class HashedKhalimskySpaceND
+    : public KhalimskySpaceND< dim, TInteger >
+  {
+  public:
+    typedef KhalimskySpaceND< dim, TInteger > Base;
+    typedef HashedKhalimskySpaceND< dim, TInteger > CellularGridSpace;
+
+    typedef typename Base::Cell Cell;
+    typedef typename Base::SCell SCell;
+    typedef typename Base::Surfel Surfel;
+
+    // Sets, Maps
+    /// Preferred type for defining a set of Cell(s).
+    typedef OpenAddressingHashSet< Cell, KhalimskyCellPackedHash< Cell > > CellSet;
+
+    /// Preferred type for defining a set of SCell(s).
+    typedef OpenAddressingHashSet< SCell, KhalimskyCellPackedHash< SCell > > SCellSet;
+
+    /// Preferred type for defining a set of surfels (always signed cells).
+    typedef OpenAddressingHashSet< SCell, KhalimskyCellPackedHash< SCell > > SurfelSet;
+
+    /// Template rebinding for defining the type that is a mapping
+    /// Cell -> Value.
+    template <typename Value> struct CellMap {
+        typedef OpenAddressingHashMap< Cell, Value, KhalimskyCellPackedHash< Cell > > Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SCellMap {
+        typedef OpenAddressingHashMap< SCell, Value, KhalimskyCellPackedHash< SCell > > Type;
+    };
+
+    /// Template rebinding for defining the type that is a mapping
+    /// SCell -> Value.
+    template <typename Value> struct SurfelMap {
+        typedef OpenAddressingHashMap< SCell, Value, KhalimskyCellPackedHash< SCell > > Type;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    using Base::Base;
+
+    /// Default constructor.
+    HashedKhalimskySpaceND() = default;
+
+  }; // end of class HashedKhalimskySpaceND
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HashedKhalimskySpaceND_h
+
+#undef HashedKhalimskySpaceND_RECURSES
+#endif // else defined(HashedKhalimskySpaceND_RECURSES)
@@ -47,8 +47,10 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/OwningOrAliasingPtr.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
 #include "DGtal/topology/HalfEdgeDataStructure.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/KhalimskyCellHashFunctions.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -677,11 +679,11 @@ namespace DGtal
     /// Stores the polygonal faces.
     PolygonalFacesStorage myPolygonalFaces;
     /// Mapping Surfel ->  VertexIndex
-    std::map< SCell, VertexIndex > mySurfel2VertexIndex;
+    OpenAddressingHashMap< SCell, VertexIndex > mySurfel2VertexIndex;
     /// Mapping Linel  -> Arc
-    std::map< SCell, Arc >         myLinel2Arc;
+    OpenAddressingHashMap< SCell, Arc >         myLinel2Arc;
     /// Mapping Pointel -> FaceIndex
-    std::map< SCell, FaceIndex >   myPointel2FaceIndex;
+    OpenAddressingHashMap< SCell, FaceIndex >   myPointel2FaceIndex;
     /// Mapping VertexIndex -> Surfel
     SCellStorage          myVertexIndex2Surfel;
     /// Mapping Arc         -> Linel
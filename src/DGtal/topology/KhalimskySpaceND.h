@@ -70,6 +70,13 @@ namespace DGtal
   template < class TKhalimskySpace >
   class KhalimskySpaceNDHelper;
 
+  /// Packed encoding of Khalimsky cells (see PackedKhalimskySpaceND.h).
+  template <
+      Dimension dim,
+      typename TInteger = DGtal::int32_t
+  >
+  class KhalimskyCellPacking;
+
   /////////////////////////////////////////////////////////////////////////////
   /**
    * @brief Represents an (unsigned) cell in a cellular grid space by its
@@ -99,6 +106,7 @@ namespace DGtal
     // Friendship
     friend class KhalimskySpaceND< dim, TInteger >;
     friend class KhalimskySpaceNDHelper< CellularGridSpace >;
+    friend class KhalimskyCellPacking< dim, TInteger >;
 
   private:
     /// Underlying pre-cell
@@ -223,6 +231,7 @@ namespace DGtal
     // Friendship
     friend class KhalimskySpaceND< dim, TInteger >;
     friend class KhalimskySpaceNDHelper< CellularGridSpace >;
+    friend class KhalimskyCellPacking< dim, TInteger >;
 
   private:
     /// Underlying signed pre-cell
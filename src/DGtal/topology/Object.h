@@ -56,6 +56,7 @@
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/topology/Topology.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
 #include <boost/graph/graph_traits.hpp>
 #include <boost/graph/properties.hpp>
 #include <boost/dynamic_bitset.hpp>
@@ -419,6 +420,11 @@ namespace DGtal
       @param it the output iterator. *it is an Object.
       @return the number of components.
 
+      When the foreground adjacency is a MetricAdjacency, components
+      are computed by a ConnectedComponentLabelling of the bounding
+      box of the object (unless it is too sparse) and are written in
+      the raster order of their first point.
+
 NB: Be careful that the [it] should not be an output iterator
 pointing in the same container containing 'this'. The following
 example might make a 'bus error' because the vector might be
@@ -674,6 +680,21 @@ objects[ 0 ].writeComponents( it ); // it points in same container as this.
      */
     bool myTableIsLoaded;
 
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Labels the components of this object with a raster scan (see
+     * ConnectedComponentLabelling). It is done only if the foreground
+     * adjacency is a MetricAdjacency and if the bounding box of the
+     * object has at most 64 times more points than the object, other
+     * objects being better handled by breadth-first traversals.
+     *
+     * @return the labelling of the object in its bounding box, or a
+     * null pointer if the labelling has not been done.
+     */
+    CountedPtr< ConnectedComponentLabelling< Space > > labelComponents() const;
+
     // --------------- CDrawableWithBoard2D realization ------------------
   public:
     /**
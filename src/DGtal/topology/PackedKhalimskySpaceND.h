@@ -0,0 +1,711 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedKhalimskySpaceND.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module PackedKhalimskySpaceND
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedKhalimskySpaceND_RECURSES)
+#error Recursive header files inclusion detected in PackedKhalimskySpaceND.h
+#else // defined(PackedKhalimskySpaceND_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedKhalimskySpaceND_RECURSES
+
+#if !defined PackedKhalimskySpaceND_h
+/** Prevents repeated inclusion of headers. */
+#define PackedKhalimskySpaceND_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/HashedKhalimskySpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class KhalimskyCellPacking
+  /**
+   * Description of template class 'KhalimskyCellPacking' <p>
+   * \brief Aim: Encodes (signed or unsigned) Khalimsky cells as a
+   * single 64 bits word, and provides the most common cell operations
+   * (incidence, adjacency, sign, dimension) as integer arithmetic on
+   * these codes.
+   *
+   * Each Khalimsky coordinate \f$ x_k \f$ is stored, shifted by \a
+   * bias, on \a bits = 63/dim bits (21 bits in 3D, 31 bits in 2D)
+   * starting at bit \f$ k \times bits \f$, and the sign of a signed
+   * cell is the most significant bit (set for positive cells). Since
+   * \a bias is even, the parity of a coordinate, i.e. whether the cell
+   * is open along this axis, is the lowest bit of its field. Hence:
+   * - equality and hashing of cells are the ones of 64 bits integers,
+   *   and codes may be sorted as integers (which is a total order on
+   *   cells, but not the lexicographic order of Cell::operator<);
+   * - moving along axis \a k adds or subtracts \f$ 2^{k \times bits}
+   *   \f$ to the code;
+   * - the sign changes of sIncident, sDirectIncident, ... only depend
+   *   on the parities of the first coordinates.
+   *
+   * Only cells whose Khalimsky coordinates lie in \f$ [-bias, bias[
+   * \f$ can be encoded (see isPackable). As for KhalimskyPreSpaceND,
+   * the operations on codes do not take into account the bounds and the
+   * periodicity of a KhalimskySpaceND: the caller is responsible for
+   * staying in the space.
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used for the coordinates of the cells.
+   *
+   * @see PackedKhalimskySpaceND
+   */
+  template <
+      Dimension dim,
+      typename TInteger
+  >
+  class KhalimskyCellPacking
+  {
+    BOOST_STATIC_ASSERT(( dim >= 1 && dim <= 31 ));
+
+  public:
+    typedef TInteger Integer;
+    typedef std::uint64_t Code;
+    typedef KhalimskyCell< dim, Integer > Cell;
+    typedef SignedKhalimskyCell< dim, Integer > SCell;
+    typedef typename Cell::Point Point;
+    typedef KhalimskySpaceND< dim, Integer > KSpace;
+
+    static constexpr Dimension dimension = dim;
+    /// Number of bits of each coordinate in a code.
+    static constexpr unsigned int bits = 63 / dim;
+    /// Shift applied to the coordinates so that they are stored as non-negative numbers.
+    static constexpr std::int64_t bias = std::int64_t( 1 ) << ( bits - 1 );
+    /// Mask of the bits of one coordinate.
+    static constexpr Code fieldMask = ( Code( 1 ) << bits ) - 1;
+    /// Bit of the sign of a signed cell (set for positive cells).
+    static constexpr Code signBit = Code( 1 ) << 63;
+
+    /// A hash functor on codes (the bijective finalizer of splitmix64).
+    struct Hash
+    {
+      std::size_t operator()( Code c ) const noexcept
+      {
+        c = ( c ^ ( c >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+        c = ( c ^ ( c >> 27 ) ) * 0x94d049bb133111ebULL;
+        return static_cast< std::size_t >( c ^ ( c >> 31 ) );
+      }
+    };
+
+    // ----------------------- Encoding services ------------------------------
+  public:
+    /**
+     * @param kp any Khalimsky coordinates.
+     * @return 'true' iff a cell with these coordinates can be encoded.
+     */
+    static bool isPackable( const Point & kp );
+
+    /**
+     * @param K any Khalimsky space.
+     * @return 'true' iff all the cells of @a K, as well as the ones
+     * incident or adjacent to them, can be encoded.
+     */
+    static bool isPackable( const KSpace & K );
+
+    /**
+     * @param c any unsigned cell (with packable coordinates).
+     * @return its code.
+     */
+    static Code encode( const Cell & c );
+
+    /**
+     * @param c any signed cell (with packable coordinates).
+     * @return its code.
+     */
+    static Code encode( const SCell & c );
+
+    /**
+     * @param code the code of an unsigned cell.
+     * @return the cell.
+     */
+    static Cell uDecode( Code code );
+
+    /**
+     * @param code the code of a signed cell.
+     * @return the cell.
+     */
+    static SCell sDecode( Code code );
+
+    /**
+     * Decodes an unsigned cell (overloaded version of uDecode).
+     * @param code the code of an unsigned cell.
+     * @param[out] c the cell.
+     */
+    static void decode( Code code, Cell & c );
+
+    /**
+     * Decodes an unsigned cell (overloaded version of uDecode).
+     * @param code the code of an unsigned cell.
+     * @param c any unsigned cell (only used to select the overload).
+     * @return the cell.
+     */
+    static Cell decode( Code code, const Cell & c );
+
+    /**
+     * Decodes a signed cell (overloaded version of sDecode).
+     * @param code the code of a signed cell.
+     * @param[out] c the cell.
+     */
+    static void decode( Code code, SCell & c );
+
+    /**
+     * Decodes a signed cell (overloaded version of sDecode).
+     * @param code the code of a signed cell.
+     * @param c any signed cell (only used to select the overload).
+     * @return the cell.
+     */
+    static SCell decode( Code code, const SCell & c );
+
+    // ----------------------- Read accessors ------------------------------
+  public:
+    /**
+     * @param code the code of any cell.
+     * @param k any valid dimension.
+     * @return its Khalimsky coordinate along @a k.
+     */
+    static Integer kCoord( Code code, Dimension k );
+
+    /**
+     * @param code the code of any cell.
+     * @return its Khalimsky coordinates.
+     */
+    static Point kCoords( Code code );
+
+    /**
+     * @param code the code of any cell.
+     * @param k any valid dimension.
+     * @return 'true' iff the cell is open along @a k.
+     */
+    static bool isOpen( Code code, Dimension k );
+
+    /**
+     * @param code the code of any cell.
+     * @return the dimension of the cell.
+     */
+    static Dimension dimensionOf( Code code );
+
+    /**
+     * @param code the code of a signed cell.
+     * @return 'true' iff the cell is positive.
+     */
+    static bool sSign( Code code );
+
+    /**
+     * @param code the code of a signed cell.
+     * @return the code of its opposite cell.
+     */
+    static Code sOpp( Code code );
+
+    /**
+     * @param code the code of a signed cell.
+     * @return the code of the associated unsigned cell.
+     */
+    static Code unsigns( Code code );
+
+    /**
+     * @param code the code of an unsigned cell.
+     * @param positive the sign of the signed cell.
+     * @return the code of the associated signed cell.
+     */
+    static Code signs( Code code, bool positive );
+
+    // ----------------------- Neighborhood and incidence services -----------
+  public:
+    /**
+     * @param code the code of an unsigned cell.
+     * @param k any valid dimension.
+     * @param up if 'true' the orientation is forward along axis
+     * @a k, otherwise backward.
+     * @return the code of the adjacent cell along @a k (see KhalimskyPreSpaceND::uAdjacent).
+     */
+    static Code uAdjacent( Code code, Dimension k, bool up );
+
+    /**
+     * @param code the code of a signed cell.
+     * @param k any valid dimension.
+     * @param up if 'true' the orientation is forward along axis
+     * @a k, otherwise backward.
+     * @return the code of the adjacent cell along @a k (see KhalimskyPreSpaceND::sAdjacent).
+     */
+    static Code sAdjacent( Code code, Dimension k, bool up );
+
+    /**
+     * @param code the code of an unsigned cell.
+     * @param k any valid dimension.
+     * @param up if 'true' the orientation is forward along axis
+     * @a k, otherwise backward.
+     * @return the code of the incident cell along @a k (see KhalimskyPreSpaceND::uIncident).
+     */
+    static Code uIncident( Code code, Dimension k, bool up );
+
+    /**
+     * @param code the code of a signed cell.
+     * @param k any valid dimension.
+     * @param up if 'true' the orientation is forward along axis
+     * @a k, otherwise backward.
+     * @return the code of the signed incident cell along @a k (see KhalimskyPreSpaceND::sIncident).
+     */
+    static Code sIncident( Code code, Dimension k, bool up );
+
+    /**
+     * @param code the code of a signed cell.
+     * @param k any valid dimension.
+     * @return the direct orientation of the cell along @a k (see KhalimskyPreSpaceND::sDirect).
+     */
+    static bool sDirect( Code code, Dimension k );
+
+    /**
+     * @param code the code of a signed cell.
+     * @param k any valid dimension.
+     * @return the code of the direct incident cell along @a k (see KhalimskyPreSpaceND::sDirectIncident).
+     */
+    static Code sDirectIncident( Code code, Dimension k );
+
+    /**
+     * @param code the code of a signed cell.
+     * @param k any valid dimension.
+     * @return the code of the indirect incident cell along @a k (see KhalimskyPreSpaceND::sIndirectIncident).
+     */
+    static Code sIndirectIncident( Code code, Dimension k );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// @return the code of a move of one unit along @a k.
+    static Code unit( Dimension k );
+
+    /// @return the parity of the number of open coordinates among the first k+1 ones.
+    static Code parity( Code code, Dimension k );
+
+  }; // end of class KhalimskyCellPacking
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedKhalimskyCellSet
+  /**
+   * Description of template class 'PackedKhalimskyCellSet' <p>
+   * \brief Aim: A set of (signed or unsigned) Khalimsky cells which
+   * stores the codes of its cells (see KhalimskyCellPacking) in an
+   * OpenAddressingHashSet. In 3D, it thus uses half the memory of an
+   * OpenAddressingHashSet of cells (9 bytes per slot instead of 17).
+   *
+   * Model of concepts::CSTLAssociativeContainer, as a unique and
+   * simple unordered associative container. Its iterators are constant
+   * and decode the cells on the fly: dereferencing them returns a cell
+   * by value, not a reference.
+   *
+   * @tparam TCell either KhalimskyCell or SignedKhalimskyCell.
+   */
+  template < typename TCell >
+  class PackedKhalimskyCellSet
+  {
+  public:
+    typedef TCell Cell;
+    typedef KhalimskyCellPacking< Cell::Point::dimension, typename Cell::Integer > Packing;
+    typedef typename Packing::Code Code;
+    typedef OpenAddressingHashSet< Code, typename Packing::Hash > CodeSet;
+
+    typedef Cell key_type;
+    typedef Cell value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Cell reference;
+    typedef Cell const_reference;
+
+    /// Constant iterator on the cells, which decodes the codes of the
+    /// underlying set on the fly.
+    class ConstIterator
+    {
+    public:
+      friend class PackedKhalimskyCellSet;
+      typedef std::forward_iterator_tag iterator_category;
+      typedef Cell value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef Cell reference;
+
+      /// Holds a decoded cell to provide operator->.
+      struct pointer
+      {
+        Cell myCell;
+        const Cell * operator->() const { return &myCell; }
+      };
+
+      /// Default constructor (singular iterator).
+      ConstIterator() = default;
+
+      /// @return the current cell.
+      reference operator*() const { return Packing::decode( *myIt, Cell() ); }
+      /// @return a pointer-like object on the current cell.
+      pointer operator->() const { return pointer{ **this }; }
+
+      /// Pre-increment operator.
+      /// @return a reference to itself.
+      ConstIterator & operator++()
+      {
+        ++myIt;
+        return *this;
+      }
+
+      /// Post-increment operator.
+      /// @return the iterator before incrementation.
+      ConstIterator operator++( int )
+      {
+        ConstIterator tmp( *this );
+        ++myIt;
+        return tmp;
+      }
+
+      /// @param other any other iterator.
+      /// @return 'true' iff the iterators points on the same code.
+      bool operator==( const ConstIterator & other ) const
+      { return myIt == other.myIt; }
+
+      /// @param other any other iterator.
+      /// @return 'true' iff the iterators points on different codes.
+      bool operator!=( const ConstIterator & other ) const
+      { return myIt != other.myIt; }
+
+    private:
+      /// Constructor. Internal. Used by PackedKhalimskyCellSet.
+      explicit ConstIterator( typename CodeSet::const_iterator it )
+        : myIt( it ) {}
+
+      typename CodeSet::const_iterator myIt; ///< The iterator on the codes.
+    };
+
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+    typedef typename ConstIterator::pointer pointer;
+    typedef typename ConstIterator::pointer const_pointer;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /// Default constructor (empty set).
+    PackedKhalimskyCellSet() = default;
+
+    /**
+     * Constructor from a range of cells.
+     * @tparam InputIterator a model of input iterator on cells.
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template < typename InputIterator >
+    PackedKhalimskyCellSet( InputIterator first, InputIterator last );
+
+    /// @return a (constant) iterator on the first cell.
+    const_iterator begin() const;
+    /// @return a (constant) iterator after the last cell.
+    const_iterator end() const;
+    /// @return a constant iterator on the first cell.
+    const_iterator cbegin() const;
+    /// @return a constant iterator after the last cell.
+    const_iterator cend() const;
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const;
+    /// @return the number of cells.
+    size_type size() const;
+    /// @return the maximal number of cells.
+    size_type max_size() const;
+    /// @return the number of slots of the underlying table.
+    size_type bucket_count() const;
+
+    /// Removes all the cells.
+    void clear();
+
+    /**
+     * Prepares the set for @a n cells.
+     * @param n the expected number of cells.
+     */
+    void reserve( size_type n );
+
+    /**
+     * Swaps the content of two sets.
+     * @param other any other set.
+     */
+    void swap( PackedKhalimskyCellSet & other );
+
+    /**
+     * Inserts a cell.
+     * @param c any cell (with packable coordinates).
+     * @return an iterator on the cell and 'true' iff it was inserted.
+     */
+    std::pair< iterator, bool > insert( const Cell & c );
+
+    /**
+     * Inserts a cell (the hint is ignored).
+     * @param hint any iterator.
+     * @param c any cell (with packable coordinates).
+     * @return an iterator on the cell.
+     */
+    iterator insert( const_iterator hint, const Cell & c );
+
+    /**
+     * Inserts a range of cells.
+     * @tparam InputIterator a model of input iterator on cells.
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     */
+    template < typename InputIterator >
+    void insert( InputIterator first, InputIterator last );
+
+    /**
+     * Removes a cell.
+     * @param pos a valid iterator on a cell of the set.
+     * @return an iterator after the removed cell.
+     */
+    iterator erase( const_iterator pos );
+
+    /**
+     * Removes a range of cells.
+     * @param first the beginning of the range.
+     * @param last the end of the range.
+     * @return an iterator after the removed cells.
+     */
+    iterator erase( const_iterator first, const_iterator last );
+
+    /**
+     * Removes a cell.
+     * @param c any cell.
+     * @return the number of removed cells (0 or 1).
+     */
+    size_type erase( const Cell & c );
+
+    /**
+     * @param c any cell.
+     * @return an iterator on @a c, or end() if it is not in the set.
+     */
+    const_iterator find( const Cell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return the number of occurences of @a c (0 or 1).
+     */
+    size_type count( const Cell & c ) const;
+
+    /**
+     * @param c any cell.
+     * @return the range of the cells equal to @a c.
+     */
+    std::pair< const_iterator, const_iterator > equal_range( const Cell & c ) const;
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff both sets contain the same cells.
+     */
+    bool operator==( const PackedKhalimskyCellSet & other ) const;
+
+    /**
+     * @param other any other set.
+     * @return 'true' iff the sets differ.
+     */
+    bool operator!=( const PackedKhalimskyCellSet & other ) const;
+
+    /**
+     * Gives access to the codes of the cells, e.g. for algorithms
+     * working directly with the operations of KhalimskyCellPacking.
+     * @return the underlying set of codes.
+     */
+    const CodeSet & codes() const;
+
+    /**
+     * Gives access to the codes of the cells, e.g. for algorithms
+     * working directly with the operations of KhalimskyCellPacking.
+     * @return the underlying set of codes.
+     */
+    CodeSet & codes();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The codes of the cells.
+    CodeSet myCodes;
+
+  }; // end of class PackedKhalimskyCellSet
+
+  /// Defines container traits for PackedKhalimskyCellSet<>.
+  template < typename TCell >
+  struct ContainerTraits< PackedKhalimskyCellSet< TCell > >
+  {
+    typedef UnorderedSetAssociativeCategory Category;
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedKhalimskySpaceND
+  /**
+   * Description of template class 'PackedKhalimskySpaceND' <p>
+   * \brief Aim: A KhalimskySpaceND whose sets of cells (CellSet,
+   * SCellSet and SurfelSet) store packed 64 bits codes of cells (see
+   * KhalimskyCellPacking and PackedKhalimskyCellSet), the maps of
+   * cells being the ones of HashedKhalimskySpaceND.
+   *
+   * Cells and every service of the space are the ones of
+   * KhalimskySpaceND, hence it is a model of
+   * concepts::CCellularGridSpaceND and the surface classes (Surfaces,
+   * SetOfSurfels, DigitalSurface, ...) work unchanged, using half the
+   * memory of HashedKhalimskySpaceND for their sets of surfels.
+   * Algorithms may also work directly on the codes of the cells with
+   * the integer operations of KhalimskyCellPacking.
+   *
+   * The bounds of the space must be such that all its cells are
+   * packable: init returns 'false' otherwise (e.g. in 3D, digital
+   * coordinates must roughly lie in \f$ [-2^{19}, 2^{19}[ \f$).
+   *
+   * @tparam dim the dimension of the digital space.
+   * @tparam TInteger the Integer class used to specify the arithmetic computations (default type = int32).
+   *
+   * @see testPackedKhalimskySpaceND.cpp, testPackedKhalimskySpaceND-benchmark.cpp
+   */
+  template <
+      Dimension dim,
+      typename TInteger = DGtal::int32_t
+  >
+  class PackedKhalimskySpaceND
+    : public HashedKhalimskySpaceND< dim, TInteger >
+  {
+  public:
+    typedef HashedKhalimskySpaceND< dim, TInteger > Base;
+    typedef PackedKhalimskySpaceND< dim, TInteger > CellularGridSpace;
+    typedef KhalimskyCellPacking< dim, TInteger > Packing;
+    typedef typename Packing::Code Code;
+
+    typedef typename Base::Point Point;
+    typedef typename Base::Cell Cell;
+    typedef typename Base::SCell SCell;
+    typedef typename Base::Surfel Surfel;
+    typedef typename Base::Closure Closure;
+
+    // Sets
+    /// Preferred type for defining a set of Cell(s).
+    typedef PackedKhalimskyCellSet< Cell > CellSet;
+
+    /// Preferred type for defining a set of SCell(s).
+    typedef PackedKhalimskyCellSet< SCell > SCellSet;
+
+    /// Preferred type for defining a set of surfels (always signed cells).
+    typedef PackedKhalimskyCellSet< SCell > SurfelSet;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+    /// Default constructor.
+    PackedKhalimskySpaceND() = default;
+
+    /**
+     * Specifies the bounds of the space (see KhalimskySpaceND::init).
+     *
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param isClosed 'true' if this space is closed and non-periodic in every dimension, 'false' if open.
+     *
+     * @return true if the initialization was valid (ie, such bounds
+     * are representable with these integers and all cells are packable).
+     */
+    bool init( const Point & lower,
+               const Point & upper,
+               bool isClosed );
+
+    /**
+     * Specifies the bounds of the space (see KhalimskySpaceND::init).
+     *
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param closure \a CLOSED, \a OPEN or \a PERIODIC if this space is resp. closed (and non-periodic),
+     *        open or periodic in every dimension.
+     *
+     * @return true if the initialization was valid (ie, such bounds
+     * are representable with these integers and all cells are packable).
+     */
+    bool init( const Point & lower,
+               const Point & upper,
+               Closure closure );
+
+    /**
+     * Specifies the bounds of the space (see KhalimskySpaceND::init).
+     *
+     * @param lower the lowest point in this space (digital coords)
+     * @param upper the upper point in this space (digital coords)
+     * @param closure an array of \a CLOSED, \a OPEN or \a PERIODIC if this space is resp. closed (and non-periodic),
+     *        open or periodic in the corresponding dimension.
+     *
+     * @return true if the initialization was valid (ie, such bounds
+     * are representable with these integers and all cells are packable).
+     */
+    bool init( const Point & lower,
+               const Point & upper,
+               const std::array< Closure, dim > & closure );
+
+  }; // end of class PackedKhalimskySpaceND
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedKhalimskyCellSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedKhalimskyCellSet' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TCell >
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedKhalimskyCellSet< TCell > & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/PackedKhalimskySpaceND.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedKhalimskySpaceND_h
+
+#undef PackedKhalimskySpaceND_RECURSES
+#endif // else defined(PackedKhalimskySpaceND_RECURSES)
@@ -189,6 +189,43 @@ namespace DGtal
       const PointPredicate & pp,
       const SCell & start_surfel );
 
+    /**
+       Parallel version of trackBoundary. The tracking is a breadth
+       first traversal processed level by level: the surfels adjacent
+       to the surfels of the current level are computed by several
+       threads (see ParallelFor), each one filtering the surfels
+       already in [surface], which is only read during this step. They
+       are then inserted in [surface] in the order of the level, so
+       that the surfels are inserted in the same order as trackBoundary
+       does, whatever the number of threads.
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>)
+       whose const methods may be called concurrently.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       whose operator() may be called concurrently.
+
+       @param surface (modified) a set of cells (which are all surfels),
+       the boundary component of [spelset] which touches [start_surfel].
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param start_surfel a signed surfel which should be between an
+       element of [shape] and an element not in [shape].
+       @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+       @param tileSize the number of surfels of a level processed by a
+       thread at once.
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static
+    void trackBoundary( SCellSet & surface,
+      const KSpace & K,
+      const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+      const PointPredicate & pp,
+      const SCell & start_surfel,
+      unsigned int nbThreads,
+      std::size_t tileSize = 1024 );
+
     /**
        Function that extracts the \b closed boundary of a nD digital
        shape (specified by a predicate on point), in a nD KSpace. The
@@ -264,6 +301,38 @@ namespace DGtal
                        const SurfelPredicate & pp,
                        const SCell & start_surfel );
 
+    /**
+       Parallel version of trackSurface, processed level by level as
+       the parallel version of trackBoundary. The surfels are inserted
+       in the same order as trackSurface does, whatever the number of
+       threads.
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>)
+       whose const methods may be called concurrently.
+       @tparam SurfelPredicate a model of CSurfelPredicate whose
+       operator() may be called concurrently.
+
+       @param surface (modified) a set of cells (which are all surfels),
+       the boundary component of [spelset] which touches [start_surfel].
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of CSurfelPredicate.
+       @param start_surfel a signed surfel which should be part of the
+       surface, ie. 'sp(start_surfel)==true'.
+       @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+       @param tileSize the number of surfels of a level processed by a
+       thread at once.
+    */
+    template <typename SCellSet, typename SurfelPredicate >
+    static
+    void trackSurface( SCellSet & surface,
+                       const KSpace & K,
+                       const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                       const SurfelPredicate & pp,
+                       const SCell & start_surfel,
+                       unsigned int nbThreads,
+                       std::size_t tileSize = 1024 );
+
     /**
        Function that extracts a \b closed n-1 digital surface
        (specified by a predicate on surfel) in a nD KSpace. The
@@ -623,6 +692,37 @@ namespace DGtal
       const PointPredicate & pp,
       bool forceOrientCellExterior=false );
 
+    /**
+       Parallel version of extractAllConnectedSCell. The components
+       are computed by sMakeBoundaryComponents with [nbThreads]
+       threads instead of being tracked one after the other. The
+       result is the same as extractAllConnectedSCell: each component
+       is sorted, and the components are sorted by their first surfel.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       whose operator() may be called concurrently.
+
+       @param aVectConnectedSCell (modified) a vector containing for
+       each connected components a vector of the sequence of connected
+       SCells.
+       @param aKSpace any space.
+       @param aSurfelAdj the surfel adjacency chosen for the tracking.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param forceOrientCellExterior if 'true', used to change the
+       default cell orientation in order to get the direction of shape
+       exterior.
+       @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+    */
+    template <typename PointPredicate >
+    static
+    void extractAllConnectedSCell
+    ( std::vector< std::vector<SCell> > & aVectConnectedSCell,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+      const PointPredicate & pp,
+      bool forceOrientCellExterior,
+      unsigned int nbThreads );
+
     
     
 
@@ -717,6 +817,86 @@ namespace DGtal
                         const Point & aLowerBound, 
                         const Point & aUpperBound  );
 
+    /**
+       Parallel version of sMakeBoundary. The box is cut into slabs
+       along its last axis (one slab per coordinate), which are
+       scanned by several threads (see ParallelFor), each slab
+       collecting its surfels in its own buffer. The buffers are then
+       inserted in [aBoundary] in the order of the slabs, which does
+       not depend on the number of threads.
+
+       @tparam SCellSet a model of a set of SCell (e.g., std::set<SCell>).
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       whose operator() may be called concurrently.
+
+       @param aBoundary (modified) a set of cells (which are all surfels),
+       the boundary component of [aSpelSet].
+       @param aKSpace any space.
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+       @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+    */
+    template <typename SCellSet, typename PointPredicate >
+    static
+    void sMakeBoundary( SCellSet & aBoundary,
+                        const KSpace & aKSpace,
+                        const PointPredicate & pp,
+                        const Point & aLowerBound,
+                        const Point & aUpperBound,
+                        unsigned int nbThreads );
+
+    /**
+       Extracts all the boundary components of a digital shape
+       described by the predicate [pp] in one pass: the boundary
+       surfels between points of the box [aLowerBound,aUpperBound] are
+       enumerated by scanning the box once (as in sMakeBoundary), then
+       the surfels adjacent according to [aSurfelAdj] are merged with a
+       union-find, in time almost linear in the number of points and
+       surfels. Contrary to the tracking methods, it does not need a
+       starting bel and the result does not depend on any random
+       choice.
+
+       The box is scanned slab by slab along its last axis (see the
+       parallel version of sMakeBoundary) and the adjacent surfels are
+       computed with [nbThreads] threads. Components are numbered in
+       the order of their first surfel in the scan (by slab, then by
+       orthogonal direction, then in the order of the slab), and the
+       surfels of a component follow the same order, whatever the
+       number of threads.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate describing
+       the inside of a digital shape, meaning a functor taking a Point
+       and returning 'true' whenever the point belongs to the shape.
+
+       @param[out] aComponents the vector of the boundary components,
+       each one given as the vector of its surfels (oriented as in
+       sMakeBoundary).
+
+       @param aKSpace any space.
+       @param aSurfelAdj the surfel adjacency (which gives the
+       linking between surfels).
+       @param pp an instance of a model of concepts::CPointPredicate, for
+       instance a SetPredicate for a digital set representing a shape.
+
+       @param aLowerBound and @param aUpperBound points giving the
+       bounds of the extracted boundary.
+
+       @param nbThreads the number of threads (default 1), 0 for
+       ParallelFor::nbThreads().
+
+       @return the number of components.
+    */
+    template <typename PointPredicate>
+    static
+    std::size_t sMakeBoundaryComponents( std::vector< std::vector<SCell> > & aComponents,
+                                         const KSpace & aKSpace,
+                                         const SurfelAdjacency<KSpace::dimension> & aSurfelAdj,
+                                         const PointPredicate & pp,
+                                         const Point & aLowerBound,
+                                         const Point & aUpperBound,
+                                         unsigned int nbThreads = 1 );
+
     /**
        Writes on the output iterator @a out_it the unsigned surfels
        whose elements represents all the boundary elements of a
@@ -896,6 +1076,53 @@ namespace DGtal
 
   private:
 
+    /**
+       Scans the slabs of the box [aLowerBound,aUpperBound] along its
+       last axis in parallel and collects the boundary surfels of each
+       slab, in the order of the slab (by orthogonal direction, then
+       in the order of the slab).
+
+       @param[out] slabs the surfels of each slab.
+       @param aKSpace any space.
+       @param pp any point predicate.
+       @param aLowerBound and @param aUpperBound the bounds of the box.
+       @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+    */
+    template <typename PointPredicate>
+    static
+    void sCollectBoundarySlabs( std::vector< std::vector<SCell> > & slabs,
+                                const KSpace & aKSpace,
+                                const PointPredicate & pp,
+                                const Point & aLowerBound,
+                                const Point & aUpperBound,
+                                unsigned int nbThreads );
+
+    /**
+       Level by level parallel breadth-first tracking of surfels,
+       shared by the parallel versions of trackBoundary and
+       trackSurface.
+
+       @param surface (modified) the tracked surfels.
+       @param K any space.
+       @param surfel_adj the surfel adjacency chosen for the tracking.
+       @param start_surfel the starting surfel.
+       @param adjacent a functor (SurfelNeighborhood, SCell &, Dimension,
+       bool) -> bool giving the adjacent surfel of the surfel of the
+       neighborhood along a direction, if any.
+       @param nbThreads the number of threads, 0 for ParallelFor::nbThreads().
+       @param tileSize the number of surfels of a level processed by a
+       thread at once.
+    */
+    template <typename SCellSet, typename AdjacentFunctor>
+    static
+    void trackInParallel( SCellSet & surface,
+                          const KSpace & K,
+                          const SurfelAdjacency<KSpace::dimension> & surfel_adj,
+                          const SCell & start_surfel,
+                          const AdjacentFunctor & adjacent,
+                          unsigned int nbThreads,
+                          std::size_t tileSize );
+
     /**
      * Copy constructor.
      * @param other the object to clone.
@@ -0,0 +1,139 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCompressedRanges.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class CompressedRanges.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CompressedRanges.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef CompressedRanges< std::size_t > Ranges;
+typedef std::vector< std::vector< std::size_t > > VectorOfVectors;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class CompressedRanges.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "CompressedRanges basic services", "[compressedranges]" )
+{
+  Ranges R;
+  REQUIRE( R.isValid() );
+  REQUIRE( R.empty() );
+  R.push_back( { 0, 1, 2 } );
+  R.push_back( { } );
+  R.push_back( { 2, 1, 3 } );
+  REQUIRE( R.isValid() );
+  REQUIRE( R.size() == 3 );
+  REQUIRE( R.nbValues() == 6 );
+  REQUIRE( R.rangeSize( 1 ) == 0 );
+  REQUIRE( R[ 1 ].empty() );
+  REQUIRE( R[ 2 ].size() == 3 );
+  REQUIRE( R[ 2 ][ 0 ] == 2 );
+  REQUIRE( R[ 2 ].front() == 2 );
+  REQUIRE( R[ 2 ].back() == 3 );
+  std::vector< std::size_t > copy = R[ 0 ];
+  REQUIRE( copy == std::vector< std::size_t >( { 0, 1, 2 } ) );
+  std::size_t nb = 0;
+  for ( auto range : R )
+    for ( auto v : range )
+      nb += v;
+  REQUIRE( nb == 9 );
+  REQUIRE( R.end() - R.begin() == 3 );
+
+  const VectorOfVectors V = R;
+  const Ranges R2( V.begin(), V.end() );
+  REQUIRE( R2 == R );
+
+  const Ranges T = R.transpose( 4 );
+  REQUIRE( T.isValid() );
+  const VectorOfVectors expected = { { 0 }, { 0, 2 }, { 0, 2 }, { 2 } };
+  REQUIRE( VectorOfVectors( T ) == expected );
+
+  R.clear();
+  REQUIRE( R.isValid() );
+  REQUIRE( R.size() == 0 );
+}
+
+TEST_CASE( "CompressedRanges counting sort", "[compressedranges]" )
+{
+  // Random pairs (range, value), with duplicates.
+  const std::size_t nbRanges = 1000;
+  const std::size_t nbItems  = 50000;
+  std::mt19937 gen( 17 );
+  std::uniform_int_distribution< std::size_t > dist( 0, nbRanges - 1 );
+  std::vector< std::pair< std::size_t, std::size_t > > pairs( nbItems );
+  for ( auto & p : pairs )
+    p = std::make_pair( dist( gen ), dist( gen ) % 50 );
+  VectorOfVectors expected( nbRanges );
+  for ( const auto & p : pairs )
+    expected[ p.first ].push_back( p.second );
+  auto generator = [&pairs] ( std::size_t i, Ranges::Inserter & ins )
+                   { ins( pairs[ i ].first, pairs[ i ].second ); };
+
+  SECTION( "Item order with one thread" )
+    {
+      Ranges R;
+      R.assign( nbRanges, nbItems, generator, Ranges::UNSORTED, 1 );
+      REQUIRE( R.isValid() );
+      REQUIRE( VectorOfVectors( R ) == expected );
+    }
+  VectorOfVectors sorted = expected;
+  for ( auto & v : sorted )
+    std::sort( v.begin(), v.end() );
+  VectorOfVectors sortedUnique = sorted;
+  for ( auto & v : sortedUnique )
+    v.erase( std::unique( v.begin(), v.end() ), v.end() );
+  for ( unsigned int n : { 1u, 4u } )
+    {
+      SECTION( "Sorted ranges with " + std::to_string( n ) + " thread(s)" )
+        {
+          Ranges R;
+          R.assign( nbRanges, nbItems, generator, Ranges::SORTED, n );
+          REQUIRE( R.isValid() );
+          REQUIRE( VectorOfVectors( R ) == sorted );
+        }
+      SECTION( "Sorted unique ranges with " + std::to_string( n ) + " thread(s)" )
+        {
+          Ranges R;
+          R.assign( nbRanges, nbItems, generator, Ranges::SORTED_UNIQUE, n );
+          REQUIRE( R.isValid() );
+          REQUIRE( VectorOfVectors( R ) == sortedUnique );
+          REQUIRE( R.transpose( 50, n ).transpose( nbRanges, n ) == R );
+        }
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,182 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOpenAddressingHashTable.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes OpenAddressingHashSet and OpenAddressingHashMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef OpenAddressingHashSet< int > Set;
+typedef OpenAddressingHashMap< int, std::string > Map;
+
+BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< Set > ));
+BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< Map > ));
+BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< Set >::value ));
+BOOST_STATIC_ASSERT(( IsSimpleAssociativeContainer< Set >::value ));
+BOOST_STATIC_ASSERT(( IsUnorderedAssociativeContainer< Set >::value ));
+BOOST_STATIC_ASSERT(( IsUniqueAssociativeContainer< Map >::value ));
+BOOST_STATIC_ASSERT(( IsPairAssociativeContainer< Map >::value ));
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes OpenAddressingHashSet and OpenAddressingHashMap.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing OpenAddressingHashSet" )
+{
+  SECTION( "Basic operations" )
+    {
+      Set S;
+      REQUIRE( S.empty() );
+      REQUIRE( S.find( 3 ) == S.end() );
+      REQUIRE( S.erase( 3 ) == 0 );
+      REQUIRE( S.insert( 3 ).second );
+      REQUIRE( ! S.insert( 3 ).second );
+      REQUIRE( S.size() == 1 );
+      REQUIRE( *S.find( 3 ) == 3 );
+      REQUIRE( S.count( 3 ) == 1 );
+      REQUIRE( S.count( 4 ) == 0 );
+      auto r = S.equal_range( 3 );
+      REQUIRE( std::distance( r.first, r.second ) == 1 );
+      REQUIRE( S.erase( 3 ) == 1 );
+      REQUIRE( S.empty() );
+      REQUIRE( S.begin() == S.end() );
+      REQUIRE( S.isValid() );
+
+      Set T = { 1, 2, 3, 2 };
+      REQUIRE( T.size() == 3 );
+      Set U( T );
+      REQUIRE( U == T );
+      U.erase( 2 );
+      REQUIRE( U != T );
+      U.swap( T );
+      REQUIRE( U.size() == 3 );
+      REQUIRE( T.size() == 2 );
+      T.clear();
+      REQUIRE( T.empty() );
+      REQUIRE( T.isValid() );
+    }
+
+  SECTION( "Random insertions and removals behave as std::unordered_set" )
+    {
+      std::mt19937 gen( 17 );
+      std::uniform_int_distribution<int> dist( -5000, 5000 );
+      Set S;
+      std::unordered_set< int > R;
+      unsigned int nbOk = 0;
+      const unsigned int nb = 200000;
+      for ( unsigned int i = 0; i < nb; ++i )
+        {
+          int v = dist( gen );
+          bool ok;
+          switch ( i % 3 )
+            {
+            case 0:
+            case 1: ok = S.insert( v ).second == R.insert( v ).second; break;
+            default: ok = S.erase( v ) == R.erase( v ); break;
+            }
+          ok = ok && S.size() == R.size() && S.count( v ) == R.count( v );
+          nbOk += ok ? 1 : 0;
+        }
+      REQUIRE( nbOk == nb );
+      REQUIRE( S.isValid() );
+      REQUIRE( std::unordered_set< int >( S.begin(), S.end() ) == R );
+    }
+
+  SECTION( "Erasing while iterating" )
+    {
+      Set S;
+      for ( int i = 0; i < 1000; ++i )
+        S.insert( i );
+      for ( auto it = S.begin(); it != S.end(); )
+        if ( *it % 3 != 0 ) it = S.erase( it );
+        else ++it;
+      REQUIRE( S.size() == 334 );
+      unsigned int nbOk = 0;
+      for ( int i = 0; i < 1000; ++i )
+        nbOk += ( S.count( i ) == ( i % 3 == 0 ? 1u : 0u ) ) ? 1 : 0;
+      REQUIRE( nbOk == 1000 );
+      REQUIRE( S.isValid() );
+    }
+}
+
+TEST_CASE( "Testing OpenAddressingHashMap" )
+{
+  Map M;
+  M[ 4 ] = "four";
+  M.insert( std::make_pair( 2, std::string( "two" ) ) );
+  M.emplace( 7, "seven" );
+  REQUIRE( M.size() == 3 );
+  REQUIRE( M[ 4 ] == "four" );
+  REQUIRE( M.at( 2 ) == "two" );
+  REQUIRE( M.find( 7 )->second == "seven" );
+  REQUIRE_THROWS_AS( M.at( 5 ), std::out_of_range );
+  REQUIRE( M[ 5 ].empty() );
+  REQUIRE( M.size() == 4 );
+  M.find( 5 )->second = "five";
+
+  // Growth keeps all pairs.
+  for ( int i = 10; i < 10000; ++i )
+    M[ i ] = std::to_string( i );
+  REQUIRE( M.size() == 9994 );
+  unsigned int nbOk = 0;
+  for ( auto const & kv : M )
+    nbOk += ( kv.first >= 10 ? kv.second == std::to_string( kv.first ) : true ) ? 1 : 0;
+  REQUIRE( nbOk == M.size() );
+  REQUIRE( M.at( 5 ) == "five" );
+
+  const Map C( M );
+  REQUIRE( C == M );
+  REQUIRE( C.at( 4 ) == "four" );
+  M.erase( M.find( 4 ) );
+  REQUIRE( C != M );
+  REQUIRE( M.isValid() );
+
+  // Range insertion of elements convertible to the value type.
+  std::vector< std::pair< int, std::string > > pairs;
+  for ( int i = 0; i < 1000; ++i )
+    pairs.push_back( std::make_pair( 100000 + i, std::to_string( i ) ) );
+  Map R;
+  R.insert( pairs.begin(), pairs.end() );
+  R.insert( pairs.begin(), pairs.end() );
+  REQUIRE( R.size() == pairs.size() );
+  REQUIRE( R.at( 100999 ) == "999" );
+  REQUIRE( R.isValid() );
+}
+
+/** @ingroup Tests **/
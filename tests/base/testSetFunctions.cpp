@@ -35,6 +35,7 @@
 #include <unordered_set>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/SetFunctions.h"
+#include "DGtal/base/OpenAddressingHashTable.h"
 #include "DGtalCatch.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -51,7 +52,8 @@ TEMPLATE_TEST_CASE( "SetFunctions module unit tests", "[set_functions]",
                     std::vector<int>,
                     std::list<int>,
                     std::set<int>,
-                    std::unordered_set<int> )
+                    std::unordered_set<int>,
+                    DGtal::OpenAddressingHashSet<int> )
 
 {
   int S1[ 10 ] = { 4, 15, 20, 17, 9, 7, 13, 12, 1, 3 }; 
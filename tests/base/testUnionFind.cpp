@@ -0,0 +1,96 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testUnionFind.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class UnionFind.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/UnionFind.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class UnionFind.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "UnionFind basic services", "[unionfind]" )
+{
+  UnionFind<> uf( 5 );
+  REQUIRE( uf.isValid() );
+  REQUIRE( uf.size() == 5 );
+  REQUIRE( uf.nbSets() == 5 );
+  REQUIRE( uf.unite( 0, 3 ) );
+  REQUIRE( uf.unite( 4, 3 ) );
+  REQUIRE( ! uf.unite( 0, 4 ) );
+  REQUIRE( uf.same( 0, 4 ) );
+  REQUIRE( ! uf.same( 1, 2 ) );
+  REQUIRE( uf.nbSets() == 3 );
+  std::vector< std::size_t > labels;
+  REQUIRE( uf.labels( labels ) == 3 );
+  REQUIRE( labels == std::vector< std::size_t >( { 0, 1, 2, 0, 0 } ) );
+  REQUIRE( uf.makeSet() == 5 );
+  REQUIRE( uf.nbSets() == 4 );
+}
+
+TEST_CASE( "UnionFind labels do not depend on the order of merges", "[unionfind]" )
+{
+  const std::size_t n = 2000;
+  std::mt19937 gen( 7 );
+  std::uniform_int_distribution< std::uint32_t > dist( 0, n - 1 );
+  std::vector< std::pair< std::uint32_t, std::uint32_t > > edges;
+  for ( std::size_t i = 0; i < 1500; ++i )
+    edges.push_back( std::make_pair( dist( gen ), dist( gen ) ) );
+
+  UnionFind< std::uint32_t > uf1( n ), uf2( n );
+  for ( auto e : edges ) uf1.unite( e.first, e.second );
+  for ( auto it = edges.rbegin(); it != edges.rend(); ++it ) uf2.unite( it->second, it->first );
+  std::vector< std::uint32_t > l1, l2;
+  const std::size_t nb1 = uf1.labels( l1 );
+  const std::size_t nb2 = uf2.labels( l2 );
+  REQUIRE( nb1 == uf1.nbSets() );
+  REQUIRE( nb1 == nb2 );
+  REQUIRE( l1 == l2 );
+  // Labels are numbered in the order of the smallest elements.
+  std::uint32_t next = 0;
+  bool ordered = true;
+  for ( auto l : l1 )
+    {
+      ordered = ordered && l <= next;
+      if ( l == next ) ++next;
+    }
+  REQUIRE( ordered );
+  REQUIRE( next == nb1 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,272 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testATSolver2D.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes ATSolver2D and DiscreteExteriorCalculusSolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/ATSolver2D.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z2i::KSpace                                          KSpace;
+typedef ATSolver2D< KSpace >                                 LDLTSolver;
+typedef ATSolver2D< KSpace, EigenLinearAlgebraBackend,
+                    EigenLinearAlgebraBackend::SolverConjugateGradient > CGSolver;
+typedef LDLTSolver::Calculus                                 Calculus;
+typedef KSpace::SCell                                        SCell;
+
+/// The pixels of a 16x16 square, as positive 2-cells.
+static std::vector<SCell> makePixels( const KSpace& K )
+{
+  std::vector<SCell> pixels;
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 15, 15 ) );
+  for ( auto p : domain ) pixels.push_back( K.sSpel( p, KSpace::POS ) );
+  return pixels;
+}
+
+/// A noisy step function: 0 on the left half, 1 on the right half.
+static std::vector<double> makeNoisyStep( const KSpace& K,
+                                          const std::vector<SCell>& pixels )
+{
+  std::vector<double> input;
+  for ( auto s : pixels )
+    {
+      const auto p = K.sCoords( s );
+      const double noise = 0.05 * double( ( 7 * p[ 0 ] + 13 * p[ 1 ] ) % 5 - 2 );
+      input.push_back( ( p[ 0 ] < 8 ? 0.0 : 1.0 ) + noise );
+    }
+  return input;
+}
+
+/// The pointels of the 16x16 square.
+static std::vector<KSpace::Cell> makePointels( const KSpace& K )
+{
+  std::vector<KSpace::Cell> pointels;
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 16, 16 ) );
+  for ( auto p : domain ) pointels.push_back( K.uPointel( p ) );
+  return pointels;
+}
+
+/// @return the largest absolute difference between two forms.
+template <typename Form>
+static double maxDifference( const Form& f1, const Form& f2 )
+{
+  return ( f1.myContainer - f2.myContainer ).cwiseAbs().maxCoeff();
+}
+
+/// @return the largest absolute difference between two scalar fields.
+static double maxDifference( const std::vector<double>& f1,
+                             const std::vector<double>& f2 )
+{
+  double d = 0.0;
+  for ( std::size_t i = 0; i < f1.size(); ++i )
+    d = std::max( d, std::fabs( f1[ i ] - f2[ i ] ) );
+  return d;
+}
+
+/// The outputs u (on pixels) and v (on pointels) of an AT solver.
+struct ATOutputs
+{
+  std::vector<double> u;
+  std::vector<double> v;
+};
+
+template <typename Solver>
+static ATOutputs getOutputs( Solver& at_solver, const KSpace& K )
+{
+  const auto pixels   = makePixels( K );
+  const auto pointels = makePointels( K );
+  ATOutputs out;
+  out.u.resize( pixels.size() );
+  out.v.resize( pointels.size() );
+  at_solver.getOutputScalarFieldU2( out.u, pixels.begin(), pixels.end() );
+  at_solver.getOutputScalarFieldV0( out.v, pointels.begin(), pointels.end() );
+  return out;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ATSolver2D.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "ATSolver2D with a direct or an iterative linear solver", "[at][dec]" )
+{
+  KSpace K;
+  K.init( Z2i::Point( -1, -1 ), Z2i::Point( 16, 16 ), true );
+  const auto pixels   = makePixels( K );
+  const auto calculus =
+    DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend>
+    ::createFromNSCells<2>( pixels.begin(), pixels.end() );
+  const auto input    = makeNoisyStep( K, pixels );
+
+  GIVEN( "A noisy step function regularized with SimplicialLDLT and ConjugateGradient" ) {
+    LDLTSolver ldlt_solver( calculus, 0 );
+    ldlt_solver.initInputScalarFieldU2( input, pixels.begin(), pixels.end() );
+    ldlt_solver.setUp( 0.5, 0.05 );
+    ldlt_solver.solveGammaConvergence( 2.0, 0.5, 2.0 );
+    CGSolver cg_solver( calculus, 0 );
+    cg_solver.initInputScalarFieldU2( input, pixels.begin(), pixels.end() );
+    cg_solver.setUp( 0.5, 0.05 );
+    cg_solver.solveGammaConvergence( 2.0, 0.5, 2.0 );
+    const auto ldlt = getOutputs( ldlt_solver, K );
+    const auto cg   = getOutputs( cg_solver, K );
+    THEN( "Both solvers output the same regularized function and discontinuities" ) {
+      REQUIRE( maxDifference( ldlt.u, cg.u ) < 1e-4 );
+      REQUIRE( maxDifference( ldlt.v, cg.v ) < 1e-4 );
+    }
+    THEN( "The discontinuities lie between the two halves" ) {
+      // pointels are ordered x first, 17 per row.
+      REQUIRE( ldlt.v[ 8 * 17 + 8 ] < 0.5 );
+      REQUIRE( ldlt.v[ 8 * 17 + 2 ] > 0.5 );
+    }
+    THEN( "The sparsity pattern is analyzed once for u and once for v, whatever the number of steps" ) {
+      REQUIRE( ldlt_solver.timings().nb_steps > 2 );
+      REQUIRE( ldlt_solver.timings().nb_analyses == 2 );
+      REQUIRE( cg_solver.timings().nb_steps > 2 );
+      REQUIRE( cg_solver.timings().nb_analyses == 2 );
+    }
+  }
+
+  GIVEN( "An AT solver that has done some steps" ) {
+    LDLTSolver at_solver( calculus, 0 );
+    at_solver.initInputScalarFieldU2( input, pixels.begin(), pixels.end() );
+    at_solver.setUp( 0.5, 0.05 );
+    at_solver.setEpsilon( 1.0 );
+    at_solver.solveOneAlternateStep();
+    at_solver.solveOneAlternateStep();
+    REQUIRE( at_solver.timings().nb_steps    == 2 );
+    REQUIRE( at_solver.timings().nb_analyses == 2 );
+    THEN( "resetTimings zeroes the timings, and further steps reuse the analysis" ) {
+      at_solver.resetTimings();
+      REQUIRE( at_solver.timings().nb_steps    == 0 );
+      REQUIRE( at_solver.timings().nb_analyses == 0 );
+      REQUIRE( at_solver.timings().analysis_u2 == 0.0 );
+      REQUIRE( at_solver.timings().solve_v0    == 0.0 );
+      at_solver.solveOneAlternateStep();
+      REQUIRE( at_solver.timings().nb_steps    == 1 );
+      REQUIRE( at_solver.timings().nb_analyses == 0 );
+    }
+    THEN( "It is displayable with operator<<" ) {
+      std::ostringstream ss;
+      ss << at_solver;
+      REQUIRE( ss.str().find( "[ATSolver2D]" ) != std::string::npos );
+      REQUIRE( ss.str().find( "2 steps" )      != std::string::npos );
+    }
+    THEN( "A copy has its own linear solvers and computes the same steps" ) {
+      LDLTSolver copy( at_solver );
+      copy.solveOneAlternateStep();
+      REQUIRE( copy.timings().nb_analyses == 4 );
+      at_solver.solveOneAlternateStep();
+      REQUIRE( at_solver.timings().nb_analyses == 2 );
+      REQUIRE( maxDifference( getOutputs( copy, K ).u, getOutputs( at_solver, K ).u ) < 1e-10 );
+      REQUIRE( maxDifference( getOutputs( copy, K ).v, getOutputs( at_solver, K ).v ) < 1e-10 );
+    }
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DiscreteExteriorCalculusSolver.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "DiscreteExteriorCalculusSolver split analysis, factorization and warm start", "[solver][dec]" )
+{
+  KSpace K;
+  K.init( Z2i::Point( -1, -1 ), Z2i::Point( 16, 16 ), true );
+  const auto pixels   = makePixels( K );
+  const auto calculus =
+    DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend>
+    ::createFromNSCells<2>( pixels.begin(), pixels.end() );
+  typedef Calculus::PrimalForm0 PrimalForm0;
+  typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT,
+                                         0, PRIMAL, 0, PRIMAL> LDLT;
+  typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverConjugateGradient,
+                                         0, PRIMAL, 0, PRIMAL> CG;
+
+  // An SPD operator Id + D0^t D0 and some input.
+  const auto D0  = calculus.derivative<0, PRIMAL>();
+  const auto ope = calculus.identity<0, PRIMAL>() + D0.transpose() * D0;
+  PrimalForm0 input( calculus );
+  for ( Calculus::Index i = 0; i < input.length(); ++i )
+    input.myContainer( i ) = double( i % 7 ) - 3.0;
+
+  LDLT reference;
+  reference.compute( ope );
+  const PrimalForm0 x = reference.solve( input );
+  REQUIRE( reference.isValid() );
+
+  GIVEN( "A direct solver that analyzes then factorizes the operator" ) {
+    LDLT solver;
+    solver.analyzePattern( ope ).factorize( ope );
+    const PrimalForm0 y = solver.solve( input );
+    THEN( "It gives the same solution as compute" ) {
+      REQUIRE( solver.isValid() );
+      REQUIRE( maxDifference( x, y ) < 1e-10 );
+    }
+    THEN( "Factorizing again a scaled operator reuses the analysis" ) {
+      const auto ope2 = 2.0 * ope;
+      solver.factorize( ope2 );
+      const PrimalForm0 z = solver.solve( input );
+      REQUIRE( solver.isValid() );
+      REQUIRE( maxDifference( 2.0 * z, x ) < 1e-10 );
+    }
+    THEN( "A direct solver ignores the guess" ) {
+      const PrimalForm0 z = solver.solve( input, PrimalForm0::ones( calculus ) );
+      REQUIRE( maxDifference( x, z ) < 1e-10 );
+    }
+  }
+
+  GIVEN( "An iterative solver" ) {
+    CG solver;
+    solver.analyzePattern( ope ).factorize( ope );
+    THEN( "It converges from a zero guess" ) {
+      const PrimalForm0 y = solver.solve( input, PrimalForm0( calculus ) );
+      REQUIRE( solver.isValid() );
+      REQUIRE( maxDifference( x, y ) < 1e-6 );
+    }
+    THEN( "It needs no iteration when started from the solution" ) {
+      const PrimalForm0 y = solver.solve( input, x );
+      REQUIRE( solver.isValid() );
+      REQUIRE( solver.myLinearAlgebraSolver.iterations() == 0 );
+      REQUIRE( maxDifference( x, y ) < 1e-6 );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
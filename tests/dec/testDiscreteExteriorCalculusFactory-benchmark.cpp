@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusFactory-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the setup of a DiscreteExteriorCalculus on digital
+ * surfaces: DiscreteExteriorCalculusFactory::createFromNSCells
+ * (cell accumulation, sorted indexing and incidence arrays) and the
+ * assembly of the operators from the compressed incidences.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef DiscreteExteriorCalculus<2, 3, EigenLinearAlgebraBackend> Calculus;
+
+/// Point predicate of the digital ball of given squared radius centered at the origin.
+struct BallPredicate
+{
+  typedef Z3i::Point Point;
+  Integer squaredRadius;
+  bool operator()( const Point & p ) const
+  {
+    return p.dot( p ) <= squaredRadius;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+/**
+ * Usage: testDiscreteExteriorCalculusFactory-benchmark [max_radius]
+ * Digital balls of radii 20, 40, ... up to max_radius (default 80) are used.
+ */
+int main( int argc, char** argv )
+{
+  bool res = true;
+  const int max_radius = argc > 1 ? atoi( argv[ 1 ] ) : 80;
+  trace.beginBlock ( "Benchmarking the setup of DiscreteExteriorCalculus" );
+  for ( int r = 20; r <= max_radius; r *= 2 )
+    {
+      trace.beginBlock( "Digital ball" );
+      Point p1 = Point::diagonal( -r - 2 );
+      Point p2 = Point::diagonal(  r + 2 );
+      KSpace K;
+      K.init( p1, p2, true );
+      BallPredicate ball = { r * r };
+      std::set< SCell > boundary;
+      Surfaces< KSpace >::sMakeBoundary( boundary, K, ball, p1, p2 );
+      std::vector< SCell > surfels( boundary.begin(), boundary.end() );
+      trace.info() << "Ball of radius " << r << ", " << surfels.size() << " surfels." << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "DiscreteExteriorCalculusFactory::createFromNSCells" );
+      const Calculus calculus = CalculusFactory::createFromNSCells<2>( surfels.begin(), surfels.end(), true );
+      trace.info() << calculus << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "Operators assembly" );
+      const Calculus::PrimalDerivative0 d0 = calculus.derivative<0, PRIMAL>();
+      const Calculus::PrimalDerivative1 d1 = calculus.derivative<1, PRIMAL>();
+      const Calculus::PrimalHodge0 h0 = calculus.hodge<0, PRIMAL>();
+      const Calculus::PrimalHodge1 h1 = calculus.hodge<1, PRIMAL>();
+      const Calculus::PrimalHodge2 h2 = calculus.hodge<2, PRIMAL>();
+      const Calculus::PrimalIdentity0 laplace = calculus.laplace<PRIMAL>();
+      trace.info() << "d0: " << d0.myContainer.nonZeros() << " non zeros, "
+                   << "d1: " << d1.myContainer.nonZeros() << " non zeros, "
+                   << "laplace: " << laplace.myContainer.nonZeros() << " non zeros." << std::endl;
+      trace.endBlock();
+
+      // Euler characteristic of a sphere and exactness of the derivative.
+      const Calculus::Index nb0 = calculus.kFormLength( 0, PRIMAL );
+      const Calculus::Index nb1 = calculus.kFormLength( 1, PRIMAL );
+      const Calculus::Index nb2 = calculus.kFormLength( 2, PRIMAL );
+      res = res && nb2 == (Calculus::Index) surfels.size()
+        && nb0 - nb1 + nb2 == 2
+        && ( d1 * d0 ).myContainer.norm() == 0
+        && h0.myContainer.nonZeros() + h1.myContainer.nonZeros() + h2.myContainer.nonZeros() == nb0 + nb1 + nb2;
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -217,6 +217,18 @@ void test_linear_structure()
         solver.compute(laplace);
         Calculus::PrimalForm0 solved_solution = solver.solve(dirac);
         //! [dirichlet-solve]
+        {
+            // several right-hand sides solved at once with the same factorization
+            std::vector<Calculus::PrimalForm0> diracs;
+            diracs.push_back(dirac);
+            diracs.push_back(2. * dirac);
+            const std::vector<Calculus::PrimalForm0> solved_solutions = solver.solve(diracs);
+            FATAL_ERROR( solved_solutions.size() == 2 );
+            const double error_0 = (solved_solutions[0]-solved_solution).myContainer.array().abs().maxCoeff();
+            const double error_1 = (solved_solutions[1]-2.*solved_solution).myContainer.array().abs().maxCoeff();
+            trace.info() << "multiple rhs error=" << error_0 << " " << error_1 << endl;
+            FATAL_ERROR( error_0 < 1e-10 && error_1 < 1e-10 );
+        }
         solved_solution.myContainer.array() /= solved_solution.myContainer.maxCoeff();
         Calculus::PrimalForm0 solved_solution_ordered = reorder * solved_solution;
 
@@ -382,11 +394,11 @@ void test_manual_operators_3d()
 #if defined(TEST_HARDCODED_ORDER)
         Eigen::MatrixXd d0_th(5, 2);
         d0_th <<
-           -1,  0,
-           -1,  0,
-           -1,  1,
-            0,  1,
-            0,  1;
+            1,  0,
+            1,  0,
+            1, -1,
+            0, -1,
+            0, -1;
 
         FATAL_ERROR( Eigen::MatrixXd(d0.myContainer) == d0_th );
 #endif
@@ -402,10 +414,10 @@ void test_manual_operators_3d()
 #if defined(TEST_HARDCODED_ORDER)
         Eigen::MatrixXd d1_th(4, 5);
         d1_th <<
-             0, -1,  1,  0, -1,
+            -1,  1,  0,  0,  0,
              1,  0, -1,  1,  0,
-             0,  0,  0, -1,  1,
-            -1,  1,  0,  0,  0;
+             0, -1,  1,  0, -1,
+             0,  0,  0, -1,  1;
 
         FATAL_ERROR( Eigen::MatrixXd(d1.myContainer) == d1_th );
 #endif
@@ -586,23 +598,23 @@ void test_manual_operators_2d()
         Eigen::MatrixXd d0_th(7, 6);
         d0_th <<
             -1,  1,  0,  0,  0,  0,
+             0,  1, -1,  0,  0,  0,
              1,  0,  0, -1,  0,  0,
+             0, -1,  0,  0,  1,  0,
              0,  0,  1,  0,  0, -1,
-             0,  0,  0,  0, -1,  1,
-             0, -1,  1,  0,  0,  0,
-             0,  0, -1,  1,  0,  0,
-             0,  0,  0, -1,  1,  0;
+             0,  0,  0,  1, -1,  0,
+             0,  0,  0,  0, -1,  1;
         FATAL_ERROR( Eigen::MatrixXd(primal_d0.myContainer) == d0_th );
 
         Eigen::MatrixXd d0p_th(7, 6);
         d0p_th <<
              1, -1,  0,  0,  0,  0,
-             0,  0, -1,  1,  0,  0,
-             0,  1,  0, -1,  0,  0,
-             0,  0,  1,  0, -1,  0,
-             0,  0,  0,  0,  1, -1,
-            -1,  0,  1,  0,  0,  0,
-             0,  0,  0, -1,  0,  1;
+             0, -1,  1,  0,  0,  0,
+            -1,  0,  0,  1,  0,  0,
+             0,  1,  0,  0, -1,  0,
+             0,  0, -1,  0,  0,  1,
+             0,  0,  0, -1,  1,  0,
+             0,  0,  0,  0,  1, -1;
         FATAL_ERROR( Eigen::MatrixXd(dual_d0p.myContainer) == d0p_th );
 #endif
     }
@@ -616,14 +628,14 @@ void test_manual_operators_2d()
 #if defined(TEST_HARDCODED_ORDER)
         Eigen::MatrixXd d1_th(2, 7);
         d1_th <<
-             1,  1,  0,  0,  1,  1,  0,
-             0,  0, -1, -1,  0, -1, -1;
+            -1,  0, -1, -1,  0, -1,  0,
+             0,  1,  0,  1,  1,  0,  1;
         FATAL_ERROR( Eigen::MatrixXd(primal_d1.myContainer) == d1_th );
 
         Eigen::MatrixXd d1p_th(2, 7);
         d1p_th <<
-            -1, -1, -1,  0,  0, -1,  0,
-             0,  1,  0,  1,  1,  0,  1;
+             1,  0,  1,  1,  0,  1,  0,
+             0, -1,  0, -1, -1,  0, -1;
         FATAL_ERROR( Eigen::MatrixXd(dual_d1p.myContainer) == d1p_th );
 #endif
     }
@@ -677,14 +689,14 @@ void test_manual_operators_2d()
 #if defined(TEST_HARDCODED_ORDER)
         Eigen::MatrixXd d0p_th_transpose(2, 7);
         d0p_th_transpose <<
-             1,  1,  0,  0,  1,  1,  0,
-             0,  0, -1, -1,  0, -1, -1;
+            -1,  0, -1, -1,  0, -1,  0,
+             0,  1,  0,  1,  1,  0,  1;
         FATAL_ERROR( Eigen::MatrixXd(primal_d0p.myContainer) == d0p_th_transpose.transpose() );
 
         Eigen::MatrixXd minus_d0_th_transpose(2, 7);
         minus_d0_th_transpose <<
-            -1, -1, -1,  0,  0, -1,  0,
-             0,  1,  0,  1,  1,  0,  1;
+             1,  0,  1,  1,  0,  1,  0,
+             0, -1,  0, -1, -1,  0, -1;
         FATAL_ERROR( Eigen::MatrixXd(dual_d0.myContainer) == -minus_d0_th_transpose.transpose() );
 #endif
     }
@@ -699,23 +711,23 @@ void test_manual_operators_2d()
         Eigen::MatrixXd minus_d1p_th_transpose(7, 6);
         minus_d1p_th_transpose <<
             -1,  1,  0,  0,  0,  0,
+             0,  1, -1,  0,  0,  0,
              1,  0,  0, -1,  0,  0,
+             0, -1,  0,  0,  1,  0,
              0,  0,  1,  0,  0, -1,
-             0,  0,  0,  0, -1,  1,
-             0, -1,  1,  0,  0,  0,
-             0,  0, -1,  1,  0,  0,
-             0,  0,  0, -1,  1,  0;
+             0,  0,  0,  1, -1,  0,
+             0,  0,  0,  0, -1,  1;
         FATAL_ERROR( Eigen::MatrixXd(primal_d1p.myContainer) == -minus_d1p_th_transpose.transpose() );
 
         Eigen::MatrixXd d1_th_transpose(7, 6);
         d1_th_transpose <<
              1, -1,  0,  0,  0,  0,
-             0,  0, -1,  1,  0,  0,
-             0,  1,  0, -1,  0,  0,
-             0,  0,  1,  0, -1,  0,
-             0,  0,  0,  0,  1, -1,
-            -1,  0,  1,  0,  0,  0,
-             0,  0,  0, -1,  0,  1;
+             0, -1,  1,  0,  0,  0,
+            -1,  0,  0,  1,  0,  0,
+             0,  1,  0,  0, -1,  0,
+             0,  0, -1,  0,  0,  1,
+             0,  0,  0, -1,  1,  0,
+             0,  0,  0,  0,  1, -1;
         FATAL_ERROR( Eigen::MatrixXd(dual_d1.myContainer) == d1_th_transpose.transpose() );
 #endif
     }
@@ -757,12 +769,12 @@ void test_manual_operators_2d()
 
         {
             Calculus::PrimalForm1::Container dx_container(7);
-            dx_container << -1, 0, 0, -1, 0, 1, 0;
+            dx_container << 0, 0, -1, 1, -1, 0, 0;
             const Calculus::PrimalForm1 primal_dx(primal_calculus, dx_container);
             const Calculus::PrimalVectorField primal_dx_field = primal_calculus.sharp(primal_dx);
 
             Calculus::PrimalForm1::Container dxp_container(7);
-            dxp_container << 1, -1, 0, 0, 1, 0, 0;
+            dxp_container << 0, 0, 1, -1, 1, 0, 0;
             const Calculus::DualForm1 dual_dx(dual_calculus, dxp_container);
             const Calculus::DualVectorField dual_dx_field = dual_calculus.sharp(dual_dx);
 
@@ -786,12 +798,12 @@ void test_manual_operators_2d()
 
         {
             Calculus::PrimalForm1::Container dy_container(7);
-            dy_container << 0, 1, 1, 0, -1, 0, -1;
+            dy_container << 1, -1, 0, 0, 0, -1, 1;
             const Calculus::PrimalForm1 primal_dy(primal_calculus, dy_container);
             const Calculus::PrimalVectorField primal_dy_field = primal_calculus.sharp(primal_dy);
 
             Calculus::PrimalForm1::Container dyp_container(7);
-            dyp_container << 0, 0, 1, 1, 0, -1, -1;
+            dyp_container << -1, 1, 0, 0, 0, 1, -1;
             const Calculus::DualForm1 dual_dy(dual_calculus, dyp_container);
             const Calculus::DualVectorField dual_dy_field = dual_calculus.sharp(dual_dy);
 
@@ -822,12 +834,12 @@ void test_manual_operators_2d()
 
         {
             Calculus::DualForm1::Container dx_container(7);
-            dx_container << 0, -1, -1, 0, 1, 0, 1;
+            dx_container << -1, 1, 0, 0, 0, 1, -1;
             const Calculus::DualForm1 primal_dx(primal_calculus, dx_container);
             const Calculus::DualVectorField primal_dx_field = primal_calculus.sharp(primal_dx);
 
             Calculus::DualForm1::Container dxp_container(7);
-            dxp_container << 0, 0, 1, 1, 0, -1, -1;
+            dxp_container << -1, 1, 0, 0, 0, 1, -1;
             const Calculus::PrimalForm1 dual_dx(dual_calculus, dxp_container);
             const Calculus::PrimalVectorField dual_dx_field = dual_calculus.sharp(dual_dx);
 
@@ -851,12 +863,12 @@ void test_manual_operators_2d()
 
         {
             Calculus::DualForm1::Container dy_container(7);
-            dy_container << -1, 0, 0, -1, 0 , 1, 0;
+            dy_container << 0, 0, -1, 1, -1, 0, 0;
             const Calculus::DualForm1 primal_dy(primal_calculus, dy_container);
             const Calculus::DualVectorField primal_dy_field = primal_calculus.sharp(primal_dy);
 
             Calculus::DualForm1::Container dyp_container(7);
-            dyp_container << -1, 1, 0, 0, -1, 0, 0;
+            dyp_container << 0, 0, -1, 1, -1, 0, 0;
             const Calculus::PrimalForm1 dual_dy(dual_calculus, dyp_container);
             const Calculus::PrimalVectorField dual_dy_field = dual_calculus.sharp(dual_dy);
 
@@ -929,16 +941,16 @@ void test_manual_operators_2d()
 
 #if defined(TEST_HARDCODED_ORDER)
         Calculus::PrimalForm1::Container dx_container(7);
-        dx_container << -1, 0, 0, -1, 0, 1, 0;
+        dx_container << 0, 0, -1, 1, -1, 0, 0;
         Calculus::PrimalForm1::Container dxp_container(7);
-        dxp_container << 1, -1, 0, 0, 1, 0, 0;
+        dxp_container << 0, 0, 1, -1, 1, 0, 0;
         FATAL_ERROR( primal_dx.myContainer == dx_container );
         FATAL_ERROR( dual_dx.myContainer == dxp_container );
 
         Calculus::PrimalForm1::Container dy_container(7);
-        dy_container << 0, 1, 1, 0, -1, 0, -1;
+        dy_container << 1, -1, 0, 0, 0, -1, 1;
         Calculus::PrimalForm1::Container dyp_container(7);
-        dyp_container << 0, 0, 1, 1, 0, -1, -1;
+        dyp_container << -1, 1, 0, 0, 0, 1, -1;
         FATAL_ERROR( primal_dy.myContainer == dy_container );
         FATAL_ERROR( dual_dy.myContainer == dyp_container );
 #endif
@@ -990,16 +1002,16 @@ void test_manual_operators_2d()
 
 #if defined(TEST_HARDCODED_ORDER)
         Calculus::PrimalForm1::Container dx_container(7);
-        dx_container << 0, -1, -1, 0, 1, 0, 1;
+        dx_container << -1, 1, 0, 0, 0, 1, -1;
         Calculus::PrimalForm1::Container dxp_container(7);
-        dxp_container << 0, 0, 1, 1, 0, -1, -1;
+        dxp_container << -1, 1, 0, 0, 0, 1, -1;
         FATAL_ERROR( primal_dx.myContainer == dx_container );
         FATAL_ERROR( dual_dx.myContainer == dxp_container );
 
         Calculus::PrimalForm1::Container dy_container(7);
-        dy_container << -1, 0, 0, -1, 0, 1, 0;
+        dy_container << 0, 0, -1, 1, -1, 0, 0;
         Calculus::PrimalForm1::Container dyp_container(7);
-        dyp_container << -1, 1, 0, 0, -1, 0, 0;
+        dyp_container << 0, 0, -1, 1, -1, 0, 0;
         FATAL_ERROR( primal_dy.myContainer == dy_container );
         FATAL_ERROR( dual_dy.myContainer == dyp_container );
 #endif
@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIntegralInvariantFFTEstimators.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes IntegralInvariantFFTVolumeEstimator
+ * and IntegralInvariantFFTCovarianceEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantCovarianceEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantFFTCovarianceEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts<Z3i::KSpace> SH3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing classes IntegralInvariantFFTVolumeEstimator and
+// IntegralInvariantFFTCovarianceEstimator.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Evaluates an estimator on a range of surfels.
+template <typename Estimator, typename Functor, typename Shape, typename Surfels>
+std::vector< typename Functor::Quantity >
+estimate( const Z3i::KSpace & K, const Shape & shape, const Surfels & surfels,
+          double h, double r )
+{
+  Functor functor;
+  functor.init( h, r * h );
+  Estimator estimator( functor );
+  estimator.attach( K, shape );
+  estimator.setParams( r );
+  estimator.init( h, surfels.begin(), surfels.end() );
+  std::vector< typename Functor::Quantity > values;
+  estimator.eval( surfels.begin(), surfels.end(), std::back_inserter( values ) );
+  return values;
+}
+
+TEST_CASE( "Testing IntegralInvariantFFT estimators" )
+{
+  typedef SH3::BinaryImage Shape;
+  typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> MeanFunctor;
+  typedef functors::IIGaussianCurvature3DFunctor<Z3i::Space> GaussianFunctor;
+
+  auto params = SH3::defaultParameters();
+  params( "polynomial", "goursat" )( "gridstep", 1. );
+  auto implicit_shape  = SH3::makeImplicitShape3D( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto surfels         = SH3::getSurfelRange( surface, params );
+  const double h = 1.0;
+
+  SECTION( "FFT volumes are the ones of IntegralInvariantVolumeEstimator" )
+    {
+      for ( double r : { 3.0, 4.5 } )
+        {
+          auto H    = estimate< IntegralInvariantVolumeEstimator< Z3i::KSpace, Shape, MeanFunctor >,
+                                MeanFunctor >( K, *binary_image, surfels, h, r );
+          auto Hfft = estimate< IntegralInvariantFFTVolumeEstimator< Z3i::KSpace, Shape, MeanFunctor >,
+                                MeanFunctor >( K, *binary_image, surfels, h, r );
+          REQUIRE( Hfft == H );
+        }
+    }
+
+  SECTION( "FFT covariance matrices match IntegralInvariantCovarianceEstimator" )
+    {
+      const double r = 3.0;
+      auto G    = estimate< IntegralInvariantCovarianceEstimator< Z3i::KSpace, Shape, GaussianFunctor >,
+                            GaussianFunctor >( K, *binary_image, surfels, h, r );
+      auto Gfft = estimate< IntegralInvariantFFTCovarianceEstimator< Z3i::KSpace, Shape, GaussianFunctor >,
+                            GaussianFunctor >( K, *binary_image, surfels, h, r );
+      REQUIRE( Gfft.size() == G.size() );
+      unsigned int nbDiff = 0;
+      for ( std::size_t i = 0; i < G.size(); ++i )
+        if ( std::abs( Gfft[ i ] - G[ i ] ) > 1e-8 )
+          ++nbDiff;
+      REQUIRE( nbDiff == 0 );
+
+      // Initialized on half of the surfels only: the other ones are
+      // convolved on demand, and kept.
+      GaussianFunctor functor;
+      functor.init( h, r * h );
+      IntegralInvariantFFTCovarianceEstimator< Z3i::KSpace, Shape, GaussianFunctor > half( functor );
+      half.attach( K, *binary_image );
+      half.setParams( r );
+      half.init( h, surfels.begin(), surfels.begin() + surfels.size() / 2 );
+      REQUIRE( half.eval( surfels.end() - 1 ) == Gfft.back() );
+      REQUIRE( half.eval( surfels.end() - 1 ) == Gfft.back() );
+      std::vector< double > values;
+      half.eval( surfels.begin(), surfels.end(), std::back_inserter( values ) );
+      REQUIRE( values == Gfft );
+    }
+
+  SECTION( "Multiscale and out of range evaluations" )
+    {
+      const std::vector< double > radii = { 3.0, 5.0, 4.0 };
+      MeanFunctor functor;
+      IntegralInvariantFFTVolumeEstimator< Z3i::KSpace, Shape, MeanFunctor > estimator( functor );
+      estimator.attach( K, *binary_image );
+      auto H = estimator.evalMultiscale( h, radii, surfels.begin(), surfels.end() );
+      REQUIRE( H.size() == radii.size() );
+      for ( std::size_t i = 0; i < radii.size(); ++i )
+        REQUIRE( H[ i ] == ( estimate< IntegralInvariantFFTVolumeEstimator< Z3i::KSpace, Shape, MeanFunctor >,
+                                       MeanFunctor >( K, *binary_image, surfels, h, radii[ i ] ) ) );
+
+      // Initialized on half of the surfels only.
+      functor.init( h, 4.0 * h );
+      IntegralInvariantFFTVolumeEstimator< Z3i::KSpace, Shape, MeanFunctor > half( functor );
+      half.attach( K, *binary_image );
+      half.setParams( 4.0 );
+      half.init( h, surfels.begin(), surfels.begin() + surfels.size() / 2 );
+      std::vector< double > values;
+      half.eval( surfels.begin(), surfels.end(), std::back_inserter( values ) );
+      REQUIRE( values == H[ 2 ] );
+      REQUIRE( half.eval( surfels.end() - 1 ) == H[ 2 ].back() );
+
+      // Concurrent const evaluations of surfels not given to init.
+      IntegralInvariantFFTVolumeEstimator< Z3i::KSpace, Shape, MeanFunctor > shared( functor );
+      shared.attach( K, *binary_image );
+      shared.setParams( 4.0 );
+      shared.init( h, surfels.begin(), surfels.begin() + 1 );
+      const auto & cshared = shared;
+      const std::size_t nbThreads = 4;
+      std::vector< std::vector< double > > tvalues( nbThreads );
+      std::vector< std::thread > threads;
+      for ( std::size_t t = 0; t < nbThreads; ++t )
+        threads.emplace_back( [&, t] ()
+          {
+            for ( auto it = surfels.begin() + t; it < surfels.end(); it += 97 )
+              tvalues[ t ].push_back( cshared.eval( it ) );
+          } );
+      for ( auto & thread : threads ) thread.join();
+      unsigned int nbDiff = 0;
+      for ( std::size_t t = 0; t < nbThreads; ++t )
+        for ( std::size_t i = 0; i < tvalues[ t ].size(); ++i )
+          nbDiff += tvalues[ t ][ i ] == H[ 2 ][ t + 97 * i ] ? 0 : 1;
+      REQUIRE( nbDiff == 0 );
+    }
+}
+
+/** @ingroup Tests **/
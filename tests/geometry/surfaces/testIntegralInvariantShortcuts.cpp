@@ -84,6 +84,22 @@ TEST_CASE( "Testing IntegralInvariant Shortcuts API" )
     for(std::size_t i = 0; i < G.size(); ++i)
      REQUIRE( Kcurv[i] == Approx( G[i] ) );
   }
+
+  SECTION("Testing that parallel estimations match sequential ones")
+  {
+    auto H  = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+    auto N  = SHG3::getIINormalVectors( binary_image, surfels, params );
+    for ( int nbThreads : { 3, 0 } )
+      {
+        params( "nb-threads", nbThreads );
+        auto Hp = SHG3::getIIMeanCurvatures( binary_image, surfels, params );
+        auto Kp = SHG3::getIIGaussianCurvatures( binary_image, surfels, params );
+        auto Np = SHG3::getIINormalVectors( binary_image, surfels, params );
+        REQUIRE( Hp == H );
+        REQUIRE( Kp == Kcurv );
+        REQUIRE( Np == N );
+      }
+  }
 }
 
 /** @ingroup Tests **/
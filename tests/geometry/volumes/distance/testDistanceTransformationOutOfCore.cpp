@@ -0,0 +1,125 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDistanceTransformationOutOfCore.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing DistanceTransformation on a TiledImage
+ * spilled to the disk.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryOnDisk.h"
+#include "DGtal/images/ImageCachePolicies.h"
+#include "DGtal/images/TiledImage.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> Tile;
+typedef ImageFactoryOnDisk<Tile> Factory;
+typedef ImageCacheReadPolicyFIFO<Tile, Factory> ReadPolicy;
+typedef ImageCacheWritePolicyWB<Tile, Factory> WritePolicy;
+typedef TiledImage<Tile, Factory, ReadPolicy, WritePolicy> Storage;
+typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric, Storage> TiledDT;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing out-of-core DistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Compares the out-of-core computation with the in-core one.
+void compareWithInCore( const Z3i::Domain & domain, const Z3i::DigitalSet & set,
+                        const L2Metric & l2, std::size_t budget,
+                        const DT::PeriodicitySpec & periodicity )
+{
+  DT dt( domain, set, l2, periodicity );
+
+  Factory factory( domain, "testDistanceTransformationOutOfCore" );
+  const auto N = Factory::tilesPerDimension( domain, budget );
+  ReadPolicy readPolicy( factory, Factory::tilesPerColumn( domain, N ) );
+  WritePolicy writePolicy( factory );
+  CountedPtr<Storage> storage( new Storage( factory, readPolicy, writePolicy, N ) );
+  TiledDT tiledDT( domain, set, l2, storage, periodicity );
+  trace.info() << factory << std::endl;
+
+  // Each tile is loaded once by the initialization and once per pass
+  const unsigned int column = Factory::tilesPerColumn( domain, N );
+  const unsigned int nbTiles = column * column * column;
+  REQUIRE( storage->getCacheMissWrite() <= nbTiles );
+  REQUIRE( storage->getCacheMissRead() <= 3 * nbTiles );
+
+  unsigned int nbDiff = 0;
+  for ( auto const & p : domain )
+    if ( dt.getVoronoiVector( p ) != tiledDT.getVoronoiVector( p )
+         || dt( p ) != tiledDT( p ) )
+      ++nbDiff;
+  REQUIRE( nbDiff == 0 );
+}
+
+TEST_CASE( "Testing out-of-core DistanceTransformation" )
+{
+  const Z3i::Domain domain( Z3i::Point( -5, 0, 3 ), Z3i::Point( 64, 60, 55 ) );
+  Z3i::DigitalSet set( domain );
+  for ( auto const & p : domain )
+    set.insertNew( p );
+  for ( unsigned int i = 0; i < 200; ++i )
+    set.erase( Z3i::Point( -5 + rand() % 70, rand() % 61, 3 + rand() % 53 ) );
+
+  L2Metric l2;
+  const std::size_t inCoreBytes = domain.size() * sizeof( Z3i::Vector );
+  const std::size_t budget = inCoreBytes / 8;
+
+  SECTION( "Tiling from the memory budget" )
+    {
+      const auto N = Factory::tilesPerDimension( domain, budget );
+      const unsigned int column = Factory::tilesPerColumn( domain, N );
+      REQUIRE( N > 1 );
+      std::size_t tileBytes = sizeof( Z3i::Vector );
+      for ( Dimension i = 0; i < 3; ++i )
+        tileBytes *= ( domain.upperBound()[ i ] - domain.lowerBound()[ i ] + 1 ) / N;
+      REQUIRE( ( column + 1 ) * tileBytes <= budget );
+    }
+
+  SECTION( "Comparison with the in-core result" )
+    {
+      compareWithInCore( domain, set, l2, budget, { { false, false, false } } );
+    }
+
+  SECTION( "Comparison with the in-core result (periodic)" )
+    {
+      compareWithInCore( domain, set, l2, budget, { { true, false, true } } );
+    }
+}
+
+/** @ingroup Tests **/
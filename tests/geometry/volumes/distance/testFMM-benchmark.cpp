@@ -0,0 +1,117 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMM-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the FMM on the distance to a ball, with sparse
+ * (ImageContainerBySTLMap) and dense (ImageContainerBySTLVector)
+ * storages.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// Computes the distance to the ball of center @a c and radius @a r
+/// with the FMM in @a image (accepted points in @a set).
+/// @return the maximal error with respect to the exact distance.
+template <typename TImage, typename TSet>
+double benchmarkBallDistance( const std::string & title, TImage & image, TSet & set,
+                              const Z3i::Point & c, double r )
+{
+  const Z3i::Domain domain = image.domain();
+  typedef FMM<TImage, TSet, Z3i::Domain::Predicate> FMM;
+
+  //Pairs of (inner, outer) points along the ball boundary
+  std::vector< std::pair<Z3i::Point, Z3i::Point> > pairs;
+  for ( auto const & p : domain )
+    if ( ( p - c ).norm() <= r )
+      for ( Dimension k = 0; k < 3; ++k )
+        for ( int dir = -1; dir <= 1; dir += 2 )
+          {
+            Z3i::Point q = p;
+            q[ k ] += dir;
+            if ( domain.isInside( q ) && ( q - c ).norm() > r )
+              pairs.push_back( std::make_pair( p, q ) );
+          }
+
+  trace.beginBlock( title );
+  FMM::initFromIncidentPointsRange( pairs.begin(), pairs.end(), image, set, 0.5 );
+  FMM fmm( image, set, domain.predicate() );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+  trace.endBlock();
+
+  double error = 0.0;
+  for ( auto const & p : domain )
+    error = std::max( error, std::abs( std::abs( image( p ) ) - std::abs( ( p - c ).norm() - r ) ) );
+  trace.info() << "Max error: " << error << std::endl;
+  return error;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking FMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 512;
+  const Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  const Z3i::Point c = Z3i::Point::diagonal( size / 2 );
+  const double r = size / 4.0;
+
+  typedef ImageContainerBySTLMap<Z3i::Domain, double> SparseImage;
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> DenseImage;
+  SparseImage sparseImage( domain );
+  DigitalSetFromMap<SparseImage> sparseSet( sparseImage );
+  const double e1 = benchmarkBallDistance( "FMM, sparse storage", sparseImage, sparseSet, c, r );
+  DenseImage denseImage( domain );
+  DigitalSetBySTLSet<Z3i::Domain> denseSet( domain );
+  const double e2 = benchmarkBallDistance( "FMM, dense storage", denseImage, denseSet, c, r );
+
+  //First order scheme: the error is bounded by a fraction of the radius
+  bool res = ( e1 == e2 ) && ( e1 < r / 10.0 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -653,6 +653,76 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Comparison of the accepted points (in the same order) and of the 
+ * distances computed with a sparse storage (candidates in a heap with 
+ * outdated pairs) and with a dense storage (candidates in a heap with 
+ * decreased keys)
+ */
+bool testStorages(int size)
+{
+  typedef HyperRectDomain< SpaceND<2, int> > Domain; 
+  typedef Domain::Point Point; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+  const double radius = size / 2.0 - 0.3; 
+
+  //points on both sides of a circle
+  std::vector<std::pair<Point, Point> > pairs; 
+  for (Domain::ConstIterator it = d.begin(), itEnd = d.end(); it != itEnd; ++it)
+    for (Dimension k = 0; k < 2; ++k)
+      {
+	Point q = *it; 
+	q[k] += 1; 
+	if ( d.isInside(q) && 
+	     ( (it->norm() <= radius) != (q.norm() <= radius) ) )
+	  pairs.push_back( it->norm() <= radius ? 
+			   std::make_pair(*it, q) : std::make_pair(q, *it) ); 
+      }
+
+  trace.beginBlock ( "Sparse and dense storages" ); 
+
+  typedef ImageContainerBySTLMap<Domain,double> SparseImage; 
+  typedef DigitalSetFromMap<SparseImage> SparseSet; 
+  typedef FMM<SparseImage, SparseSet, Domain::Predicate> SparseFMM; 
+  SparseImage sparseImage( d, 0.0 ); 
+  SparseSet sparseSet( sparseImage ); 
+  SparseFMM::initFromIncidentPointsRange(pairs.begin(), pairs.end(), 
+					 sparseImage, sparseSet, 0.5); 
+  SparseFMM sparseFMM( sparseImage, sparseSet, d.predicate(), d.size(), size / 3.0 ); 
+
+  typedef ImageContainerBySTLVector<Domain,double> DenseImage; 
+  typedef DigitalSetBySTLSet<Domain> DenseSet; 
+  typedef FMM<DenseImage, DenseSet, Domain::Predicate> DenseFMM; 
+  DenseImage denseImage( d ); 
+  DenseSet denseSet( d ); 
+  DenseFMM::initFromIncidentPointsRange(pairs.begin(), pairs.end(), 
+					denseImage, denseSet, 0.5); 
+  DenseFMM denseFMM( denseImage, denseSet, d.predicate(), d.size(), size / 3.0 ); 
+
+  unsigned int nb = 0; 
+  bool flagIsOk = true; 
+  Point p1, p2; 
+  double v1 = 0, v2 = 0; 
+  bool flag1 = true, flag2 = true; 
+  while ( flagIsOk && flag1 && flag2 )
+    {
+      flag1 = sparseFMM.computeOneStep( p1, v1 ); 
+      flag2 = denseFMM.computeOneStep( p2, v2 ); 
+      flagIsOk = ( flag1 == flag2 ) && ( !flag1 || ( ( p1 == p2 ) && ( v1 == v2 ) ) ); 
+      if (flag1) ++nb; 
+    }
+  trace.info() << nb << " accepted points" << std::endl; 
+  trace.info() << sparseFMM << std::endl; 
+  trace.info() << denseFMM << std::endl; 
+  flagIsOk = flagIsOk && ( nb > 0 ) && ( sparseSet.size() == denseSet.size() ) 
+    && ( sparseFMM.min() == denseFMM.min() ) && ( sparseFMM.max() == denseFMM.max() ) 
+    && sparseFMM.isValid() && denseFMM.isValid(); 
+
+  trace.endBlock(); 
+
+  return flagIsOk; 
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -673,6 +743,7 @@ int main ( int argc, char** argv )
     && testDisplayDT2d( size, 2*area, std::sqrt(2*size*size) )
     && testDisplayDTFromCircle(size)   
     && accuracyTest(size)
+    && testStorages(size)
     ;
 
   size = 25;
@@ -0,0 +1,104 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testScalarDistanceTransformation-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of ScalarDistanceTransformation against
+ * DistanceTransformation (time and memory of the distance maps).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ScalarDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// Benchmarks the DistanceTransformation for the l_p metric and the
+/// ScalarDistanceTransformation for the distance functions TSep.
+/// @return true if both raw distances are equal.
+template <DGtal::uint32_t p, typename TSep>
+bool benchmarkLp( const Z3i::DigitalSet & shape )
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, p> Metric;
+  typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, Metric> DT;
+  typedef ScalarDistanceTransformation<Z3i::Space, Z3i::DigitalSet, TSep> SDT;
+  const Z3i::Domain & domain = shape.domain();
+  Metric metric;
+
+  trace.beginBlock( "DistanceTransformation, l_" + std::to_string( p ) );
+  DT dt( domain, shape, metric );
+  trace.endBlock();
+  trace.info() << "Memory: " << domain.size() * sizeof( Z3i::Vector ) / 1024 << " KiB" << std::endl;
+
+  trace.beginBlock( "ScalarDistanceTransformation, l_" + std::to_string( p ) );
+  SDT sdt( domain, shape );
+  trace.endBlock();
+  trace.info() << "Memory: " << domain.size() * sizeof( typename SDT::RawValue ) / 1024 << " KiB" << std::endl;
+
+  for ( auto const & pt : domain )
+    if ( static_cast<typename Metric::RawValue>( sdt.rawDistance( pt ) )
+         != metric.rawDistance( pt, dt.getVoronoiVector( pt ) ) )
+      return false;
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking ScalarDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 256;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Z3i::DigitalSet shape( domain );
+  const Z3i::Point c = Z3i::Point::diagonal( size / 2 );
+  for ( auto pt : domain )
+    if ( ( pt - c ).norm() < size / 3 )
+      shape.insertNew( pt );
+
+  bool res = benchmarkLp<2, L2SquaredSeparableDistance<> >( shape );
+  res = benchmarkLp<1, L1SeparableDistance<> >( shape ) && res;
+
+  // No separable l_infinity metric for DistanceTransformation
+  trace.beginBlock( "ScalarDistanceTransformation, l_infinity" );
+  ScalarDistanceTransformation<Z3i::Space, Z3i::DigitalSet, LinfSeparableDistance<> > sdt( domain, shape );
+  trace.endBlock();
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
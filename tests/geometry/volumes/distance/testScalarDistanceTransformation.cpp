@@ -0,0 +1,174 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testScalarDistanceTransformation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ScalarDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CConstImage.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ScalarDistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ScalarDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Random set of the domain minus @a nbSites points.
+template <typename TDigitalSet>
+TDigitalSet randomSet( const typename TDigitalSet::Domain & domain, unsigned int nbSites )
+{
+  typedef typename TDigitalSet::Point Point;
+  TDigitalSet set( domain );
+  for ( auto const & p : domain )
+    set.insertNew( p );
+  const Point extent = domain.upperBound() - domain.lowerBound() + Point::diagonal( 1 );
+  for ( unsigned int i = 0; i < nbSites; ++i )
+    {
+      Point p = domain.lowerBound();
+      for ( Dimension k = 0; k < Point::dimension; ++k )
+        p[ k ] += rand() % extent[ k ];
+      set.erase( p );
+    }
+  return set;
+}
+
+/// Number of points where the raw distances differ from the raw
+/// distances of the metric to the Voronoi sites.
+template <typename TSpace, typename TDigitalSet, DGtal::uint32_t p, typename TSep>
+unsigned int compareWithVoronoi( const TDigitalSet & set )
+{
+  typedef ExactPredicateLpSeparableMetric<TSpace, p> Metric;
+  typedef DistanceTransformation<TSpace, TDigitalSet, Metric> DT;
+  typedef ScalarDistanceTransformation<TSpace, TDigitalSet, TSep> SDT;
+
+  Metric metric;
+  DT dt( set.domain(), set, metric );
+  SDT sdt( set.domain(), set );
+
+  unsigned int nbDiff = 0;
+  for ( auto const & pt : set.domain() )
+    if ( static_cast<typename Metric::RawValue>( sdt.rawDistance( pt ) )
+         != metric.rawDistance( pt, dt.getVoronoiVector( pt ) ) )
+      ++nbDiff;
+  return nbDiff;
+}
+
+TEST_CASE( "Testing ScalarDistanceTransformation" )
+{
+  typedef ScalarDistanceTransformation<Z2i::Space, Z2i::DigitalSet> SDT2;
+  BOOST_CONCEPT_ASSERT(( concepts::CConstImage< SDT2 > ));
+
+  const Z2i::Domain domain2( Z2i::Point( -3, 2 ), Z2i::Point( 60, 45 ) );
+  const Z3i::Domain domain3( Z3i::Point( -3, 2, 0 ), Z3i::Point( 30, 25, 20 ) );
+  const Z2i::DigitalSet set2 = randomSet<Z2i::DigitalSet>( domain2, 30 );
+  const Z3i::DigitalSet set3 = randomSet<Z3i::DigitalSet>( domain3, 40 );
+
+  SECTION( "Squared Euclidean distances" )
+    {
+      REQUIRE( ( compareWithVoronoi<Z2i::Space, Z2i::DigitalSet, 2,
+                 L2SquaredSeparableDistance<> >( set2 ) == 0 ) );
+      REQUIRE( ( compareWithVoronoi<Z3i::Space, Z3i::DigitalSet, 2,
+                 L2SquaredSeparableDistance<> >( set3 ) == 0 ) );
+
+      typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+      L2Metric l2;
+      DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> dt( domain3, set3, l2 );
+      ScalarDistanceTransformation<Z3i::Space, Z3i::DigitalSet> sdt( domain3, set3 );
+      unsigned int nbDiff = 0;
+      for ( auto const & p : domain3 )
+        if ( std::abs( dt( p ) - sdt( p ) ) > 1e-10 )
+          ++nbDiff;
+      REQUIRE( nbDiff == 0 );
+    }
+
+  SECTION( "L1 distances" )
+    {
+      REQUIRE( ( compareWithVoronoi<Z2i::Space, Z2i::DigitalSet, 1,
+                 L1SeparableDistance<> >( set2 ) == 0 ) );
+      REQUIRE( ( compareWithVoronoi<Z3i::Space, Z3i::DigitalSet, 1,
+                 L1SeparableDistance<> >( set3 ) == 0 ) );
+    }
+
+  SECTION( "Linf distances (brute force)" )
+    {
+      typedef ScalarDistanceTransformation<Z3i::Space, Z3i::DigitalSet,
+                                           LinfSeparableDistance<> > SDT;
+      SDT sdt( domain3, set3 );
+      std::vector<Z3i::Point> sites;
+      for ( auto const & q : domain3 )
+        if ( ! set3( q ) )
+          sites.push_back( q );
+      unsigned int nbDiff = 0;
+      for ( auto const & p : domain3 )
+        {
+          SDT::RawValue d = SDT::infinity();
+          for ( auto const & q : sites )
+            d = std::min( d, static_cast<SDT::RawValue>( ( p - q ).normInfinity() ) );
+          if ( sdt.rawDistance( p ) != d )
+            ++nbDiff;
+        }
+      REQUIRE( nbDiff == 0 );
+    }
+
+  SECTION( "Without site" )
+    {
+      Z2i::DigitalSet full( domain2 );
+      for ( auto const & p : domain2 )
+        full.insertNew( p );
+      SDT2 sdt( domain2, full );
+      REQUIRE( sdt.rawDistance( Z2i::Point( 0, 10 ) ) == SDT2::infinity() );
+      REQUIRE( sdt( Z2i::Point( 0, 10 ) ) == std::numeric_limits<double>::infinity() );
+    }
+
+  SECTION( "Independence from the number of threads" )
+    {
+      typedef ScalarDistanceTransformation<Z3i::Space, Z3i::DigitalSet> SDT3;
+      ParallelFor::setNbThreads( 1 );
+      SDT3 reference( domain3, set3 );
+      for ( unsigned int n : { 2, 5 } )
+        {
+          ParallelFor::setNbThreads( n );
+          SDT3 sdt( domain3, set3 );
+          REQUIRE( sdt.rawImage() == reference.rawImage() );
+          REQUIRE( sdt.passDurations().size() == 3 );
+        }
+      ParallelFor::setNbThreads( 0 );
+    }
+}
+
+/** @ingroup Tests **/
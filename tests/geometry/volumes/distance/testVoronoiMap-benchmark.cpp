@@ -0,0 +1,123 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the dimension passes of VoronoiMap and
+ * DistanceTransformation for several numbers of threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/BasicPointPredicates.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+typedef functors::NotPointPredicate<Z3i::DigitalSet> Predicate;
+typedef VoronoiMap<Z3i::Space, Predicate, L2Metric> Voro;
+typedef DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2Metric> DT;
+
+template <typename TMap>
+void reportPasses( const TMap & map, double total )
+{
+  const std::vector<double> & passes = map.passDurations();
+  trace.info() << "Total: " << total << " ms, passes (ms):";
+  for ( auto t : passes )
+    trace.info() << " " << t;
+  trace.info() << std::endl;
+}
+
+bool benchmarkVoronoiMap( int size, unsigned int nbSites )
+{
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Z3i::DigitalSet sites( domain );
+  for ( unsigned int i = 0; i < nbSites; ++i )
+    sites.insert( Z3i::Point( rand() % size, rand() % size, rand() % size ) );
+  Predicate notSetPred( sites );
+
+  Z3i::DigitalSet shape( domain );
+  const Z3i::Point c = Z3i::Point::diagonal( size / 2 );
+  for ( auto p : domain )
+    if ( ( p - c ).norm() < size / 3 )
+      shape.insertNew( p );
+
+  L2Metric l2;
+  const unsigned int maxThreads = ParallelFor::nbThreads();
+  std::vector<unsigned int> threads = { 1, 2, 4, 8, maxThreads };
+  std::sort( threads.begin(), threads.end() );
+  threads.erase( std::unique( threads.begin(), threads.end() ), threads.end() );
+
+  ParallelFor::setNbThreads( 1 );
+  Voro reference( domain, notSetPred, l2 );
+  bool ok = true;
+
+  for ( auto n : threads )
+  {
+    ParallelFor::setNbThreads( n );
+    trace.beginBlock( "VoronoiMap, " + std::to_string( n ) + " thread(s)" );
+    Voro voro( domain, notSetPred, l2 );
+    double t = trace.endBlock();
+    reportPasses( voro, t );
+    const Voro::ConstRange range = voro.constRange();
+    const Voro::ConstRange refRange = reference.constRange();
+    ok = ok && std::equal( range.begin(), range.end(), refRange.begin() );
+
+    trace.beginBlock( "DistanceTransformation, " + std::to_string( n ) + " thread(s)" );
+    DT dt( domain, shape, l2 );
+    t = trace.endBlock();
+    reportPasses( dt, t );
+  }
+  ParallelFor::setNbThreads( 0 );
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking VoronoiMap dimension passes" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 256;
+  bool res = benchmarkVoronoiMap( size, 1000 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
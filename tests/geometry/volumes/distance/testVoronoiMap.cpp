@@ -675,6 +675,54 @@ bool testSimple4D()
 }
 
 
+bool testThreads3D()
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef VoronoiMap<Z3i::Space, functors::NotPointPredicate<Z3i::DigitalSet>, L2Metric> Voro;
+
+  Z3i::Point a(-3, 0, 2);
+  Z3i::Point b(37, 32, 28);
+  Z3i::Domain domain(a,b);
+  L2Metric l2;
+
+  Z3i::DigitalSet sites(domain);
+  for(unsigned int i = 0 ; i < 64; ++i)
+    sites.insert( Z3i::Point( a[0] + rand() % (b[0] - a[0] + 1),
+                              a[1] + rand() % (b[1] - a[1] + 1),
+                              a[2] + rand() % (b[2] - a[2] + 1) ) );
+  functors::NotPointPredicate<Z3i::DigitalSet> notSetPred(sites);
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  for ( std::size_t i = 0; i < 8; ++i )
+    {
+      auto const periodicity = getPeriodicityFromInteger<3>(i);
+      trace.beginBlock( "Thread count independence with periodicity " + formatPeriodicity(periodicity) );
+
+      ParallelFor::setNbThreads( 1 );
+      Voro reference( domain, notSetPred, l2, periodicity );
+      for ( unsigned int threads = 2; threads <= 5; threads += 3 )
+        {
+          ParallelFor::setNbThreads( threads );
+          Voro voro( domain, notSetPred, l2, periodicity );
+          const Voro::ConstRange range = voro.constRange();
+          const Voro::ConstRange refRange = reference.constRange();
+          nbok += std::equal( range.begin(), range.end(), refRange.begin() ) ? 1 : 0;
+          nb++;
+          trace.info() << "(" << nbok << "/" << nb << ") "
+                       << threads << " threads, passes (ms): " << voro.passDurations()[0]
+                       << " " << voro.passDurations()[1] << " " << voro.passDurations()[2]
+                       << std::endl;
+        }
+      nbok += reference.passDurations().size() == 3 ? 1 : 0;
+      nb++;
+      trace.endBlock();
+    }
+  ParallelFor::setNbThreads( 0 );
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -696,6 +744,7 @@ int main( int argc, char** argv )
     && testSimple3D()
     && testSimpleRandom3D()
     && testSimple4D()
+    && testThreads3D()
     ; // && ... other tests
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/Shortcuts.h"
 #include "DGtalCatch.h"
@@ -82,5 +83,84 @@ SCENARIO( "Shortcuts< K3 > pointel ordering", "[shortcuts][pointel]" )
   }
 }
 
+SCENARIO( "Shortcuts< K3 > boundary components", "[shortcuts][components]" )
+{
+  typedef KhalimskySpaceND<3>                       KSpace;
+  typedef Shortcuts< KSpace >                       SH3;
+
+  auto params          = SH3::defaultParameters();
+  // Three balls of decreasing radii and a cube with a hollow cavity.
+  SH3::Domain domain( SH3::Point( 0, 0, 0 ), SH3::Point( 39, 29, 19 ) );
+  auto binary_image    = SH3::makeBinaryImage( domain );
+  const SH3::Point centers[ 3 ] = { SH3::Point( 8, 8, 9 ), SH3::Point( 24, 8, 9 ), SH3::Point( 8, 22, 9 ) };
+  const int        radii[ 3 ]   = { 6, 4, 2 };
+  for ( auto&& p : domain )
+    {
+      bool in = p[ 0 ] >= 25 && p[ 0 ] <= 35 && p[ 1 ] >= 18 && p[ 1 ] <= 27
+        && p[ 2 ] >= 4 && p[ 2 ] <= 15
+        && ! ( p[ 0 ] >= 29 && p[ 0 ] <= 31 && p[ 1 ] >= 22 && p[ 1 ] <= 23 && p[ 2 ] >= 9 && p[ 2 ] <= 10 );
+      for ( int i = 0; i < 3; ++i )
+        in = in || ( p - centers[ i ] ).dot( p - centers[ i ] ) <= radii[ i ] * radii[ i ];
+      binary_image->setValue( p, in );
+    }
+  auto K               = SH3::getKSpace( binary_image );
+
+  GIVEN( "The boundary components of the binary image" ) {
+    auto components    = SH3::getSurfelComponents( binary_image, K, params );
+    auto all_surface   = SH3::makeDigitalSurface( binary_image, K, params );
+    THEN( "There is one component per ball, and two for the hollow cube, the largest first" ) {
+      REQUIRE( components.size() == 5 );
+      std::size_t nb_surfels = 0;
+      for ( std::size_t i = 0; i < components.size(); ++i )
+        {
+          nb_surfels += components[ i ].size();
+          if ( i > 0 ) REQUIRE( components[ i - 1 ].size() >= components[ i ].size() );
+        }
+      REQUIRE( nb_surfels == all_surface->size() );
+      REQUIRE( components[ 0 ].size() == 2 * ( 11 * 10 + 10 * 12 + 11 * 12 ) );
+      REQUIRE( components.back().size() == 2 * ( 3 * 2 + 2 * 2 + 3 * 2 ) );
+    }
+    THEN( "The largest surfaces are the largest component" ) {
+      auto largest     = SH3::makeLargestDigitalSurface( binary_image, K, params );
+      REQUIRE( largest->size() == components[ 0 ].size() );
+      params( "surfaceComponents", "Largest" );
+      auto idx_surface = SH3::makeIdxDigitalSurface( binary_image, K, params );
+      REQUIRE( idx_surface->nbVertices() == components[ 0 ].size() );
+      auto light_surfaces = SH3::makeLightDigitalSurfaces( binary_image, K, params );
+      REQUIRE( light_surfaces.size() == 1 );
+      REQUIRE( light_surfaces[ 0 ]->size() == components[ 0 ].size() );
+    }
+    THEN( "Light digital surfaces are built for all the components" ) {
+      params( "surfaceComponents", "All" );
+      SH3::SurfelRange reps;
+      auto light_surfaces = SH3::makeLightDigitalSurfaces( reps, binary_image, K, params );
+      REQUIRE( light_surfaces.size() == components.size() );
+      REQUIRE( reps.size() == components.size() );
+      std::vector< std::size_t > light_sizes, sizes;
+      for ( std::size_t i = 0; i < components.size(); ++i )
+        {
+          light_sizes.push_back( light_surfaces[ i ]->size() );
+          sizes.push_back( components[ i ].size() );
+        }
+      std::sort( light_sizes.begin(), light_sizes.end() );
+      std::sort( sizes.begin(), sizes.end() );
+      REQUIRE( light_sizes == sizes );
+    }
+    THEN( "Light digital surfaces are ordered and represented by their smallest surfels" ) {
+      params( "surfaceComponents", "All" );
+      SH3::SurfelRange reps;
+      auto light_surfaces = SH3::makeLightDigitalSurfaces( reps, binary_image, K, params );
+      for ( std::size_t i = 0; i < reps.size(); ++i )
+        {
+          SH3::Surfel smallest = *( light_surfaces[ i ]->begin() );
+          for ( auto&& s : *light_surfaces[ i ] )
+            smallest = std::min( smallest, s );
+          REQUIRE( reps[ i ] == smallest );
+          if ( i > 0 ) REQUIRE( reps[ i - 1 ] < reps[ i ] );
+        }
+    }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
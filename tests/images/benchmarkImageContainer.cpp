@@ -36,10 +36,15 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/BitPackedBinaryImage.h"
+#include "DGtal/images/ImageContainerBySparseBlocks.h"
 
 #include "DGtal/helpers/StdDefs.h"
 #include <map>
+#include <memory>
+#include <random>
 #include <string>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -50,6 +55,7 @@ using namespace DGtal;
 typedef DGtal::ImageContainerBySTLVector< Z2i::Domain, DGtal::int32_t> ImageVector2;
 typedef DGtal::ImageContainerBySTLMap< Z2i::Domain, DGtal::int32_t> ImageMap2;
 typedef DGtal::experimental::ImageContainerByHashTree< Z2i::Domain, DGtal::int32_t> ImageHash2;
+typedef DGtal::ImageContainerBySparseBlocks< Z2i::Domain, DGtal::int32_t> ImageSparse2;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -66,6 +72,7 @@ static void BM_Constructor(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_Constructor, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_Constructor, ImageMap2)->Range(1<<3 , 1 << 16);
 BENCHMARK_TEMPLATE(BM_Constructor, ImageHash2)->Range(1<<3 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_Constructor, ImageSparse2)->Range(1<<3 , 1 << 16);
 
 template<typename Point>
 std::set<Point> ConstructRandomSet(unsigned int size, unsigned int maxWidth) {
@@ -109,6 +116,7 @@ static void BM_SetValue(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_SetValue, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageMap2)->Range(1<<3 , 1 << 16);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageHash2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_SetValue, ImageSparse2)->Range(1<<3 , 1 << 16);
 
 template<typename Q>
 static void BM_RangeScan(benchmark::State& state)
@@ -135,6 +143,7 @@ static void BM_RangeScan(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(BM_RangeScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_RangeScan, ImageMap2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_RangeScan, ImageSparse2)->Range(1<<3 , 1 << 10);
 
 template<typename Q>
 static void BM_DomainScan(benchmark::State& state)
@@ -161,6 +170,316 @@ static void BM_DomainScan(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageMap2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_DomainScan, ImageSparse2)->Range(1<<3 , 1 << 10);
+
+/////// Binary images: std::vector<bool> storage vs bit-packed words
+
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, bool> BinaryImageVector3;
+typedef DGtal::BitPackedBinaryImage< Z3i::Domain > BinaryImagePacked3;
+
+/// A ball of radius n/3 centered in the domain [0,n]^3.
+template<typename Q>
+static void MakeBall(Q& image, int n)
+{
+  const Z3i::Point c = Z3i::Point::diagonal( n / 2 );
+  const int r2 = ( n / 3 ) * ( n / 3 );
+  std::transform( image.domain().begin(), image.domain().end(), image.begin(),
+                  [&] ( const Z3i::Point& p ) { return ( p - c ).dot( p - c ) <= r2; } );
+}
+
+static void Intersect(BinaryImageVector3& a, const BinaryImageVector3& b)
+{
+  auto itB = b.begin();
+  for(auto it = a.begin(), itend = a.end(); it != itend; ++it, ++itB)
+    *it = *it && *itB;
+}
+static void Intersect(BinaryImagePacked3& a, const BinaryImagePacked3& b)
+{ a &= b; }
+
+static size_t Volume(const BinaryImageVector3& a)
+{ return std::count( a.begin(), a.end(), true ); }
+static size_t Volume(const BinaryImagePacked3& a)
+{ return a.count(); }
+
+static size_t Boundary(const BinaryImageVector3& a)
+{
+  const Z3i::Domain& dom = a.domain();
+  size_t nb = 0;
+  for(auto && p : dom)
+    {
+      if ( ! a( p ) ) continue;
+      bool border = false;
+      for(Dimension k = 0; k < 3 && ! border; ++k)
+        for(int d = -1; d <= 1; d += 2)
+          {
+            Z3i::Point q = p;
+            q[ k ] += d;
+            border = border || ! dom.isInside( q ) || ! a( q );
+          }
+      nb += border ? 1 : 0;
+    }
+  return nb;
+}
+static size_t Boundary(const BinaryImagePacked3& a)
+{ return a.boundary().count(); }
+
+template<typename Q>
+static void BM_BinaryThreshold(benchmark::State& state)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0)));
+  Q image( dom );
+  while (state.KeepRunning())
+    MakeBall( image, state.range(0) );
+}
+BENCHMARK_TEMPLATE(BM_BinaryThreshold, BinaryImageVector3)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_BinaryThreshold, BinaryImagePacked3)->Range(1<<5 , 1 << 8);
+
+template<typename Q>
+static void BM_BinaryIntersection(benchmark::State& state)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0)));
+  Q a( dom ), b( dom );
+  MakeBall( a, state.range(0) );
+  MakeBall( b, state.range(0) / 2 );
+  while (state.KeepRunning())
+    Intersect( a, b );
+}
+BENCHMARK_TEMPLATE(BM_BinaryIntersection, BinaryImageVector3)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_BinaryIntersection, BinaryImagePacked3)->Range(1<<5 , 1 << 8);
+
+template<typename Q>
+static void BM_BinaryVolume(benchmark::State& state)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0)));
+  Q image( dom );
+  MakeBall( image, state.range(0) );
+  size_t vol = 0;
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( vol = Volume( image ) );
+  std::stringstream ss;
+  ss << vol;
+  state.SetLabel(ss.str());
+}
+BENCHMARK_TEMPLATE(BM_BinaryVolume, BinaryImageVector3)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_BinaryVolume, BinaryImagePacked3)->Range(1<<5 , 1 << 8);
+
+template<typename Q>
+static void BM_BinaryBoundary(benchmark::State& state)
+{
+  Z3i::Domain dom(Z3i::Point::diagonal(0), Z3i::Point::diagonal(state.range(0)));
+  Q image( dom );
+  MakeBall( image, state.range(0) );
+  size_t nb = 0;
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( nb = Boundary( image ) );
+  std::stringstream ss;
+  ss << nb;
+  state.SetLabel(ss.str());
+}
+BENCHMARK_TEMPLATE(BM_BinaryBoundary, BinaryImageVector3)->Range(1<<5 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_BinaryBoundary, BinaryImagePacked3)->Range(1<<5 , 1 << 8);
+
+
+
+/////// Sparse volumes: thin structures in large 3D domains
+
+typedef DGtal::ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t> ImageVector3;
+typedef DGtal::ImageContainerBySTLMap< Z3i::Domain, DGtal::int32_t> ImageMap3;
+typedef DGtal::experimental::ImageContainerByHashTree< Z3i::Domain, DGtal::int32_t> ImageHash3;
+typedef DGtal::ImageContainerBySparseBlocks< Z3i::Domain, DGtal::int32_t> ImageSparse3;
+
+/// Points of a digital sphere of radius n/3 (one voxel thick) centered
+/// in the domain [0,n]^3, in the order of the domain.
+static std::vector<Z3i::Point> MakeShell(int n)
+{
+  std::vector<Z3i::Point> shell;
+  const Z3i::Point c = Z3i::Point::diagonal( n / 2 );
+  const double r = n / 3;
+  for(int z = 0; z <= n; ++z)
+    for(int y = 0; y <= n; ++y)
+      for(int x = 0; x <= n; ++x)
+        {
+          const Z3i::Point p( x, y, z );
+          const double d = ( p - c ).norm();
+          if ( d >= r && d < r + 1 ) shell.push_back( p );
+        }
+  return shell;
+}
+
+/// Constructs an image of the domain [0,n]^3 (hash trees get a large hash table).
+template<typename Q>
+static Q* NewImage(int n)
+{ return new Q( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n ) ) ); }
+template<>
+ImageHash3* NewImage<ImageHash3>(int n)
+{ return new ImageHash3( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( n ) ), 20 ); }
+
+template<typename Q>
+static void BM_SparseSetValue(benchmark::State& state)
+{
+  std::vector<Z3i::Point> shell = MakeShell( state.range(0) );
+  std::shuffle( shell.begin(), shell.end(), std::mt19937( 0 ) );
+  while (state.KeepRunning())
+    {
+      std::unique_ptr<Q> image( NewImage<Q>( state.range(0) ) );
+      for(auto && p : shell)
+        image->setValue( p, 42 );
+    }
+  state.SetItemsProcessed( state.iterations() * shell.size() );
+}
+BENCHMARK_TEMPLATE(BM_SparseSetValue, ImageVector3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseSetValue, ImageMap3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseSetValue, ImageHash3)->Range(1<<6 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_SparseSetValue, ImageSparse3)->Range(1<<6 , 1 << 9);
+
+/// Bulk load of the shell in a sparse block image.
+static void BM_SparseBulkLoad(benchmark::State& state)
+{
+  std::vector<Z3i::Point> shell = MakeShell( state.range(0) );
+  std::shuffle( shell.begin(), shell.end(), std::mt19937( 0 ) );
+  while (state.KeepRunning())
+    {
+      std::unique_ptr<ImageSparse3> image( NewImage<ImageSparse3>( state.range(0) ) );
+      image->setNbThreads( state.range(1) );
+      image->setValues( shell.data(), shell.size(), 42 );
+    }
+  state.SetItemsProcessed( state.iterations() * shell.size() );
+}
+BENCHMARK(BM_SparseBulkLoad)->RangeMultiplier(8)->Ranges({{1<<6, 1<<9}, {1, 4}})->UseRealTime();
+
+template<typename Q>
+static void BM_SparseGetValue(benchmark::State& state)
+{
+  std::vector<Z3i::Point> shell = MakeShell( state.range(0) );
+  std::unique_ptr<Q> image( NewImage<Q>( state.range(0) ) );
+  for(auto && p : shell)
+    image->setValue( p, 42 );
+  std::shuffle( shell.begin(), shell.end(), std::mt19937( 0 ) );
+  int64_t sum = 0;
+  while (state.KeepRunning())
+    for(auto && p : shell)
+      benchmark::DoNotOptimize( sum += (*image)( p ) );
+  state.SetItemsProcessed( state.iterations() * shell.size() );
+}
+BENCHMARK_TEMPLATE(BM_SparseGetValue, ImageVector3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseGetValue, ImageMap3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseGetValue, ImageHash3)->Range(1<<6 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_SparseGetValue, ImageSparse3)->Range(1<<6 , 1 << 9);
+
+/// Coherent reads: 6-neighborhoods of the shell points, in the order
+/// of the domain, through operator() or a cached accessor.
+template<typename Q>
+static int64_t SumNeighbors(const Q& image, const std::vector<Z3i::Point>& shell)
+{
+  int64_t sum = 0;
+  for(auto && p : shell)
+    for(Dimension k = 0; k < 3; ++k)
+      sum += image( p + Z3i::Point::base( k ) ) + image( p - Z3i::Point::base( k ) );
+  return sum;
+}
+static int64_t SumNeighbors(ImageSparse3::ConstAccessor acc, const std::vector<Z3i::Point>& shell)
+{
+  int64_t sum = 0;
+  for(auto && p : shell)
+    for(Dimension k = 0; k < 3; ++k)
+      sum += acc( p + Z3i::Point::base( k ) ) + acc( p - Z3i::Point::base( k ) );
+  return sum;
+}
+
+template<typename Q>
+static void BM_SparseNeighborhoods(benchmark::State& state)
+{
+  std::vector<Z3i::Point> shell = MakeShell( state.range(0) );
+  std::unique_ptr<Q> image( NewImage<Q>( state.range(0) ) );
+  for(auto && p : shell)
+    image->setValue( p, 1 );
+  int64_t sum = 0;
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( sum = SumNeighbors( *image, shell ) );
+  state.SetItemsProcessed( state.iterations() * shell.size() * 6 );
+}
+BENCHMARK_TEMPLATE(BM_SparseNeighborhoods, ImageVector3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseNeighborhoods, ImageMap3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseNeighborhoods, ImageSparse3)->Range(1<<6 , 1 << 9);
+
+static void BM_SparseNeighborhoodsAccessor(benchmark::State& state)
+{
+  std::vector<Z3i::Point> shell = MakeShell( state.range(0) );
+  std::unique_ptr<ImageSparse3> image( NewImage<ImageSparse3>( state.range(0) ) );
+  image->setValues( shell.data(), shell.size(), 1 );
+  int64_t sum = 0;
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( sum = SumNeighbors( image->constAccessor(), shell ) );
+  state.SetItemsProcessed( state.iterations() * shell.size() * 6 );
+}
+BENCHMARK(BM_SparseNeighborhoodsAccessor)->Range(1<<6 , 1 << 9);
+
+/// Iteration over the non-background values only.
+static int64_t SumActive(const ImageVector3& image)
+{
+  int64_t sum = 0;
+  for(auto v : image)
+    if ( v != 0 ) sum += v;
+  return sum;
+}
+static int64_t SumActive(const ImageMap3& image)
+{
+  int64_t sum = 0;
+  for(auto && pv : image)
+    sum += pv.second;
+  return sum;
+}
+static int64_t SumActive(const ImageSparse3& image)
+{
+  int64_t sum = 0;
+  for(auto it = image.activeBegin(), itend = image.activeEnd(); it != itend; ++it)
+    sum += it.value();
+  return sum;
+}
+
+template<typename Q>
+static void BM_SparseActiveScan(benchmark::State& state)
+{
+  std::vector<Z3i::Point> shell = MakeShell( state.range(0) );
+  std::unique_ptr<Q> image( NewImage<Q>( state.range(0) ) );
+  for(auto && p : shell)
+    image->setValue( p, 1 );
+  int64_t sum = 0;
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( sum = SumActive( *image ) );
+  state.SetItemsProcessed( state.iterations() * shell.size() );
+  std::stringstream ss;
+  ss << sum;
+  state.SetLabel(ss.str());
+}
+BENCHMARK_TEMPLATE(BM_SparseActiveScan, ImageVector3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseActiveScan, ImageMap3)->Range(1<<6 , 1 << 9);
+BENCHMARK_TEMPLATE(BM_SparseActiveScan, ImageSparse3)->Range(1<<6 , 1 << 9);
+
+/// Conversions between dense and sparse block images.
+static void BM_SparseFromDense(benchmark::State& state)
+{
+  std::vector<Z3i::Point> shell = MakeShell( state.range(0) );
+  std::unique_ptr<ImageVector3> dense( NewImage<ImageVector3>( state.range(0) ) );
+  for(auto && p : shell)
+    dense->setValue( p, 1 );
+  while (state.KeepRunning())
+    ImageSparse3 image( *dense, 0, state.range(1) );
+  state.SetItemsProcessed( state.iterations() * dense->domain().size() );
+}
+BENCHMARK(BM_SparseFromDense)->RangeMultiplier(8)->Ranges({{1<<6, 1<<9}, {1, 4}})->UseRealTime();
+
+static void BM_SparseToDense(benchmark::State& state)
+{
+  std::vector<Z3i::Point> shell = MakeShell( state.range(0) );
+  std::unique_ptr<ImageSparse3> image( NewImage<ImageSparse3>( state.range(0) ) );
+  image->setValues( shell.data(), shell.size(), 1 );
+  std::unique_ptr<ImageVector3> dense( NewImage<ImageVector3>( state.range(0) ) );
+  while (state.KeepRunning())
+    image->copyTo( *dense );
+  state.SetItemsProcessed( state.iterations() * dense->domain().size() );
+}
+BENCHMARK(BM_SparseToDense)->Range(1<<6 , 1 << 9);
 
 
 
@@ -0,0 +1,233 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBitPackedBinaryImage.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class BitPackedBinaryImage.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/BitPackedBinaryImage.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BitPackedBinaryImage.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /// Fills a bit-packed image and a reference image with random values.
+  template <typename TImage, typename TRefImage>
+  void randomFill( TImage & image, TRefImage & ref, int percent )
+  {
+    for ( auto && p : image.domain() )
+      {
+        const bool v = ( rand() % 100 ) < percent;
+        image.setValue( p, v );
+        ref.setValue( p, v );
+      }
+  }
+
+  /// @return 'true' iff both images have the same values.
+  template <typename TImage, typename TRefImage>
+  bool sameValues( const TImage & image, const TRefImage & ref )
+  {
+    for ( auto && p : image.domain() )
+      if ( image( p ) != ref( p ) ) return false;
+    return true;
+  }
+
+  /// @return the boundary of @a ref computed point by point.
+  template <typename TRefImage>
+  TRefImage bruteForceBoundary( const TRefImage & ref )
+  {
+    typedef typename TRefImage::Domain Domain;
+    typedef typename Domain::Point     Point;
+    const Domain & domain = ref.domain();
+    TRefImage result( domain );
+    for ( auto && p : domain )
+      {
+        if ( ! ref( p ) ) continue;
+        bool border = false;
+        for ( Dimension k = 0; k < Domain::dimension && ! border; ++k )
+          for ( int d = -1; d <= 1; d += 2 )
+            {
+              Point q = p;
+              q[ k ] += d;
+              if ( ! domain.isInside( q ) || ! ref( q ) ) border = true;
+            }
+        result.setValue( p, border );
+      }
+    return result;
+  }
+}
+
+TEST_CASE( "BitPackedBinaryImage concepts and basic services", "[bitpacked]" )
+{
+  typedef BitPackedBinaryImage< Z2i::Domain > Image;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+
+  Z2i::Domain domain( Z2i::Point( -3, 2 ), Z2i::Point( 97, 9 ) );
+  Image image( domain );
+  REQUIRE( image.isValid() );
+  REQUIRE( image.wordsPerRow() == 2 );
+  REQUIRE( image.nbRows() == 8 );
+  REQUIRE( image.count() == 0 );
+
+  SECTION( "Values are set and read point by point" )
+    {
+      image.setValue( Z2i::Point( -3, 2 ), true );
+      image.setValue( Z2i::Point( 60, 5 ), true );
+      image.setValue( Z2i::Point( 61, 5 ), true );
+      image.setValue( Z2i::Point( 97, 9 ), true );
+      REQUIRE( image( Z2i::Point( -3, 2 ) ) );
+      REQUIRE( image( Z2i::Point( 60, 5 ) ) );
+      REQUIRE( image( Z2i::Point( 61, 5 ) ) );
+      REQUIRE( image( Z2i::Point( 97, 9 ) ) );
+      REQUIRE( ! image( Z2i::Point( 62, 5 ) ) );
+      REQUIRE( image.count() == 4 );
+      image.setValue( Z2i::Point( 60, 5 ), false );
+      REQUIRE( ! image( Z2i::Point( 60, 5 ) ) );
+      REQUIRE( image.count() == 3 );
+    }
+
+  SECTION( "Iterators visit the values in the order of the domain" )
+    {
+      ImageContainerBySTLVector< Z2i::Domain, bool > ref( domain );
+      randomFill( image, ref, 50 );
+      auto it = image.begin();
+      bool ok = true;
+      for ( auto && p : domain )
+        ok = ok && ( *it++ == ref( p ) );
+      REQUIRE( ok );
+      REQUIRE( it == image.end() );
+      // Writes through the iterators.
+      for ( auto out = image.begin(), itEnd = image.end(); out != itEnd; ++out )
+        *out = ! *out;
+      image.flip();
+      REQUIRE( sameValues( image, ref ) );
+    }
+}
+
+TEST_CASE( "BitPackedBinaryImage word-level services", "[bitpacked]" )
+{
+  typedef BitPackedBinaryImage< Z3i::Domain >              Image;
+  typedef ImageContainerBySTLVector< Z3i::Domain, bool >   RefImage;
+  Z3i::Domain domain( Z3i::Point( 0, -2, 1 ), Z3i::Point( 69, 7, 6 ) );
+  srand( 0 );
+
+  Image a( domain ), b( domain );
+  RefImage ra( domain ), rb( domain );
+  randomFill( a, ra, 60 );
+  randomFill( b, rb, 30 );
+
+  SECTION( "Conversions from and to ImageContainerBySTLVector" )
+    {
+      ImageContainerBySTLVector< Z3i::Domain, unsigned char > gray( domain );
+      a.copyTo( gray, (unsigned char) 255, (unsigned char) 0 );
+      Image c( gray );
+      REQUIRE( sameValues( c, ra ) );
+      REQUIRE( gray( Z3i::Point( 3, 4, 5 ) ) == ( ra( Z3i::Point( 3, 4, 5 ) ) ? 255 : 0 ) );
+    }
+
+  SECTION( "Boolean operations are consistent with point-wise ones" )
+    {
+      Image c = a;  c &= b;
+      Image d = a;  d |= b;
+      Image e = a;  e ^= b;
+      bool ok = true;
+      for ( auto && p : domain )
+        ok = ok && c( p ) == ( ra( p ) && rb( p ) )
+          && d( p ) == ( ra( p ) || rb( p ) )
+          && e( p ) == ( ra( p ) != rb( p ) );
+      REQUIRE( ok );
+    }
+
+  SECTION( "Count and complement" )
+    {
+      Image::Size n = 0;
+      for ( auto && p : domain ) n += ra( p ) ? 1 : 0;
+      REQUIRE( a.count() == n );
+      a.flip();
+      REQUIRE( a.count() == domain.size() - n );
+      a.fill( true );
+      REQUIRE( a.count() == domain.size() );
+      // The padding bits are never set.
+      REQUIRE( ( a.words()[ a.wordsPerRow() - 1 ] >> 6 ) == 0 );
+      a.fill( false );
+      REQUIRE( a.count() == 0 );
+    }
+
+  SECTION( "Boundary extraction is consistent with a point-wise one" )
+    {
+      // A full block touching the domain border, and random noise.
+      for ( auto && p : domain )
+        if ( p[ 0 ] >= 10 && p[ 0 ] < 67 && p[ 1 ] < 5 )
+          {
+            a.setValue( p, true );
+            ra.setValue( p, true );
+          }
+      Image bd = a.boundary();
+      RefImage rbd = bruteForceBoundary( ra );
+      REQUIRE( sameValues( bd, rbd ) );
+      Image full( domain );
+      full.fill( true );
+      REQUIRE( full.boundary().count() == domain.size() - 68 * 8 * 4 );
+    }
+}
+
+TEST_CASE( "BitPackedBinaryImage as binary image of Shortcuts", "[bitpacked][shortcuts]" )
+{
+  typedef Shortcuts< Z3i::KSpace >                                       SH3;
+  typedef Shortcuts< Z3i::KSpace, BitPackedBinaryImage< Z3i::Domain > >  SH3Packed;
+  auto params          = SH3::defaultParameters();
+  params( "polynomial", "sphere1" )( "gridstep", 0.1 );
+  auto implicit_shape  = SH3::makeImplicitShape3D  ( params );
+  auto digitized_shape = SH3::makeDigitizedImplicitShape3D( implicit_shape, params );
+  auto binary_image    = SH3::makeBinaryImage      ( digitized_shape, params );
+  auto packed_image    = SH3Packed::makeBinaryImage( digitized_shape, params );
+  auto K               = SH3::getKSpace( params );
+  REQUIRE( sameValues( *packed_image, *binary_image ) );
+  auto surface         = SH3::makeLightDigitalSurface( binary_image, K, params );
+  auto packed_surface  = SH3Packed::makeLightDigitalSurface( packed_image, K, params );
+  REQUIRE( surface->size() > 0 );
+  REQUIRE( packed_surface->size() == surface->size() );
+  auto gray_scale      = SH3Packed::makeGrayScaleImage( packed_image );
+  REQUIRE( gray_scale->domain().size() == packed_image->domain().size() );
+  REQUIRE( (*gray_scale)( Z3i::Point( 0, 0, 0 ) ) == 255 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
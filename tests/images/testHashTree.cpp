@@ -183,6 +183,23 @@ bool testGetSetVal()
     trace.error() << "Get/Set test error"<<std::endl;
   nbok += result ? 1 : 0;
   nb++;
+
+  trace.beginBlock("Batched getValues consistency test");
+  std::vector<Point> points;
+  for( a[1] = 0; a[1] < 256; a[1]++)
+    for( a[0] = 0; a[0] < 256; a[0]++)
+      points.push_back( a );
+  std::vector<int> values( points.size() );
+  std::vector<Image::HashKey> keys( points.size() );
+  myImage.getValues( points.data(), points.size(), values.data() );
+  myImage.getKeys( points.data(), points.size(), keys.data() );
+  result = true;
+  for( std::size_t i = 0; i < points.size(); i++ )
+    result = result && values[ i ] == myImage( points[ i ] )
+      && keys[ i ] == myImage.getKey( points[ i ] );
+  trace.endBlock();
+  nbok += result ? 1 : 0;
+  nb++;
   
   trace.info() << myImage;
   trace.info() << myImageV;
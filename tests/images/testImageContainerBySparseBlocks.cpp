@@ -0,0 +1,258 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerBySparseBlocks.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerBySparseBlocks.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySparseBlocks.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerBySparseBlocks.
+///////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+  /// @return 'true' iff both images have the same values.
+  template <typename TImage, typename TRefImage>
+  bool sameValues( const TImage & image, const TRefImage & ref )
+  {
+    for ( auto && p : image.domain() )
+      if ( image( p ) != ref( p ) ) return false;
+    return true;
+  }
+
+  /// @return a random point of @a domain.
+  template <typename TDomain>
+  typename TDomain::Point randomPoint( const TDomain & domain )
+  {
+    typename TDomain::Point p;
+    for ( Dimension k = 0; k < TDomain::dimension; ++k )
+      p[ k ] = domain.lowerBound()[ k ]
+        + rand() % ( domain.upperBound()[ k ] - domain.lowerBound()[ k ] + 1 );
+    return p;
+  }
+}
+
+TEST_CASE( "ImageContainerBySparseBlocks concepts and basic services", "[sparseblocks]" )
+{
+  typedef ImageContainerBySparseBlocks< Z2i::Domain, int > Image;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+
+  // 8x8 leaves, 4x4 leaves per internal node.
+  typedef ImageContainerBySparseBlocks< Z3i::Domain, int, 3, 2 > Image3;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image3 > ));
+
+  Z2i::Domain domain( Z2i::Point( -3, 2 ), Z2i::Point( 97, 209 ) );
+  Image image( domain, -1 );
+  REQUIRE( image.isValid() );
+  REQUIRE( image.nbLeaves() == 0 );
+  REQUIRE( image( Z2i::Point( 5, 5 ) ) == -1 );
+
+  SECTION( "Values are set, read and deactivated point by point" )
+    {
+      image.setValue( Z2i::Point( -3, 2 ), 1 );
+      image.setValue( Z2i::Point( 4, 9 ), 2 );
+      image.setValue( Z2i::Point( 3, 9 ), -1 );
+      image.setValue( Z2i::Point( 97, 209 ), 4 );
+      REQUIRE( image( Z2i::Point( -3, 2 ) ) == 1 );
+      REQUIRE( image( Z2i::Point( 4, 9 ) ) == 2 );
+      REQUIRE( image( Z2i::Point( 97, 209 ) ) == 4 );
+      REQUIRE( image( Z2i::Point( 6, 9 ) ) == -1 );
+      // a point set to the background value is active.
+      REQUIRE( image.isActive( Z2i::Point( 3, 9 ) ) );
+      REQUIRE( ! image.isActive( Z2i::Point( 6, 9 ) ) );
+      REQUIRE( image.nbActive() == 4 );
+      // (-3,2), (4,9) and (3,9) share the first leaf.
+      REQUIRE( image.nbLeaves() == 2 );
+      REQUIRE( image.nbNodes() == 2 );
+      image.setValueOff( Z2i::Point( 4, 9 ) );
+      image.setValueOff( Z2i::Point( 50, 50 ) );
+      REQUIRE( image( Z2i::Point( 4, 9 ) ) == -1 );
+      REQUIRE( ! image.isActive( Z2i::Point( 4, 9 ) ) );
+      REQUIRE( image.nbActive() == 3 );
+      REQUIRE( image.nbLeaves() == 2 );
+      REQUIRE( image.isValid() );
+      image.clear();
+      REQUIRE( image.nbActive() == 0 );
+      REQUIRE( image( Z2i::Point( -3, 2 ) ) == -1 );
+    }
+
+  SECTION( "Random accesses are consistent with a dense image" )
+    {
+      ImageContainerBySTLVector< Z2i::Domain, int > ref( domain );
+      std::fill( ref.begin(), ref.end(), -1 );
+      Image::Accessor acc = image.accessor();
+      for ( unsigned int i = 0; i < 2000; ++i )
+        {
+          const Z2i::Point p = randomPoint( domain );
+          const int v = rand() % 100;
+          if ( i % 2 == 0 ) image.setValue( p, v );
+          else acc.setValue( p, v );
+          ref.setValue( p, v );
+        }
+      REQUIRE( sameValues( image, ref ) );
+      Image::ConstAccessor cacc = image.constAccessor();
+      bool ok = true;
+      for ( auto && p : domain )
+        ok = ok && cacc( p ) == ref( p ) && acc( p ) == ref( p );
+      REQUIRE( ok );
+      // values are also visited through the range.
+      auto itRef = ref.constRange().begin();
+      for ( auto v : image.constRange() )
+        ok = ok && v == *itRef++;
+      REQUIRE( ok );
+    }
+
+  SECTION( "Active points are iterated leaf by leaf" )
+    {
+      std::map<Z2i::Point, int> ref;
+      for ( unsigned int i = 0; i < 500; ++i )
+        {
+          const Z2i::Point p = randomPoint( domain );
+          image.setValue( p, i );
+          ref[ p ] = i;
+        }
+      std::map<Z2i::Point, int> visited;
+      for ( auto it = image.activeBegin(), itEnd = image.activeEnd(); it != itEnd; ++it )
+        {
+          REQUIRE( visited.count( it.point() ) == 0 );
+          visited[ (*it).first ] = (*it).second;
+        }
+      REQUIRE( visited == ref );
+      REQUIRE( image.nbActive() == ref.size() );
+    }
+}
+
+TEST_CASE( "ImageContainerBySparseBlocks bulk loads and conversions", "[sparseblocks]" )
+{
+  typedef ImageContainerBySparseBlocks< Z3i::Domain, int, 2, 2 > Image;
+  Z3i::Domain domain( Z3i::Point( -5, 0, 3 ), Z3i::Point( 30, 21, 40 ) );
+
+  // a thin shell of a ball, as a sparse image.
+  ImageContainerBySTLVector< Z3i::Domain, int > ref( domain );
+  Z3i::DigitalSet shell( domain );
+  const Z3i::Point c( 12, 10, 20 );
+  for ( auto && p : domain )
+    {
+      const auto d2 = ( p - c ).dot( p - c );
+      const bool in = d2 >= 64 && d2 < 100;
+      ref.setValue( p, in ? p[ 0 ] + p[ 1 ] : 0 );
+      if ( in ) shell.insertNew( p );
+    }
+
+  SECTION( "Conversions from and to ImageContainerBySTLVector" )
+    {
+      for ( unsigned int nbThreads : { 1u, 4u } )
+        {
+          Image image( ref, 0, nbThreads );
+          REQUIRE( image.nbActive() + std::count( ref.begin(), ref.end(), 0 )
+                   == domain.size() );
+          REQUIRE( image.nbLeaves() < domain.size() / 16 );
+          REQUIRE( sameValues( image, ref ) );
+          ImageContainerBySTLVector< Z3i::Domain, int > copy( domain );
+          image.copyTo( copy );
+          REQUIRE( std::equal( copy.begin(), copy.end(), ref.begin() ) );
+        }
+    }
+
+  SECTION( "Bulk loads are consistent with point by point loads" )
+    {
+      std::vector<Z3i::Point> points;
+      std::vector<int> values;
+      for ( unsigned int i = 0; i < 5000; ++i )
+        {
+          points.push_back( randomPoint( domain ) );
+          values.push_back( i );
+        }
+      Image expected( domain );
+      for ( std::size_t i = 0; i < points.size(); ++i )
+        expected.setValue( points[ i ], values[ i ] );
+      for ( unsigned int nbThreads : { 1u, 4u } )
+        {
+          Image image( domain );
+          image.setNbThreads( nbThreads );
+          image.setValues( points.data(), values.data(), points.size() );
+          REQUIRE( image.nbActive() == expected.nbActive() );
+          REQUIRE( sameValues( image, expected ) );
+        }
+    }
+
+  SECTION( "Conversions from and to digital sets" )
+    {
+      Image image( domain );
+      image.setValues( shell, 7 );
+      REQUIRE( image.nbActive() == shell.size() );
+      Z3i::DigitalSet active( domain );
+      image.insertActivePoints( active );
+      REQUIRE( active.size() == shell.size() );
+      bool ok = true;
+      for ( auto && p : shell )
+        ok = ok && active( p ) && image( p ) == 7;
+      REQUIRE( ok );
+    }
+}
+
+TEST_CASE( "ImageContainerBySparseBlocks on huge domains", "[sparseblocks]" )
+{
+  typedef ImageContainerBySparseBlocks< Z3i::Domain, int > Image;
+
+  // 8193^3 internal nodes: their linearized coordinates overflow 32 bits.
+  const Z3i::Integer n = Z3i::Integer( 1 ) << 20;
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( n, n, n ) );
+  Image image( domain, 0 );
+  const Z3i::Point p( 0, 0, 0 );
+  const Z3i::Point q( 8192, 1032320, 8064 );
+  const Z3i::Point r( n, n, n );
+  image.setValue( p, 7 );
+  REQUIRE( image( q ) == 0 );
+  REQUIRE( ! image.isActive( q ) );
+  image.setValue( q, 9 );
+  image.setValue( r, 11 );
+  REQUIRE( image.nbNodes() == 3 );
+  REQUIRE( image.nbLeaves() == 3 );
+  REQUIRE( image( p ) == 7 );
+  REQUIRE( image( q ) == 9 );
+  REQUIRE( image( r ) == 11 );
+  REQUIRE( image.nbActive() == 3 );
+  REQUIRE( image.isValid() );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
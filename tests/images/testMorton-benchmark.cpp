@@ -0,0 +1,178 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMorton-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Micro-benchmark of the Morton codes in 2D and 3D: the former bit by
+ * bit interleaving versus the MortonCodec methods (magic bits, lookup
+ * tables, BMI2), point by point and by arrays of points, and the
+ * accesses to an ImageContainerByHashTree with operator() and with
+ * getValues.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/Morton.h"
+#include "DGtal/images/ImageContainerByHashTree.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DGtal::uint64_t HashKey;
+
+/// Former implementation: interleaves the bits of the coordinates one by one.
+template <typename Point>
+HashKey bitByBitInterleave( const Point & p )
+{
+  const unsigned int coordSize = ( sizeof( HashKey ) * 8 ) / Point::dimension;
+  HashKey output = 0;
+  for ( unsigned int i = 0; i < coordSize; ++i )
+    for ( unsigned int n = 0; n < Point::dimension; ++n )
+      if ( ( static_cast<HashKey>( p[ n ] ) >> i ) & 1 )
+        output |= static_cast<HashKey>( 1 ) << ( i * Point::dimension + n );
+  return output;
+}
+
+/// Prints the duration of the encoding of the points in ns per point.
+void report( const std::string & name, double ms, std::size_t nb, HashKey checksum )
+{
+  trace.info() << name << ": " << 1e6 * ms / nb << " ns/point (checksum " << checksum << ")" << std::endl;
+}
+
+/// Benchmarks the encoding and decoding of random points.
+template <typename Point>
+bool benchmarkCodecs( const std::string & name, const std::size_t nb )
+{
+  trace.beginBlock( "Morton codes " + name );
+  const unsigned int coordSize = ( sizeof( HashKey ) * 8 ) / Point::dimension;
+  const std::size_t treeDepth = coordSize - 1;
+  srand( 0 );
+  std::vector<Point> points( nb );
+  for ( auto & p : points )
+    for ( unsigned int n = 0; n < Point::dimension; ++n )
+      p[ n ] = rand() % ( 1 << std::min<std::size_t>( treeDepth, 30 ) );
+  std::vector<HashKey> keys( nb );
+  std::vector<Point> decoded( nb );
+  Clock c;
+  bool ok = true;
+
+  HashKey reference = 0;
+  c.startClock();
+  for ( const auto & p : points ) reference += bitByBitInterleave( p );
+  report( "bit by bit", c.stopClock(), nb, reference );
+
+  std::vector<MortonCodec::Method> methods = { MortonCodec::MAGIC_BITS, MortonCodec::LOOKUP_TABLE };
+  const char * names[] = { "magic bits", "lookup table", "BMI2" };
+  if ( MortonCodec::hasBMI2() ) methods.push_back( MortonCodec::BMI2 );
+  Morton<HashKey, Point> morton;
+  for ( MortonCodec::Method method : methods )
+    {
+      morton.setMethod( method );
+      HashKey sum = 0;
+      c.startClock();
+      for ( const auto & p : points )
+        {
+          HashKey h;
+          morton.interleaveBits( p, h );
+          sum += h;
+        }
+      report( std::string( names[ method ] ) + ", point by point", c.stopClock(), nb, sum );
+      ok = ok && sum == reference;
+
+      c.startClock();
+      morton.interleaveBits( points.data(), nb, keys.data() );
+      const double t = c.stopClock();
+      sum = 0;
+      for ( auto k : keys ) sum += k;
+      report( std::string( names[ method ] ) + ", batched", t, nb, sum );
+      ok = ok && sum == reference;
+
+      morton.keysFromCoordinates( treeDepth, points.data(), nb, keys.data() );
+      c.startClock();
+      morton.coordinatesFromKeys( keys.data(), nb, decoded.data() );
+      report( std::string( names[ method ] ) + ", batched decoding", c.stopClock(), nb, 0 );
+      ok = ok && decoded == points;
+    }
+  trace.endBlock();
+  return ok;
+}
+
+/// Benchmarks the accesses to a 3D hash tree image.
+bool benchmarkHashTree( const std::size_t nb )
+{
+  trace.beginBlock( "ImageContainerByHashTree accesses" );
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Image;
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 255, 255, 255 ) );
+  // a realistic hash table size, the default one makes the lookups
+  // dominated by the traversal of the chained buckets
+  Image image( domain, 20 );
+  srand( 0 );
+  std::vector<Z3i::Point> points( nb );
+  for ( auto & p : points )
+    {
+      p = Z3i::Point( rand() % 256, rand() % 256, rand() % 256 );
+      image.setValue( p, p[ 0 ] + p[ 1 ] + p[ 2 ] );
+    }
+  Clock c;
+  long int sum = 0;
+  c.startClock();
+  for ( const auto & p : points ) sum += image( p );
+  report( "operator()", c.stopClock(), nb, sum );
+
+  std::vector<int> values( nb );
+  c.startClock();
+  image.getValues( points.data(), nb, values.data() );
+  const double t = c.stopClock();
+  long int sum2 = 0;
+  for ( auto v : values ) sum2 += v;
+  report( "getValues", t, nb, sum2 );
+  trace.endBlock();
+  return sum == sum2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+/**
+ * Usage: testMorton-benchmark [nb_points]
+ */
+int main( int argc, char** argv )
+{
+  const std::size_t nb = argc > 1 ? atol( argv[ 1 ] ) : 10000000;
+  trace.beginBlock ( "Benchmarking Morton codes" );
+  trace.info() << "BMI2 " << ( MortonCodec::hasBMI2() ? "available" : "not available" ) << std::endl;
+  bool res = benchmarkCodecs< PointVector<2, DGtal::int32_t> >( "2D", nb )
+    && benchmarkCodecs< PointVector<3, DGtal::int32_t> >( "3D", nb )
+    && benchmarkHashTree( nb / 10 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/images/Morton.h"
@@ -120,6 +122,84 @@ bool testMorton()
   return nbok == nb;
 }
 
+/**
+ * Reference implementation: interleave the bits of the coordinates
+ * one by one.
+ */
+template <typename HashKey, typename Point>
+HashKey referenceInterleave( const Point & p )
+{
+  const unsigned int coordSize = ( sizeof( HashKey ) * 8 ) / Point::dimension;
+  HashKey output = 0;
+  for ( unsigned int i = 0; i < coordSize; ++i )
+    for ( unsigned int n = 0; n < Point::dimension; ++n )
+      if ( ( static_cast<DGtal::uint64_t>( p[ n ] ) >> i ) & 1 )
+        output |= static_cast<HashKey>( 1 ) << ( i * Point::dimension + n );
+  return output;
+}
+
+/**
+ * Compares the codes of all the MortonCodec methods, single and
+ * batched, with the reference implementation, and checks that the
+ * coordinates are recovered from the keys.
+ */
+template <typename HashKey, typename Point>
+bool testMortonCodecs( const std::string & name )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Morton codecs " + name );
+
+  const unsigned int coordSize = ( sizeof( HashKey ) * 8 ) / Point::dimension;
+  const std::size_t treeDepth = coordSize - 1;
+  srand( 0 );
+  std::vector<Point> points( 1000 );
+  for ( std::size_t i = 0; i < points.size(); ++i )
+    for ( unsigned int n = 0; n < Point::dimension; ++n )
+      {
+        // random coordinates of treeDepth bits, the first ones being extremal
+        const DGtal::uint64_t r = ( static_cast<DGtal::uint64_t>( rand() ) << 32 ) ^ rand();
+        const DGtal::uint64_t v = i == 0 ? 0 : i == 1 ? ~static_cast<DGtal::uint64_t>( 0 ) : r;
+        points[ i ][ n ] = static_cast<typename Point::Coordinate>( v & ( ( static_cast<DGtal::uint64_t>( 1 ) << treeDepth ) - 1 ) );
+      }
+
+  // BMI2 falls back to the best available method on other processors.
+  std::vector<MortonCodec::Method> methods = { MortonCodec::MAGIC_BITS, MortonCodec::LOOKUP_TABLE,
+                                               MortonCodec::BMI2 };
+  trace.info() << "BMI2 " << ( MortonCodec::hasBMI2() ? "available" : "not available" ) << endl;
+
+  Morton<HashKey, Point> morton;
+  for ( MortonCodec::Method method : methods )
+    {
+      morton.setMethod( method );
+      const MortonCodec::Method expected = method == MortonCodec::BMI2 && ! MortonCodec::hasBMI2()
+        ? MortonCodec::bestMethod() : method;
+      std::vector<HashKey> keys( points.size() );
+      std::vector<Point> decoded( points.size() );
+      morton.keysFromCoordinates( treeDepth, points.data(), points.size(), keys.data() );
+      morton.coordinatesFromKeys( keys.data(), keys.size(), decoded.data() );
+      bool ok = morton.method() == expected;
+      for ( std::size_t i = 0; i < points.size(); ++i )
+        {
+          HashKey h;
+          morton.interleaveBits( points[ i ], h );
+          Point p;
+          morton.coordinatesFromKey( keys[ i ], p );
+          ok = ok && h == referenceInterleave<HashKey>( points[ i ] )
+            && keys[ i ] == morton.keyFromCoordinates( treeDepth, points[ i ] )
+            && p == points[ i ] && decoded[ i ] == points[ i ];
+        }
+      trace.info() << "Method " << method << ": " << ( ok ? "ok" : "error" ) << endl;
+      nbok += ok ? 1 : 0;
+      nb++;
+    }
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "codecs agree with the reference" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -131,7 +211,12 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMorton(); // && ... other tests
+  bool res = testMorton()
+    && testMortonCodecs<DGtal::uint64_t, PointVector<2, DGtal::int32_t> >( "2D, 64 bits" )
+    && testMortonCodecs<DGtal::uint64_t, PointVector<3, DGtal::int32_t> >( "3D, 64 bits" )
+    && testMortonCodecs<DGtal::uint32_t, PointVector<2, DGtal::int32_t> >( "2D, 32 bits" )
+    && testMortonCodecs<DGtal::uint32_t, PointVector<3, DGtal::int32_t> >( "3D, 32 bits" )
+    && testMortonCodecs<DGtal::uint64_t, PointVector<4, DGtal::int32_t> >( "4D, 64 bits" ); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,210 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVolReader-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of VolReader and LongvolReader import throughput.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/readers/LongvolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> LImage;
+
+///////////////////////////////////////////////////////////////////////////////
+// Previous import scheme: byte per byte read into a stringstream,
+// whole payload inflation, then setValue() along the domain.
+///////////////////////////////////////////////////////////////////////////////
+template <typename TImage, typename TWord>
+TImage legacyImport( const std::string & filename, const Z3i::Domain & domain,
+                     bool compressed )
+{
+  FILE * fin = fopen( filename.c_str(), "rb" );
+  char buf[128];
+  for ( char *line = fgets( buf, 128, fin );
+        line && strcmp( line, ".\n" ) != 0;
+        line = fgets( line, 128, fin ) )
+    ;
+
+  TImage image( domain );
+  const long int total = domain.size();
+  const long int totalbytes = total * sizeof( TWord );
+  std::stringstream main;
+  for ( long int count = 0; count < totalbytes; ++count )
+    main << static_cast<unsigned char>( getc( fin ) );
+  fclose( fin );
+
+  std::stringstream uncompressed;
+  std::stringstream * payload = &main;
+  if ( compressed )
+  {
+    boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+    in.push( boost::iostreams::zlib_decompressor() );
+    in.push( main );
+    boost::iostreams::copy( in, uncompressed );
+    payload = &uncompressed;
+  }
+
+  typename Z3i::Domain::ConstIterator it = domain.begin();
+  for ( long int i = 0; i < total; ++i, ++it )
+  {
+    TWord val = 0;
+    for ( unsigned int b = 0; b < sizeof( TWord ); ++b )
+      val |= static_cast<TWord>( static_cast<unsigned char>( payload->get() ) ) << ( 8 * b );
+    image.setValue( *it, val );
+  }
+  return image;
+}
+
+template <typename TImage>
+bool sameImages( const TImage & a, const TImage & b )
+{
+  return std::equal( a.begin(), a.end(), b.begin() );
+}
+
+void reportThroughput( const std::string & name, double bytes, double ms )
+{
+  trace.info() << name << ": " << ms << " ms, "
+               << ( bytes / ( 1024.0 * 1024.0 ) ) / ( ms / 1000.0 )
+               << " MB/s" << std::endl;
+}
+
+bool benchmarkVol( int size )
+{
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Image image( domain );
+  const Z3i::Point c = Z3i::Point::diagonal( size / 2 );
+  for ( auto p : domain )
+    image.setValue( p, static_cast<unsigned char>( ( p - c ).norm() ) );
+  VolWriter<Image>::exportVol( "bench.vol", image, false );
+  VolWriter<Image>::exportVol( "benchz.vol", image );
+
+  const double bytes = static_cast<double>( domain.size() );
+  bool ok = true;
+  double t;
+
+  trace.beginBlock( "Vol import (Version 2)" );
+  trace.beginBlock( "Legacy import" );
+  Image legacy = legacyImport<Image, unsigned char>( "bench.vol", domain, false );
+  t = trace.endBlock();
+  reportThroughput( "Legacy", bytes, t );
+  trace.beginBlock( "VolReader::importVol" );
+  Image current = VolReader<Image>::importVol( "bench.vol" );
+  t = trace.endBlock();
+  reportThroughput( "Chunked", bytes, t );
+  ok = ok && sameImages( legacy, image ) && sameImages( current, image );
+  trace.endBlock();
+
+  trace.beginBlock( "Vol import (Version 3)" );
+  trace.beginBlock( "Legacy import" );
+  Image legacyz = legacyImport<Image, unsigned char>( "benchz.vol", domain, true );
+  t = trace.endBlock();
+  reportThroughput( "Legacy", bytes, t );
+  trace.beginBlock( "VolReader::importVol" );
+  Image currentz = VolReader<Image>::importVol( "benchz.vol" );
+  t = trace.endBlock();
+  reportThroughput( "Chunked", bytes, t );
+  ok = ok && sameImages( legacyz, image ) && sameImages( currentz, image );
+  trace.endBlock();
+
+  return ok;
+}
+
+bool benchmarkLongvol( int size )
+{
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point::diagonal( size - 1 ) );
+  LImage image( domain );
+  for ( auto p : domain )
+    image.setValue( p, p[0] + size * ( p[1] + size * p[2] ) );
+  LongvolWriter<LImage>::exportLongvol( "bench.lvol", image, false );
+  LongvolWriter<LImage>::exportLongvol( "benchz.lvol", image );
+
+  const double bytes = static_cast<double>( domain.size() * sizeof( DGtal::uint64_t ) );
+  bool ok = true;
+  double t;
+
+  trace.beginBlock( "Longvol import (Version 2)" );
+  trace.beginBlock( "Legacy import" );
+  LImage legacy = legacyImport<LImage, DGtal::uint64_t>( "bench.lvol", domain, false );
+  t = trace.endBlock();
+  reportThroughput( "Legacy", bytes, t );
+  trace.beginBlock( "LongvolReader::importLongvol" );
+  LImage current = LongvolReader<LImage>::importLongvol( "bench.lvol" );
+  t = trace.endBlock();
+  reportThroughput( "Chunked", bytes, t );
+  ok = ok && sameImages( legacy, image ) && sameImages( current, image );
+  trace.endBlock();
+
+  trace.beginBlock( "Longvol import (Version 3)" );
+  trace.beginBlock( "Legacy import" );
+  LImage legacyz = legacyImport<LImage, DGtal::uint64_t>( "benchz.lvol", domain, true );
+  t = trace.endBlock();
+  reportThroughput( "Legacy", bytes, t );
+  trace.beginBlock( "LongvolReader::importLongvol" );
+  LImage currentz = LongvolReader<LImage>::importLongvol( "benchz.lvol" );
+  t = trace.endBlock();
+  reportThroughput( "Chunked", bytes, t );
+  ok = ok && sameImages( legacyz, image ) && sameImages( currentz, image );
+  trace.endBlock();
+
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking VolReader and LongvolReader" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 256;
+  bool res = benchmarkVol( size ) && benchmarkLongvol( size / 2 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
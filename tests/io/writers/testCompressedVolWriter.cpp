@@ -29,6 +29,11 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <cstdio>
+#include <zlib.h>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -36,8 +41,10 @@
 #include "DGtal/io/writers/LongvolWriter.h"
 #include "DGtal/io/readers/LongvolReader.h"
 #include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/VolPayloadWriter.h"
 #include "DGtal/io/readers/VolReader.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -111,4 +118,127 @@ TEST_CASE( "Testing CompressedLongvol" )
     }
 }
 
+TEST_CASE( "Testing chunked Vol/Longvol import" )
+{
+  // More voxels than VolPayloadReader::chunkSize bytes
+  Domain domain(Point(-3,0,2), Point(124,127,129));
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LImage;
+  Image image(domain);
+  LImage limage(domain);
+  unsigned int seed = 42;
+  for(auto p: domain)
+  {
+    seed = seed * 1103515245u + 12345u;
+    image.setValue(p, static_cast<unsigned char>( seed >> 16 ));
+    limage.setValue(p, ( static_cast<DGtal::uint64_t>( seed ) << 32 ) + p[0] + p[1] + p[2] );
+  }
+  VolWriter<Image>::exportVol("chunk.vol", image, false);
+  VolWriter<Image>::exportVol("chunkz.vol", image);
+  LongvolWriter<LImage>::exportLongvol("chunk.lvol", limage, false);
+  LongvolWriter<LImage>::exportLongvol("chunkz.lvol", limage);
+
+  SECTION("Testing ImageContainerBySTLVector import")
+  {
+    REQUIRE( checkImage(image, VolReader<Image>::importVol("chunk.vol")) );
+    REQUIRE( checkImage(image, VolReader<Image>::importVol("chunkz.vol")) );
+    REQUIRE( checkImage(limage, LongvolReader<LImage>::importLongvol("chunk.lvol")) );
+    REQUIRE( checkImage(limage, LongvolReader<LImage>::importLongvol("chunkz.lvol")) );
+  }
+
+  SECTION("Testing generic image container import")
+  {
+    typedef ImageContainerBySTLMap<Domain, unsigned char> MapImage;
+    MapImage read = VolReader<MapImage>::importVol("chunkz.vol");
+    bool ok = true;
+    for(auto p: domain)
+      ok = ok && ( read(p) == image(p) );
+    REQUIRE( ok );
+  }
+
+  SECTION("Testing truncated files")
+  {
+    std::ifstream in("chunkz.vol", std::ios::binary);
+    std::string content( (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>() );
+    std::ofstream out("truncz.vol", std::ios::binary);
+    out << content.substr(0, content.size() / 2);
+    out.close();
+    REQUIRE_THROWS_AS( VolReader<Image>::importVol("truncz.vol"), DGtal::IOException );
+  }
+}
+
+TEST_CASE( "Testing slab-wise Vol/Longvol export" )
+{
+  // Several slabs of VolPayloadWriter::slabBytes bytes
+  Domain domain(Point(2,-5,-7), Point(129,122,160));
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint64_t> LImage;
+  Image image(domain);
+  LImage limage(domain);
+  for(auto p: domain)
+  {
+    image.setValue(p, static_cast<unsigned char>( (p[0] * p[1] + p[2]) % 7 == 0 ? p[2] : 0 ));
+    limage.setValue(p, static_cast<DGtal::uint64_t>( p[0] + 1000 * p[1] ) * ( p[2] + 20 ));
+  }
+
+  SECTION("Testing compression levels")
+  {
+    for(int level = -1; level <= 9; level += 5)
+    {
+      VolWriter<Image>::exportVol("slabz.vol", image, true, functors::Identity(), level);
+      REQUIRE( checkImage(image, VolReader<Image>::importVol("slabz.vol")) );
+      LongvolWriter<LImage>::exportLongvol("slabz.lvol", limage, true, functors::Identity(), level);
+      REQUIRE( checkImage(limage, LongvolReader<LImage>::importLongvol("slabz.lvol")) );
+    }
+    VolWriter<Image>::exportVol("slabz.vol", image, true, functors::Identity(), 0);
+    REQUIRE( checkImage(image, VolReader<Image>::importVol("slabz.vol")) );
+  }
+
+  SECTION("Testing generic image container export")
+  {
+    typedef ImageContainerBySTLMap<Domain, unsigned char> MapImage;
+    MapImage mapImage(domain);
+    for(auto p: domain)
+      if ( image(p) != 0 )
+        mapImage.setValue(p, image(p));
+    VolWriter<MapImage>::exportVol("slabmap.vol", mapImage);
+    REQUIRE( checkImage(image, VolReader<Image>::importVol("slabmap.vol")) );
+  }
+
+  SECTION("Testing invalid compression level")
+  {
+    REQUIRE_THROWS_AS( VolWriter<Image>::exportVol("slabz.vol", image, true, functors::Identity(), 42),
+                       DGtal::IOException );
+    // Nothing is written
+    std::remove("invalidz.vol");
+    std::remove("invalidz.lvol");
+    REQUIRE_THROWS_AS( VolWriter<Image>::exportVol("invalidz.vol", image, true, functors::Identity(), -2),
+                       DGtal::IOException );
+    REQUIRE_THROWS_AS( LongvolWriter<LImage>::exportLongvol("invalidz.lvol", limage, true, functors::Identity(), 10),
+                       DGtal::IOException );
+    REQUIRE( ! std::ifstream("invalidz.vol").good() );
+    REQUIRE( ! std::ifstream("invalidz.lvol").good() );
+    std::ostringstream out;
+    REQUIRE_THROWS_AS( VolPayloadWriter::write<unsigned char>( out, image, functors::Identity(), true, 42 ),
+                       DGtal::IOException );
+    REQUIRE( out.str().empty() );
+  }
+}
+
+TEST_CASE( "Testing compressed export of an empty image" )
+{
+  Domain domain(Point(0,0,0), Point(-1,-1,-1));
+  typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+  Image image(domain);
+  std::ostringstream out;
+  VolPayloadWriter::write<unsigned char>( out, image, functors::Identity(), true );
+  const std::string stream = out.str();
+  // The zlib stream is complete, and has no data.
+  unsigned char byte = 0;
+  uLongf length = 1;
+  REQUIRE( uncompress( &byte, &length, reinterpret_cast<const Bytef*>( stream.data() ),
+                       static_cast<uLong>( stream.size() ) ) == Z_OK );
+  REQUIRE( length == 0 );
+}
+
 /** @ingroup Tests **/
@@ -0,0 +1,174 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testVolWriter-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of VolWriter, LongvolWriter and RawWriter export throughput.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/io/readers/VolReader.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/writers/LongvolWriter.h"
+#include "DGtal/io/writers/RawWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint64_t> LImage;
+
+///////////////////////////////////////////////////////////////////////////////
+// Previous export scheme: the whole payload is put in a stringstream,
+// then compressed through boost::iostreams in a single pass.
+///////////////////////////////////////////////////////////////////////////////
+void legacyExport( const std::string & filename, const Image & image,
+                   bool compressed )
+{
+  std::ofstream out( filename.c_str(), std::ios::out | std::ios::binary );
+  std::stringstream header;
+  std::stringstream main;
+  header << "X: " << image.extent()[0] << std::endl
+         << "Y: " << image.extent()[1] << std::endl
+         << "Z: " << image.extent()[2] << std::endl
+         << "Voxel-Size: 1" << std::endl << "Alpha-Color: 0" << std::endl
+         << "Version: " << ( compressed ? 3 : 2 ) << std::endl << "." << std::endl;
+  for ( auto p : image.domain() )
+    main.put( image( p ) );
+  if ( compressed )
+  {
+    boost::iostreams::filtering_streambuf<boost::iostreams::input> out_compressed;
+    out_compressed.push( boost::iostreams::zlib_compressor() );
+    out_compressed.push( main );
+    boost::iostreams::copy( out_compressed, header );
+    boost::iostreams::copy( header, out );
+  }
+  else
+    out << header.str() << main.str();
+}
+
+void reportThroughput( const std::string & name, double bytes, double ms,
+                       const std::string & filename )
+{
+  std::ifstream in( filename.c_str(), std::ios::binary | std::ios::ate );
+  trace.info() << name << ": " << ms << " ms, "
+               << ( bytes / ( 1024.0 * 1024.0 ) ) / ( ms / 1000.0 )
+               << " MB/s, file size " << in.tellg() << " bytes" << std::endl;
+}
+
+bool benchmarkVol( int size )
+{
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Image image( domain );
+  const Z3i::Point c = Z3i::Point::diagonal( size / 2 );
+  for ( auto p : domain )
+  {
+    const double d = ( p - c ).norm();
+    image.setValue( p, d < size / 3 ? static_cast<unsigned char>( 64 + ( rand() % 16 ) ) : 0 );
+  }
+  const double bytes = static_cast<double>( domain.size() );
+  bool ok = true;
+  double t;
+
+  trace.beginBlock( "Vol export (Version 2)" );
+  trace.beginBlock( "Legacy export" );
+  legacyExport( "bench-legacy.vol", image, false );
+  t = trace.endBlock();
+  reportThroughput( "Legacy", bytes, t, "bench-legacy.vol" );
+  trace.beginBlock( "VolWriter::exportVol" );
+  VolWriter<Image>::exportVol( "bench.vol", image, false );
+  t = trace.endBlock();
+  reportThroughput( "Slabs", bytes, t, "bench.vol" );
+  trace.endBlock();
+
+  trace.beginBlock( "Vol export (Version 3)" );
+  trace.beginBlock( "Legacy export" );
+  legacyExport( "bench-legacy.vol", image, true );
+  t = trace.endBlock();
+  reportThroughput( "Legacy", bytes, t, "bench-legacy.vol" );
+  for ( int level = 1; level <= 9; level += 4 )
+  {
+    std::stringstream name;
+    name << "VolWriter::exportVol level " << level;
+    trace.beginBlock( name.str() );
+    VolWriter<Image>::exportVol( "benchz.vol", image, true, functors::Identity(), level );
+    t = trace.endBlock();
+    reportThroughput( name.str(), bytes, t, "benchz.vol" );
+    Image read = VolReader<Image>::importVol( "benchz.vol" );
+    ok = ok && std::equal( read.begin(), read.end(), image.begin() );
+  }
+  trace.endBlock();
+  return ok;
+}
+
+bool benchmarkLongvolAndRaw( int size )
+{
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point::diagonal( size - 1 ) );
+  LImage image( domain );
+  for ( auto p : domain )
+    image.setValue( p, p[0] + size * ( p[1] + size * p[2] ) );
+  const double bytes = static_cast<double>( domain.size() * sizeof( DGtal::uint64_t ) );
+  double t;
+
+  trace.beginBlock( "LongvolWriter::exportLongvol" );
+  LongvolWriter<LImage>::exportLongvol( "benchz.lvol", image );
+  t = trace.endBlock();
+  reportThroughput( "Longvol", bytes, t, "benchz.lvol" );
+
+  trace.beginBlock( "RawWriter::exportRaw" );
+  RawWriter<LImage>::exportRaw<DGtal::uint64_t>( "bench.raw", image );
+  t = trace.endBlock();
+  reportThroughput( "Raw", bytes, t, "bench.raw" );
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking VolWriter, LongvolWriter and RawWriter" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const int size = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 256;
+  bool res = benchmarkVol( size ) && benchmarkLongvolAndRaw( size / 2 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
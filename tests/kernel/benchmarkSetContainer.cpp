@@ -37,6 +37,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 
 #include "DGtal/kernel/PointHashFunctions.h"
@@ -54,10 +55,12 @@ using namespace DGtal;
 typedef DGtal::DigitalSetBySTLSet< Z2i::Domain> FromSet;
 typedef DGtal::DigitalSetBySTLVector< Z2i::Domain> FromVector;
 typedef DGtal::DigitalSetByAssociativeContainer< Z2i::Domain, std::unordered_set<Z2i::Point> > FromUnordered;
+typedef DGtal::DigitalSetByBitset< Z2i::Domain> FromBitset;
 
 typedef DGtal::DigitalSetBySTLSet< Z3i::Domain> FromSet3;
 typedef DGtal::DigitalSetBySTLVector< Z3i::Domain> FromVector3;
 typedef DGtal::DigitalSetByAssociativeContainer< Z3i::Domain, std::unordered_set<Z3i::Point> > FromUnordered3;
+typedef DGtal::DigitalSetByBitset< Z3i::Domain> FromBitset3;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -74,9 +77,11 @@ static void BM_Constructor(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitset)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromVector3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromSet3)->Range(1<<3 , 1 << 8);
 BENCHMARK_TEMPLATE(BM_Constructor, FromUnordered3)->Range(1<<3 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_Constructor, FromBitset3)->Range(1<<3 , 1 << 8);
 
 
 template<typename Q>
@@ -97,6 +102,7 @@ static void BM_insert(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_insert, FromVector);
 BENCHMARK_TEMPLATE(BM_insert, FromSet);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered);
+BENCHMARK_TEMPLATE(BM_insert, FromBitset);
 BENCHMARK_TEMPLATE(BM_insert, FromVector3);
 BENCHMARK_TEMPLATE(BM_insert, FromSet3);
 BENCHMARK_TEMPLATE(BM_insert, FromUnordered3);
@@ -124,10 +130,67 @@ static void BM_iterate(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_iterate, FromVector)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered)->Range(1<<3 , 1 << 10);;
+BENCHMARK_TEMPLATE(BM_iterate, FromBitset)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromVector3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromSet3)->Range(1<<3 , 1 << 10);;
 BENCHMARK_TEMPLATE(BM_iterate, FromUnordered3)->Range(1<<3 , 1 << 10);;
 
+// Note: bitsets over the 2048^3 domain of the benchmarks above would
+// need 1GB, hence FromBitset3 is only benchmarked on smaller domains.
+
+template<typename Q>
+static void BM_belong(benchmark::State& state)
+{
+  // The set fills about one quarter of its domain.
+  const typename Q::Point::Coordinate n = state.range(0);
+  Q myset(typename Q::Domain( Q::Point::diagonal(0), Q::Point::diagonal(n-1) ));
+  for(unsigned int i= 0; i < myset.domain().size() / 4; ++i)
+    {
+      typename Q::Point p;
+      for(unsigned int j=0; j < Q::Point::dimension; j++)
+        p[j] = rand() % n;
+      myset.insert( p );
+    }
+  std::vector<typename Q::Point> queries( 1024 );
+  for(auto & p : queries)
+    for(unsigned int j=0; j < Q::Point::dimension; j++)
+      p[j] = rand() % n;
+  while (state.KeepRunning())
+    {
+      for(const auto & p : queries)
+        benchmark::DoNotOptimize( myset( p ) );
+    }
+}
+BENCHMARK_TEMPLATE(BM_belong, FromSet)->Range(1<<4 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_belong, FromUnordered)->Range(1<<4 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_belong, FromBitset)->Range(1<<4 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_belong, FromSet3)->Range(1<<4 , 1 << 6);
+BENCHMARK_TEMPLATE(BM_belong, FromUnordered3)->Range(1<<4 , 1 << 6);
+BENCHMARK_TEMPLATE(BM_belong, FromBitset3)->Range(1<<4 , 1 << 6);
+
+template<typename Q>
+static void BM_iterateDense(benchmark::State& state)
+{
+  // The set fills about one half of its domain.
+  const typename Q::Point::Coordinate n = state.range(0);
+  Q myset(typename Q::Domain( Q::Point::diagonal(0), Q::Point::diagonal(n-1) ));
+  for(typename Q::Domain::ConstIterator it = myset.domain().begin(),
+        itend = myset.domain().end(); it != itend; ++it)
+    if ( rand() % 2 ) myset.insertNew( *it );
+  while (state.KeepRunning())
+    {
+      for(typename Q::ConstIterator it= myset.begin(), itend=myset.end(); it != itend;
+          ++it)
+        benchmark::DoNotOptimize(*it);
+    }
+}
+BENCHMARK_TEMPLATE(BM_iterateDense, FromVector)->Range(1<<4 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_iterateDense, FromUnordered)->Range(1<<4 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_iterateDense, FromBitset)->Range(1<<4 , 1 << 8);
+BENCHMARK_TEMPLATE(BM_iterateDense, FromVector3)->Range(1<<4 , 1 << 6);
+BENCHMARK_TEMPLATE(BM_iterateDense, FromUnordered3)->Range(1<<4 , 1 << 6);
+BENCHMARK_TEMPLATE(BM_iterateDense, FromBitset3)->Range(1<<4 , 1 << 6);
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
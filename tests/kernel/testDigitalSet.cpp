@@ -52,6 +52,7 @@
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetByAssociativeContainer.h"
+#include "DGtal/kernel/sets/DigitalSetByBitset.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
@@ -269,6 +270,90 @@ bool testDigitalSetSelector( const DigitalDomain & domain,
   return nbok == nb;
 }
 
+bool testDigitalSetByBitset()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing DigitalSetByBitset ..." );
+  typedef Z3i::Domain Domain;
+  typedef Z3i::Point Point;
+  typedef DigitalSetByBitset< Domain > BitsetSet;
+  // 7*5*3 = 105 points: the last word is partially used.
+  Domain domain( Point( -3, -2, -1 ), Point( 3, 2, 1 ) );
+  BitsetSet set1( domain );
+  Z3i::DigitalSet set2( domain );
+  for ( auto && p : domain )
+    if ( ( p[ 0 ] + 2 * p[ 1 ] + 3 * p[ 2 ] ) % 3 == 0 )
+      {
+        set1.insert( p );
+        set2.insert( p );
+      }
+  INBLOCK_TEST( set1.isValid() );
+  INBLOCK_TEST( set1.size() == set2.size() );
+  // Points are visited in the order of the domain.
+  std::vector< Point > visited( set1.begin(), set1.end() );
+  std::vector< Point > expected;
+  for ( auto && p : domain )
+    if ( set2( p ) ) expected.push_back( p );
+  INBLOCK_TEST( visited == expected );
+  INBLOCK_TEST( ! set1( Point( 10, 0, 0 ) ) );
+  INBLOCK_TEST( set1.find( Point( 10, 0, 0 ) ) == set1.end() );
+  INBLOCK_TEST( set1.erase( Point( 10, 0, 0 ) ) == 0 );
+  // Complement and union by words.
+  BitsetSet set3( domain );
+  set3.assignFromComplement( set1 );
+  INBLOCK_TEST( set3.size() == domain.size() - set1.size() );
+  INBLOCK_TEST( (Domain::Size) std::distance( set3.begin(), set3.end() ) == set3.size() );
+  set3 += set1;
+  INBLOCK_TEST( set3.size() == domain.size() );
+  // Assignment and union with another domain.
+  BitsetSet set4( Domain( Point( -5, -5, -5 ), Point( 5, 5, 5 ) ) );
+  set4 = set1;
+  INBLOCK_TEST( set4.size() == set1.size() && set4( *set1.begin() ) );
+  set4 += set3;
+  INBLOCK_TEST( set4.size() == domain.size() );
+  Point lower, upper;
+  set1.computeBoundingBox( lower, upper );
+  INBLOCK_TEST( lower == domain.lowerBound() && upper == domain.upperBound() );
+  // Erasing while iterating.
+  for ( auto it = set4.begin(), itEnd = set4.end(); it != itEnd; )
+    {
+      auto current = it++;
+      if ( (*current)[ 2 ] == 0 ) set4.erase( current );
+    }
+  INBLOCK_TEST( set4.size() == domain.size() - 35 );
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testDigitalSetSelectorTypes()
+{
+  typedef Z2i::Domain Domain;
+  typedef Z2i::Point Point;
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, BIG_DS + HIGH_BEL_DS >::Type,
+                        DigitalSetByBitset< Domain > >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, WHOLE_DS + HIGH_VAR_DS + HIGH_BEL_DS >::Type,
+                        DigitalSetByBitset< Domain > >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, WHOLE_DS + HIGH_ITER_DS + HIGH_BEL_DS >::Type,
+                        DigitalSetByBitset< Domain > >::value ));
+  // Big sets iterated often may be sparse: no scan of the whole domain.
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, BIG_DS + HIGH_ITER_DS + HIGH_BEL_DS >::Type,
+                        DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, BIG_DS + HIGH_VAR_DS >::Type,
+                        DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, MEDIUM_DS + HIGH_BEL_DS >::Type,
+                        DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, SMALL_DS + HIGH_ITER_DS >::Type,
+                        DigitalSetBySTLVector< Domain > >::value ));
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< Domain, SMALL_DS + HIGH_VAR_DS >::Type,
+                        DigitalSetByAssociativeContainer< Domain, std::unordered_set< Point > > >::value ));
+  // Bitsets need a HyperRectDomain.
+  typedef DigitalSetDomain< Z2i::DigitalSet > SetDomain;
+  BOOST_STATIC_ASSERT(( boost::is_same< DigitalSetSelector< SetDomain, BIG_DS + HIGH_BEL_DS >::Type,
+                        DigitalSetByAssociativeContainer< SetDomain, std::unordered_set< Point > > >::value ));
+  return true;
+}
+
 bool testDigitalSetDraw()
 {
   unsigned int nbok = 0;
@@ -424,6 +509,11 @@ int main()
   ( DigitalSetByAssociativeContainer<Domain, ContainerU>(domain), DigitalSetByAssociativeContainer<Domain, ContainerU>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitset" );
+  bool okBitset = testDigitalSet< DigitalSetByBitset<Domain> >
+  ( DigitalSetByBitset<Domain>(domain), DigitalSetByBitset<Domain>(domain) );
+  trace.endBlock();
+
   bool okSelectorSmall = testDigitalSetSelector
       < Domain, SMALL_DS + LOW_VAR_DS + LOW_ITER_DS + LOW_BEL_DS >
       ( domain, "Small set" );
@@ -436,6 +526,14 @@ int main()
       < Domain, MEDIUM_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
       ( domain, "Medium set + High belonging test" );
 
+  bool okSelectorBigHBel = testDigitalSetSelector
+      < Domain, BIG_DS + LOW_VAR_DS + LOW_ITER_DS + HIGH_BEL_DS >
+      ( domain, "Big set + High belonging test" );
+
+  bool okSelectorTypes = testDigitalSetSelectorTypes();
+
+  bool okDigitalSetByBitset = testDigitalSetByBitset();
+
   bool okDigitalSetDomain = testDigitalSetDomain();
 
   bool okDigitalSetDraw = testDigitalSetDraw();
@@ -445,7 +543,9 @@ int main()
   bool res = okVector && okSet && okMap
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet
-     && okUnorderedSet && okAssoctestSet;
+     && okUnorderedSet && okAssoctestSet
+     && okBitset && okSelectorBigHBel && okSelectorTypes
+     && okDigitalSetByBitset;
   trace.endBlock();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   return res ? 0 : 1;
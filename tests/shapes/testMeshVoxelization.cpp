@@ -36,6 +36,8 @@
 #include "DGtal/io/Display3D.h"
 #include "DGtal/io/readers/MeshReader.h"
 #include "DGtal/io/boards/Board3D.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/BitPackedBinaryImage.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace DGtal;
@@ -232,4 +234,121 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     //hard coded test.
     REQUIRE( outputSet.size() == 4162 );
   }
+
+  // ---------------------------------------------------------
+  SECTION("Voxelization of a OFF cube mesh does not depend on the number of threads")
+  {
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+    DigitalSet outputSet1(domain), outputSet3(domain);
+    MeshVoxelizer26 voxelizer;
+
+    REQUIRE( voxelizer.nbThreads() == 1 );
+    voxelizer.setNbThreads( 1 );
+    voxelizer.voxelize(outputSet1, inputMesh, 10.0 );
+    voxelizer.setNbThreads( 3 );
+    voxelizer.voxelize(outputSet3, inputMesh, 10.0 );
+
+    REQUIRE( outputSet1.size() == 4162 );
+    REQUIRE( outputSet3.size() == outputSet1.size() );
+    REQUIRE( std::equal( outputSet1.begin(), outputSet1.end(), outputSet3.begin() ) );
+  }
+}
+
+TEST_CASE("Interior voxelization test", "[voxelization]")
+{
+  using DigitalSet = DigitalSetBySTLSet<Z3i::Domain>;
+  using MeshVoxelizer6 = MeshVoxelizer< DigitalSet, 6>;
+  using BinaryImage = ImageContainerBySTLVector<Z3i::Domain, bool>;
+  using LabelImage = ImageContainerBySTLVector<Z3i::Domain, int>;
+  using PackedImage = BitPackedBinaryImage<Z3i::Domain>;
+
+  Mesh<Z3i::RealPoint> inputMesh;
+  MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+  const double scale = 10.0;
+  Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+
+  // half-spaces of the (convex) cube faces, containing the origin
+  std::vector< std::pair<Z3i::RealPoint, double> > halfSpaces;
+  for(unsigned int i = 0; i < inputMesh.nbFaces(); i++)
+  {
+    const auto & face = inputMesh.getFace(i);
+    const Z3i::RealPoint A = inputMesh.getVertex(face[0])*scale;
+    const Z3i::RealPoint B = inputMesh.getVertex(face[1])*scale;
+    const Z3i::RealPoint C = inputMesh.getVertex(face[2])*scale;
+    Z3i::RealPoint n = (B - A).crossProduct(C - A).getNormalized();
+    if( n.dot(A) < 0 ) n = -n;
+    halfSpaces.push_back( std::make_pair( n, n.dot(A) ) );
+  }
+  // 1 inside, 0 outside, -1 too close to a face
+  auto inCube = [&halfSpaces] (const Point & p)
+  {
+    int result = 1;
+    for(const auto & h : halfSpaces)
+    {
+      const double d = h.first.dot( Z3i::RealPoint(p) ) - h.second;
+      if( std::abs(d) < 1e-9 ) result = -1;
+      else if( d > 0 ) return 0;
+    }
+    return result;
+  };
+
+  // ---------------------------------------------------------
+  SECTION("Interior of a OFF cube mesh with the even-odd rule")
+  {
+    BinaryImage image(domain);
+    MeshVoxelizer6 voxelizer;
+    voxelizer.voxelizeInterior(image, inputMesh, scale);
+
+    unsigned int nbErrors = 0, nbInside = 0;
+    for(auto p: domain)
+    {
+      const int expected = inCube(p);
+      if( expected >= 0 && image(p) != (expected == 1) ) nbErrors++;
+      if( image(p) ) nbInside++;
+    }
+    CAPTURE(nbInside);
+    REQUIRE( nbErrors == 0 );
+    REQUIRE( nbInside > 0 );
+  }
+
+  // ---------------------------------------------------------
+  SECTION("Interior rules, image types and number of threads give the same result")
+  {
+    MeshVoxelizer6 voxelizer;
+    BinaryImage reference(domain);
+    voxelizer.setNbThreads( 1 );
+    voxelizer.voxelizeInterior(reference, inputMesh, scale);
+
+    voxelizer.setNbThreads( 3 );
+    BinaryImage nonZero(domain);
+    voxelizer.voxelizeInterior(nonZero, inputMesh, scale, MeshVoxelizer6::NON_ZERO);
+    PackedImage packed(domain);
+    voxelizer.voxelizeInterior(packed, inputMesh, scale);
+    LabelImage labels(domain);
+    voxelizer.voxelizeInterior(labels, inputMesh, scale);
+
+    unsigned int nbDifferences = 0;
+    for(auto p: domain)
+      if( nonZero(p) != reference(p) || packed(p) != reference(p)
+          || ( labels(p) != 0 ) != reference(p) )
+        nbDifferences++;
+    REQUIRE( nbDifferences == 0 );
+  }
+
+  // ---------------------------------------------------------
+  SECTION("Interior contains the voxels of the 6-sep surface which are inside the cube")
+  {
+    MeshVoxelizer6 voxelizer;
+    DigitalSet surface(domain);
+    voxelizer.voxelize(surface, inputMesh, scale);
+    PackedImage interior(domain);
+    voxelizer.voxelizeInterior(interior, inputMesh, scale);
+
+    unsigned int nbMissing = 0;
+    for(auto p: surface)
+      if( inCube(p) == 1 && ! interior(p) ) nbMissing++;
+    REQUIRE( nbMissing == 0 );
+  }
 }
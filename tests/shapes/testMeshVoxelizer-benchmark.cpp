@@ -0,0 +1,178 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMeshVoxelizer-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of MeshVoxelizer on a closed triangulated sphere (about
+ * one million triangles in a 512^3 domain by default): surface
+ * voxelization into a digital set and interior voxelization into
+ * BitPackedBinaryImage and ImageContainerBySTLVector images, with one
+ * thread and with ParallelFor::nbThreads() threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Mesh.h"
+#include "DGtal/shapes/MeshVoxelizer.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/BitPackedBinaryImage.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef MeshVoxelizer< DigitalSet, 6 > Voxelizer;
+
+/**
+ * Builds a closed UV sphere with @a n parallels and @a n meridians,
+ * i.e. 2n(n-1) triangles.
+ */
+void makeSphere( Mesh<RealPoint> & mesh, const unsigned int n, const double radius )
+{
+  mesh.addVertex( RealPoint( 0, 0, radius ) );
+  for ( unsigned int i = 1; i < n; ++i )
+    {
+      const double theta = M_PI * i / n;
+      for ( unsigned int j = 0; j < n; ++j )
+        {
+          const double phi = 2.0 * M_PI * j / n;
+          mesh.addVertex( RealPoint( radius * sin( theta ) * cos( phi ),
+                                     radius * sin( theta ) * sin( phi ),
+                                     radius * cos( theta ) ) );
+        }
+    }
+  const unsigned int south = 1 + ( n - 1 ) * n;
+  mesh.addVertex( RealPoint( 0, 0, -radius ) );
+  auto v = [n] ( unsigned int i, unsigned int j ) { return 1 + ( i - 1 ) * n + j % n; };
+  for ( unsigned int j = 0; j < n; ++j )
+    {
+      mesh.addTriangularFace( 0, v( 1, j ), v( 1, j + 1 ) );
+      for ( unsigned int i = 1; i + 1 < n; ++i )
+        {
+          mesh.addTriangularFace( v( i, j ), v( i + 1, j ), v( i + 1, j + 1 ) );
+          mesh.addTriangularFace( v( i, j ), v( i + 1, j + 1 ), v( i, j + 1 ) );
+        }
+      mesh.addTriangularFace( south, v( n - 1, j + 1 ), v( n - 1, j ) );
+    }
+}
+
+/// Number of true values of an image.
+template <typename Image>
+std::size_t countInside( const Image & image )
+{
+  std::size_t nb = 0;
+  for ( auto p : image.domain() )
+    if ( image( p ) ) nb++;
+  return nb;
+}
+
+/// Times the interior voxelization of @a mesh into a new @a Image.
+template <typename Image>
+std::size_t benchmarkInterior( const std::string & name, Voxelizer & voxelizer,
+                               const Mesh<RealPoint> & mesh, const Domain & domain )
+{
+  Image image( domain );
+  Clock c;
+  c.startClock();
+  voxelizer.voxelizeInterior( image, mesh );
+  const double t = c.stopClock();
+  const std::size_t nb = countInside( image );
+  trace.info() << name << " (" << voxelizer.nbThreads() << " threads): "
+               << t << " ms, " << nb << " voxels." << std::endl;
+  return nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+/**
+ * Usage: testMeshVoxelizer-benchmark [resolution] [n]
+ * The sphere of radius 0.45*resolution with 2n(n-1) triangles (default
+ * n = 708, i.e. about 1M triangles) is voxelized in a resolution^3
+ * domain (default 512).
+ */
+int main( int argc, char** argv )
+{
+  const int resolution = argc > 1 ? atoi( argv[ 1 ] ) : 512;
+  const unsigned int n = argc > 2 ? atoi( argv[ 2 ] ) : 708;
+  const double radius = 0.45 * resolution;
+  const unsigned int nbThreads = ParallelFor::nbThreads();
+  bool res = true;
+
+  trace.beginBlock( "Benchmarking MeshVoxelizer" );
+  Mesh<RealPoint> mesh;
+  makeSphere( mesh, n, radius );
+  const Domain domain( Point::diagonal( -resolution / 2 ), Point::diagonal( resolution / 2 - 1 ) );
+  trace.info() << "Sphere of radius " << radius << ", " << mesh.nbFaces() << " triangles, "
+               << "domain " << domain << std::endl;
+
+  Voxelizer voxelizer;
+
+  trace.beginBlock( "Surface voxelization" );
+  std::size_t nbSurface[ 2 ];
+  for ( unsigned int k = 0; k < 2; ++k )
+    {
+      voxelizer.setNbThreads( k == 0 ? 1 : nbThreads );
+      DigitalSet surface( domain );
+      Clock c;
+      c.startClock();
+      voxelizer.voxelize( surface, mesh );
+      const double t = c.stopClock();
+      nbSurface[ k ] = surface.size();
+      trace.info() << "DigitalSet (" << voxelizer.nbThreads() << " threads): "
+                   << t << " ms, " << nbSurface[ k ] << " voxels." << std::endl;
+    }
+  res = res && nbSurface[ 0 ] == nbSurface[ 1 ];
+  trace.endBlock();
+
+  trace.beginBlock( "Interior voxelization" );
+  std::size_t nbInterior[ 6 ];
+  for ( unsigned int k = 0; k < 2; ++k )
+    {
+      voxelizer.setNbThreads( k == 0 ? 1 : nbThreads );
+      nbInterior[ 3 * k ] = benchmarkInterior< BitPackedBinaryImage<Domain> >
+        ( "BitPackedBinaryImage", voxelizer, mesh, domain );
+      nbInterior[ 3 * k + 1 ] = benchmarkInterior< ImageContainerBySTLVector<Domain, bool> >
+        ( "ImageContainerBySTLVector<bool>", voxelizer, mesh, domain );
+      nbInterior[ 3 * k + 2 ] = benchmarkInterior< ImageContainerBySTLVector<Domain, unsigned char> >
+        ( "ImageContainerBySTLVector<unsigned char>", voxelizer, mesh, domain );
+    }
+  const double volume = 4.0 / 3.0 * M_PI * radius * radius * radius;
+  trace.info() << "Ball volume " << volume << std::endl;
+  for ( unsigned int k = 1; k < 6; ++k )
+    res = res && nbInterior[ k ] == nbInterior[ 0 ];
+  res = res && std::abs( double( nbInterior[ 0 ] ) - volume ) < 0.01 * volume;
+  trace.endBlock();
+
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,230 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaceMesh-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the loading and traversal of large SurfaceMesh read
+ * with SurfaceMeshReader: the former adjacency storage (one
+ * std::vector per vertex, face and edge, built with std::set and
+ * std::map) versus the compressed ranges built by counting sort.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <map>
+#include <set>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/io/readers/SurfaceMeshReader.h"
+#include "DGtal/io/writers/SurfaceMeshWriter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::RealPoint                                 RealPoint;
+typedef Z3i::RealVector                                RealVector;
+typedef SurfaceMesh< RealPoint, RealVector >           PolygonMesh;
+typedef SurfaceMeshHelper< RealPoint, RealVector >     PolygonMeshHelper;
+typedef SurfaceMeshReader< RealPoint, RealVector >     PolygonMeshReader;
+typedef SurfaceMeshWriter< RealPoint, RealVector >     PolygonMeshWriter;
+typedef PolygonMesh::Index                             Index;
+typedef PolygonMesh::VertexPair                        VertexPair;
+typedef std::vector< Index >                           Indices;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking SurfaceMesh.
+///////////////////////////////////////////////////////////////////////////////
+
+/// The former adjacency storage of SurfaceMesh.
+struct FormerAdjacencies
+{
+  std::vector< Indices >     incidentVertices;
+  std::vector< Indices >     incidentFaces;
+  std::vector< Indices >     neighborFaces;
+  std::vector< Indices >     neighborVertices;
+  std::vector< VertexPair >  edgeVertices;
+  std::vector< Indices >     edgeFaces;
+  std::vector< Indices >     edgeRightFaces;
+  std::vector< Indices >     edgeLeftFaces;
+
+  /// The former SurfaceMesh::init, computeNeighbors and computeEdges.
+  void init( Index nbVertices, const std::vector< Indices > & faces )
+  {
+    incidentFaces.resize( nbVertices );
+    for ( Index f = 0; f < faces.size(); ++f )
+      {
+        for ( auto v : faces[ f ] ) incidentFaces[ v ].push_back( f );
+        incidentVertices.push_back( faces[ f ] );
+      }
+    neighborVertices.resize( nbVertices );
+    neighborFaces.resize( faces.size() );
+    std::vector< std::set< Index > > tmp( nbVertices );
+    for ( const auto & iv : incidentVertices )
+      for ( std::size_t k = 0; k < iv.size(); ++k )
+        {
+          tmp[ iv[ k ] ].insert( iv[ ( k + 1 ) % iv.size() ] );
+          tmp[ iv[ ( k + 1 ) % iv.size() ] ].insert( iv[ k ] );
+        }
+    for ( Index v = 0; v < nbVertices; ++v )
+      neighborVertices[ v ] = Indices( tmp[ v ].cbegin(), tmp[ v ].cend() );
+    for ( Index f = 0; f < faces.size(); ++f )
+      {
+        std::set< Index > nfs;
+        Indices iv = incidentVertices[ f ];
+        std::sort( iv.begin(), iv.end() );
+        for ( auto v : iv )
+          for ( auto g : incidentFaces[ v ] )
+            {
+              Indices iv2 = incidentVertices[ g ];
+              std::sort( iv2.begin(), iv2.end() );
+              Indices common;
+              std::set_intersection( iv.cbegin(), iv.cend(), iv2.cbegin(), iv2.cend(),
+                                     std::back_inserter( common ) );
+              if ( common.size() == 2 ) nfs.insert( g );
+            }
+        nfs.erase( f );
+        neighborFaces[ f ] = Indices( nfs.begin(), nfs.end() );
+      }
+    std::map< VertexPair, Indices > right, left;
+    std::set< VertexPair > edges;
+    for ( Index f = 0; f < faces.size(); ++f )
+      {
+        const auto & iv = incidentVertices[ f ];
+        for ( std::size_t k = 0; k < iv.size(); ++k )
+          {
+            VertexPair e = std::make_pair( iv[ k ], iv[ ( k + 1 ) % iv.size() ] );
+            if ( e.first < e.second ) left[ e ].push_back( f );
+            else { std::swap( e.first, e.second ); right[ e ].push_back( f ); }
+            edges.insert( e );
+          }
+      }
+    for ( auto e : edges )
+      {
+        edgeVertices.push_back( e );
+        edgeLeftFaces.push_back( left[ e ] );
+        edgeRightFaces.push_back( right[ e ] );
+        edgeFaces.push_back( right[ e ] );
+        edgeFaces.back().insert( edgeFaces.back().end(), left[ e ].begin(), left[ e ].end() );
+      }
+  }
+};
+
+/// @return a checksum of a traversal of the neighbors of every face,
+/// then of the faces around every vertex and their vertices.
+template < typename TRanges >
+Index traverse( const TRanges & incidentVertices,
+                const TRanges & incidentFaces,
+                const TRanges & neighborFaces )
+{
+  Index checksum = 0;
+  for ( const auto & nf : neighborFaces )
+    for ( auto g : nf ) checksum += g;
+  for ( const auto & fv : incidentFaces )
+    for ( auto f : fv )
+      for ( auto w : incidentVertices[ f ] ) checksum += w;
+  return checksum;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+/**
+ * Usage: testSurfaceMesh-benchmark [max_latitudes]
+ *
+ * The tori have 2*m*m triangles, for m = 250, 500, ..., max_latitudes.
+ */
+int main( int argc, char** argv )
+{
+  const Index maxM = argc > 1 ? atoi( argv[ 1 ] ) : 1000;
+  const unsigned int nbThreads = ParallelFor::nbThreads();
+  bool res = true;
+  trace.beginBlock ( "Benchmarking the loading and traversal of SurfaceMesh" );
+  for ( Index m = 250; m <= maxM; m *= 2 )
+    {
+      trace.beginBlock( "Torus as an OBJ file" );
+      auto torus = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero, m, m, 0,
+                                                 PolygonMeshHelper::NormalsType::NO_NORMALS );
+      std::ostringstream output;
+      PolygonMeshWriter::writeOBJ( output, torus );
+      const std::string obj = output.str();
+      const std::vector< Indices > faces = torus.allIncidentVertices();
+      trace.info() << torus.nbFaces() << " faces, " << obj.size() << " bytes." << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "Former adjacencies (std::vector of std::vector)" );
+      FormerAdjacencies former;
+      former.init( torus.nbVertices(), faces );
+      trace.endBlock();
+
+      PolygonMesh smesh;
+      for ( unsigned int n : { 1u, nbThreads } )
+        {
+          trace.beginBlock( "SurfaceMeshReader::readOBJ, " + std::to_string( n ) + " thread(s)" );
+          std::istringstream input( obj );
+          smesh.setNbThreads( n );
+          res = PolygonMeshReader::readOBJ( input, smesh ) && res;
+          trace.endBlock();
+        }
+      for ( unsigned int n : { 1u, nbThreads } )
+        {
+          trace.beginBlock( "SurfaceMesh::init, " + std::to_string( n ) + " thread(s)" );
+          smesh.setNbThreads( n );
+          std::vector< RealPoint > positions( smesh.nbVertices() );
+          for ( Index v = 0; v < positions.size(); ++v ) positions[ v ] = smesh.position( v );
+          smesh.init( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
+          trace.endBlock();
+        }
+      res = res && smesh.nbEdges() == former.edgeVertices.size();
+
+      trace.beginBlock( "Traversal, former adjacencies" );
+      const Index former_checksum = traverse( former.incidentVertices, former.incidentFaces,
+                                              former.neighborFaces );
+      trace.endBlock();
+      trace.beginBlock( "Traversal, compressed ranges" );
+      const Index checksum = traverse( smesh.allIncidentVertices(), smesh.allIncidentFaces(),
+                                       smesh.allNeighborFaces() );
+      trace.endBlock();
+      res = res && checksum == former_checksum;
+
+      trace.beginBlock( "Normals and ball measures" );
+      smesh.computeFaceNormalsFromPositions();
+      smesh.computeVertexNormalsFromFaceNormals();
+      Index nb = 0;
+      for ( Index f = 0; f < smesh.nbFaces(); f += 97 )
+        nb += smesh.computeFacesInclusionsInBall( 0.05, f ).size();
+      trace.info() << nb << " weighted faces." << std::endl;
+      trace.endBlock();
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,8 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <map>
+#include <set>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -271,6 +273,127 @@ SCENARIO( "SurfaceMesh< RealPoint3 > mesh helper tests", "[surfmesh][helper]" )
   }
 }
 
+/// Checks the adjacency relations of \a smesh against the ones
+/// computed directly with std::set and std::map from its faces.
+template <typename TSurfaceMesh>
+bool checkAdjacencies( const TSurfaceMesh& smesh )
+{
+  typedef typename TSurfaceMesh::Index      Index;
+  typedef typename TSurfaceMesh::VertexPair VertexPair;
+  typedef std::vector< Index >              Indices;
+  const std::vector< Indices > faces = smesh.allIncidentVertices();
+  std::vector< Indices > incident_faces( smesh.nbVertices() );
+  std::vector< std::set< Index > > neighbor_vertices( smesh.nbVertices() );
+  std::map< VertexPair, Indices > left, right;
+  std::set< VertexPair > edges;
+  for ( Index f = 0; f < faces.size(); ++f )
+    for ( Index k = 0; k < faces[ f ].size(); ++k )
+      {
+        const Index i = faces[ f ][ k ];
+        const Index j = faces[ f ][ ( k + 1 ) % faces[ f ].size() ];
+        incident_faces[ i ].push_back( f );
+        neighbor_vertices[ i ].insert( j );
+        neighbor_vertices[ j ].insert( i );
+        if ( i < j ) left[ std::make_pair( i, j ) ].push_back( f );
+        else         right[ std::make_pair( j, i ) ].push_back( f );
+        edges.insert( std::make_pair( std::min( i, j ), std::max( i, j ) ) );
+      }
+  bool ok = smesh.nbEdges() == edges.size();
+  for ( Index v = 0; v < smesh.nbVertices(); ++v )
+    {
+      ok = ok && Indices( smesh.incidentFaces( v ) ) == incident_faces[ v ];
+      ok = ok && Indices( smesh.neighborVertices( v ) )
+        == Indices( neighbor_vertices[ v ].begin(), neighbor_vertices[ v ].end() );
+    }
+  for ( Index f = 0; f < faces.size(); ++f )
+    {
+      std::set< Index > nf;
+      Indices vf = faces[ f ];
+      std::sort( vf.begin(), vf.end() );
+      std::set< Index > candidates;
+      for ( auto v : vf )
+        candidates.insert( incident_faces[ v ].begin(), incident_faces[ v ].end() );
+      for ( auto g : candidates )
+        {
+          Indices vg = faces[ g ], common;
+          std::sort( vg.begin(), vg.end() );
+          std::set_intersection( vf.begin(), vf.end(), vg.begin(), vg.end(),
+                                 std::back_inserter( common ) );
+          if ( g != f && common.size() == 2 ) nf.insert( g );
+        }
+      ok = ok && Indices( smesh.neighborFaces( f ) ) == Indices( nf.begin(), nf.end() );
+    }
+  Index e = 0;
+  for ( auto vp : edges )
+    {
+      Indices ef = right[ vp ];
+      ef.insert( ef.end(), left[ vp ].begin(), left[ vp ].end() );
+      ok = ok && smesh.edgeVertices( e ) == vp
+        && smesh.makeEdge( vp.second, vp.first ) == e
+        && Indices( smesh.edgeLeftFaces( e ) )  == left[ vp ]
+        && Indices( smesh.edgeRightFaces( e ) ) == right[ vp ]
+        && Indices( smesh.edgeFaces( e ) )      == ef;
+      e++;
+    }
+  return ok && smesh.makeEdge( 0, smesh.nbVertices() ) == smesh.nbEdges();
+}
+
+SCENARIO( "SurfaceMesh< RealPoint3 > adjacency tests", "[surfmesh][adjacency]" )
+{
+  typedef PointVector<3,double>                      RealPoint;
+  typedef PointVector<3,double>                      RealVector;
+  typedef SurfaceMesh< RealPoint, RealVector >       PolygonMesh;
+  typedef SurfaceMeshHelper< RealPoint, RealVector > PolygonMeshHelper;
+  typedef PolygonMeshHelper::NormalsType             NormalsType;
+  typedef PolygonMesh::Vertices                      Vertices;
+  GIVEN( "A box with an open side" ) {
+    PolygonMesh polymesh = makeBox();
+    THEN( "Its adjacencies are the ones computed from its faces" ) {
+      REQUIRE( checkAdjacencies( polymesh ) );
+    }
+  }
+  GIVEN( "Three triangles sharing an edge, and a triangle with a repeated vertex" ) {
+    std::vector< RealPoint > positions( 6, RealPoint::zero );
+    std::vector< Vertices > faces = { { 0, 1, 2 }, { 1, 0, 3 }, { 0, 1, 4 }, { 2, 5, 5 } };
+    PolygonMesh polymesh( positions.cbegin(), positions.cend(),
+                          faces.cbegin(), faces.cend() );
+    THEN( "Its adjacencies are the ones computed from its faces" ) {
+      REQUIRE( polymesh.computeNonManifoldEdges().size() == 1 );
+      REQUIRE( checkAdjacencies( polymesh ) );
+    }
+  }
+  GIVEN( "A sphere and a large torus built with 1 and 4 threads" ) {
+    auto sphere = PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero,
+                                                 10, 10, NormalsType::NO_NORMALS );
+    auto torus  = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero,
+                                                100, 80, 1, NormalsType::NO_NORMALS );
+    const std::vector< Vertices > faces = torus.allIncidentVertices();
+    std::vector< RealPoint > positions( torus.nbVertices() );
+    for ( std::size_t v = 0; v < positions.size(); ++v )
+      positions[ v ] = torus.position( v );
+    PolygonMesh torus1, torus4;
+    torus1.setNbThreads( 1 );
+    torus4.setNbThreads( 4 );
+    torus1.init( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
+    torus4.init( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
+    THEN( "Their adjacencies are the ones computed from their faces" ) {
+      REQUIRE( checkAdjacencies( sphere ) );
+      REQUIRE( torus.nbFaces() == 16000 );
+      REQUIRE( torus.Euler() == 0 );
+      REQUIRE( checkAdjacencies( torus1 ) );
+    }
+    THEN( "The adjacencies do not depend on the number of threads" ) {
+      REQUIRE( torus1.allIncidentFaces()   == torus4.allIncidentFaces() );
+      REQUIRE( torus1.allNeighborFaces()   == torus4.allNeighborFaces() );
+      REQUIRE( torus1.allNeighborVertices() == torus4.allNeighborVertices() );
+      REQUIRE( torus1.allEdgeVertices()    == torus4.allEdgeVertices() );
+      REQUIRE( torus1.allEdgeFaces()       == torus4.allEdgeFaces() );
+      REQUIRE( torus1.allEdgeRightFaces()  == torus4.allEdgeRightFaces() );
+      REQUIRE( torus1.allEdgeLeftFaces()   == torus4.allEdgeLeftFaces() );
+    }
+  }
+}
+
 SCENARIO( "SurfaceMesh< RealPoint3 > reader/writer tests", "[surfmesh][io]" )
 {
   typedef PointVector<3,double>                      RealPoint;
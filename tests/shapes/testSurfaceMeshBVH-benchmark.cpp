@@ -0,0 +1,154 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaceMeshBVH-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of SurfaceMeshBVH on tori: construction with one and
+ * several threads, ball measures by breadth-first traversal versus
+ * with the hierarchy, closest points versus brute force, ray
+ * intersections, and refit versus rebuild after moving the vertices.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/shapes/SurfaceMeshBVH.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Z3i::RealPoint                                 RealPoint;
+typedef Z3i::RealVector                                RealVector;
+typedef SurfaceMesh< RealPoint, RealVector >           PolygonMesh;
+typedef SurfaceMeshHelper< RealPoint, RealVector >     PolygonMeshHelper;
+typedef SurfaceMeshBVH< RealPoint, RealVector >        BVH;
+typedef PolygonMesh::Index                             Index;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking SurfaceMeshBVH.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return a random point in the box [-a,a]^3.
+RealPoint randomPoint( double a )
+{
+  return RealPoint( a * ( 2.0 * rand() / RAND_MAX - 1.0 ),
+                    a * ( 2.0 * rand() / RAND_MAX - 1.0 ),
+                    a * ( 2.0 * rand() / RAND_MAX - 1.0 ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+/**
+ * Usage: testSurfaceMeshBVH-benchmark [max_latitudes]
+ *
+ * The tori have 2*m*m triangles, for m = 250, 500, ..., max_latitudes.
+ */
+int main( int argc, char** argv )
+{
+  const Index maxM = argc > 1 ? atoi( argv[ 1 ] ) : 1000;
+  const unsigned int nbThreads = ParallelFor::nbThreads();
+  const unsigned int nbQueries = 1000;
+  bool res = true;
+  srand( 0 );
+  trace.beginBlock ( "Benchmarking SurfaceMeshBVH" );
+  for ( Index m = 250; m <= maxM; m *= 2 )
+    {
+      auto torus = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero, m, m, 0,
+                                                 PolygonMeshHelper::NormalsType::NO_NORMALS );
+      trace.info() << "Torus with " << torus.nbFaces() << " faces." << std::endl;
+      BVH bvh;
+      for ( unsigned int n : { 1u, nbThreads } )
+        {
+          trace.beginBlock( "SurfaceMeshBVH::init, " + std::to_string( n ) + " thread(s)" );
+          bvh.setNbThreads( n );
+          bvh.init( torus );
+          trace.info() << bvh << std::endl;
+          trace.endBlock();
+        }
+      const double h = 2.0 * M_PI * 3.0 / m;
+      for ( double r : { 5.0 * h, 20.0 * h, 1.5 } )
+        {
+          std::size_t nb_bfs = 0, nb_bvh = 0;
+          trace.beginBlock( "computeCellsInclusionsInBall (breadth-first), r=" + std::to_string( r ) );
+          for ( Index f = 0; f < torus.nbFaces(); f += torus.nbFaces() / 100 )
+            nb_bfs += std::get< 2 >( torus.computeCellsInclusionsInBall( r, f ) ).size();
+          trace.info() << nb_bfs << " faces." << std::endl;
+          trace.endBlock();
+          trace.beginBlock( "computeCellsInclusionsInBall (hierarchy), r=" + std::to_string( r ) );
+          for ( Index f = 0; f < torus.nbFaces(); f += torus.nbFaces() / 100 )
+            nb_bvh += std::get< 2 >( torus.computeCellsInclusionsInBall( r, f, bvh ) ).size();
+          trace.info() << nb_bvh << " faces." << std::endl;
+          trace.endBlock();
+          res = res && nb_bfs <= nb_bvh;
+        }
+      std::vector< RealPoint > points( nbQueries );
+      for ( auto & p : points ) p = randomPoint( 4.5 );
+      double sum_bvh = 0.0, sum_brute = 0.0;
+      trace.beginBlock( "Closest points (hierarchy)" );
+      for ( const auto & p : points )
+        sum_bvh += bvh.closestPoint( p ).distance;
+      trace.endBlock();
+      trace.beginBlock( "Closest points (brute force on 10 points)" );
+      for ( unsigned int i = 0; i < 10; ++i )
+        {
+          double d = std::numeric_limits< double >::max();
+          for ( Index f = 0; f < torus.nbFaces(); ++f )
+            d = std::min( d, ( bvh.closestPointOnFace( points[ i ], f ) - points[ i ] ).norm() );
+          sum_brute += d;
+          res = res && d == bvh.closestPoint( points[ i ] ).distance;
+        }
+      trace.endBlock();
+      trace.info() << "Mean distance " << sum_bvh / nbQueries << std::endl;
+      trace.beginBlock( "Ray intersections" );
+      Index nb_hits = 0;
+      for ( const auto & p : points )
+        nb_hits += bvh.intersectRay( p, RealVector( 0.0, 0.0, -1.0 ) - p * 0.1 ).face
+          < torus.nbFaces() ? 1 : 0;
+      trace.info() << nb_hits << " hits." << std::endl;
+      trace.endBlock();
+      torus.perturbateWithUniformRandomNoise( 0.5 * h );
+      trace.beginBlock( "SurfaceMeshBVH::refit after moving vertices" );
+      bvh.refit();
+      trace.endBlock();
+      trace.beginBlock( "SurfaceMeshBVH::init after moving vertices" );
+      BVH rebuilt( torus, nbThreads );
+      trace.endBlock();
+      for ( unsigned int i = 0; i < 10; ++i )
+        res = res && bvh.closestPoint( points[ i ] ).distance
+          == rebuilt.closestPoint( points[ i ] ).distance;
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
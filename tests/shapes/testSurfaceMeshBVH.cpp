@@ -0,0 +1,250 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaceMeshBVH.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class SurfaceMeshBVH.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/SurfaceMesh.h"
+#include "DGtal/shapes/SurfaceMeshHelper.h"
+#include "DGtal/shapes/SurfaceMeshBVH.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<3,double>                      RealPoint;
+typedef PointVector<3,double>                      RealVector;
+typedef SurfaceMesh< RealPoint, RealVector >       PolygonMesh;
+typedef SurfaceMeshHelper< RealPoint, RealVector > PolygonMeshHelper;
+typedef PolygonMeshHelper::NormalsType             NormalsType;
+typedef SurfaceMeshBVH< RealPoint, RealVector >    BVH;
+typedef PolygonMesh::Faces                         Faces;
+typedef PolygonMesh::WeightedFaces                 WeightedFaces;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SurfaceMeshBVH.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return a random point in the box [-a,a]^3.
+RealPoint randomPoint( double a )
+{
+  return RealPoint( a * ( 2.0 * rand() / RAND_MAX - 1.0 ),
+                    a * ( 2.0 * rand() / RAND_MAX - 1.0 ),
+                    a * ( 2.0 * rand() / RAND_MAX - 1.0 ) );
+}
+
+/// @return the distances from \a p to all the faces of the mesh of \a bvh.
+std::vector< double > allDistances( const BVH & bvh, const RealPoint & p )
+{
+  std::vector< double > d( bvh.nbFaces() );
+  for ( BVH::Face f = 0; f < d.size(); ++f )
+    d[ f ] = ( bvh.closestPointOnFace( p, f ) - p ).norm();
+  return d;
+}
+
+/// Checks the ball, nearest faces and closest point queries of \a bvh
+/// against brute force at \a nb random points.
+bool checkQueries( const BVH & bvh, double a, double r, unsigned int nb )
+{
+  unsigned int nb_ok = 0;
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      const RealPoint p = randomPoint( a );
+      const std::vector< double > d = allDistances( bvh, p );
+      Faces in_ball;
+      for ( BVH::Face f = 0; f < d.size(); ++f )
+        if ( d[ f ] <= r ) in_ball.push_back( f );
+      std::vector< std::pair< double, BVH::Face > > sorted;
+      for ( BVH::Face f = 0; f < d.size(); ++f )
+        sorted.push_back( std::make_pair( d[ f ], f ) );
+      std::sort( sorted.begin(), sorted.end() );
+      const WeightedFaces knn = bvh.kNearestFaces( p, 5 );
+      bool ok = bvh.facesInBall( p, r ) == in_ball && knn.size() == 5;
+      for ( std::size_t k = 0; ok && k < knn.size(); ++k )
+        ok = knn[ k ].first == sorted[ k ].second && knn[ k ].second == sorted[ k ].first;
+      const BVH::FacePoint cp = bvh.closestPoint( p );
+      ok = ok && cp.distance == sorted[ 0 ].first
+        && std::abs( ( cp.point - p ).norm() - cp.distance ) < 1e-12;
+      nb_ok += ok ? 1 : 0;
+    }
+  return nb_ok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+SCENARIO( "SurfaceMeshBVH< RealPoint3 > closest point tests", "[bvh][closest]" )
+{
+  std::vector< RealPoint > positions =
+    { RealPoint( 0, 0, 0 ), RealPoint( 2, 0, 0 ), RealPoint( 0, 2, 0 ),
+      RealPoint( 5, 5, 5 ), RealPoint( 7, 5, 5 ) };
+  std::vector< PolygonMesh::Vertices > faces = { { 0, 1, 2 }, { 3, 4 }, { 3 } };
+  PolygonMesh smesh( positions.cbegin(), positions.cend(), faces.cbegin(), faces.cend() );
+  BVH bvh( smesh );
+  GIVEN( "A triangle, a segment and a point" ) {
+    THEN( "The closest points on faces are in the correct Voronoi regions" ) {
+      REQUIRE( bvh.isValid() );
+      REQUIRE( bvh.closestPointOnFace( RealPoint( 0.5, 0.5, 3 ), 0 ) == RealPoint( 0.5, 0.5, 0 ) );
+      REQUIRE( bvh.closestPointOnFace( RealPoint( -1, -1, 1 ), 0 ) == RealPoint( 0, 0, 0 ) );
+      REQUIRE( bvh.closestPointOnFace( RealPoint( 1, -1, 0 ), 0 ) == RealPoint( 1, 0, 0 ) );
+      REQUIRE( bvh.closestPointOnFace( RealPoint( 2, 2, 0 ), 0 ) == RealPoint( 1, 1, 0 ) );
+      REQUIRE( bvh.closestPointOnFace( RealPoint( 6, 3, 5 ), 1 ) == RealPoint( 6, 5, 5 ) );
+      REQUIRE( bvh.closestPointOnFace( RealPoint( 9, 5, 5 ), 1 ) == RealPoint( 7, 5, 5 ) );
+      REQUIRE( bvh.closestPointOnFace( RealPoint( 0, 0, 0 ), 2 ) == RealPoint( 5, 5, 5 ) );
+    }
+    THEN( "Queries return the expected faces" ) {
+      REQUIRE( bvh.closestPoint( RealPoint( 6, 4, 5 ) ).face == 1 );
+      REQUIRE( bvh.facesInBall( RealPoint( 5, 5, 4 ), 1.0 ) == Faces( { 1, 2 } ) );
+      REQUIRE( bvh.facesInBall( RealPoint( 1, 1, 1 ), 1.0 ) == Faces( { 0 } ) );
+      const auto hit = bvh.intersectRay( RealPoint( 0.5, 0.5, 3 ), RealVector( 0, 0, -1 ) );
+      REQUIRE( hit.face == 0 );
+      REQUIRE( hit.distance == 3.0 );
+      REQUIRE( hit.point == RealPoint( 0.5, 0.5, 0 ) );
+      const auto miss = bvh.intersectRay( RealPoint( 0.5, 0.5, 3 ), RealVector( 0, 0, 1 ) );
+      REQUIRE( miss.face == bvh.nbFaces() );
+    }
+  }
+}
+
+SCENARIO( "SurfaceMeshBVH< RealPoint3 > query tests", "[bvh][queries]" )
+{
+  srand( 0 );
+  auto sphere = PolygonMeshHelper::makeSphere( 3.0, RealPoint::zero,
+                                               20, 20, NormalsType::NO_NORMALS );
+  auto torus  = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero,
+                                              100, 80, 1, NormalsType::NO_NORMALS );
+  BVH sphere_bvh( sphere, 1 );
+  BVH torus1( torus, 1 );
+  BVH torus4( torus, 4 );
+  GIVEN( "A sphere made of quadrangles and triangles" ) {
+    THEN( "The hierarchy is valid and shallow" ) {
+      REQUIRE( sphere_bvh.isValid() );
+      REQUIRE( sphere_bvh.nbFaces() == sphere.nbFaces() );
+      REQUIRE( sphere_bvh.depth() < 20 );
+    }
+    THEN( "Queries are the ones computed by brute force" ) {
+      REQUIRE( checkQueries( sphere_bvh, 4.0, 0.8, 50 ) );
+    }
+    THEN( "Rays from the center hit the sphere once" ) {
+      unsigned int nb_ok = 0;
+      for ( unsigned int i = 0; i < 50; ++i )
+        {
+          const RealVector d   = randomPoint( 1.0 );
+          const auto       hit = sphere_bvh.intersectRay( RealPoint::zero, d );
+          const double     r   = hit.point.norm();
+          nb_ok += ( hit.face < sphere.nbFaces() && r <= 3.0 + 1e-12 && r >= 2.9
+                     && ( sphere_bvh.closestPointOnFace( hit.point, hit.face ) - hit.point ).norm() < 1e-9 )
+            ? 1 : 0;
+        }
+      REQUIRE( nb_ok == 50 );
+    }
+  }
+  GIVEN( "A large torus, with hierarchies built with 1 and 4 threads" ) {
+    THEN( "The hierarchies do not depend on the number of threads" ) {
+      REQUIRE( torus1.isValid() );
+      REQUIRE( torus4.isValid() );
+      REQUIRE( torus1.nodes().size() == torus4.nodes().size() );
+      REQUIRE( torus1.depth() == torus4.depth() );
+    }
+    THEN( "Queries are the ones computed by brute force" ) {
+      REQUIRE( checkQueries( torus1, 4.5, 0.5, 20 ) );
+      REQUIRE( checkQueries( torus4, 4.5, 0.5, 20 ) );
+    }
+    THEN( "Rays from outside hit the torus where the closest face is" ) {
+      unsigned int nb_ok = 0;
+      for ( unsigned int i = 0; i < 50; ++i )
+        {
+          const RealPoint  o   = RealPoint( 3.0, 0.0, 0.0 ) + randomPoint( 0.5 ) + RealPoint( 0, 0, 5 );
+          const auto       hit = torus4.intersectRay( o, RealVector( 0, 0, -1 ) );
+          nb_ok += ( hit.face < torus.nbFaces() && hit.distance > 3.4
+                     && torus1.closestPoint( hit.point ).distance < 1e-9 ) ? 1 : 0;
+        }
+      REQUIRE( nb_ok == 50 );
+    }
+  }
+  GIVEN( "A torus whose vertices are moved" ) {
+    BVH refitted( torus, 4 );
+    torus.perturbateWithUniformRandomNoise( 0.1 );
+    refitted.refit();
+    BVH rebuilt( torus, 4 );
+    THEN( "The refitted hierarchy answers queries as the rebuilt one" ) {
+      REQUIRE( refitted.isValid() );
+      REQUIRE( checkQueries( refitted, 4.5, 0.5, 20 ) );
+      unsigned int nb_ok = 0;
+      for ( unsigned int i = 0; i < 20; ++i )
+        {
+          const RealPoint p = randomPoint( 4.5 );
+          nb_ok += ( refitted.facesInBall( p, 0.7 ) == rebuilt.facesInBall( p, 0.7 )
+                     && refitted.closestPoint( p ).distance == rebuilt.closestPoint( p ).distance )
+            ? 1 : 0;
+        }
+      REQUIRE( nb_ok == 20 );
+    }
+  }
+}
+
+SCENARIO( "SurfaceMesh< RealPoint3 > ball measures with SurfaceMeshBVH", "[bvh][measures]" )
+{
+  auto torus = PolygonMeshHelper::makeTorus( 3.0, 1.0, RealPoint::zero,
+                                             60, 40, 0, NormalsType::NO_NORMALS );
+  BVH bvh( torus );
+  GIVEN( "A torus and balls of increasing radii" ) {
+    THEN( "The measures with the hierarchy contain the breadth-first ones" ) {
+      unsigned int nb_ok = 0;
+      unsigned int nb    = 0;
+      for ( double r : { 0.0, 0.2, 0.5, 1.5, 2.5 } )
+        for ( PolygonMesh::Face f = 0; f < torus.nbFaces(); f += 97 )
+          {
+            WeightedFaces bfs = torus.computeFacesInclusionsInBall( r, f );
+            const WeightedFaces wf = torus.computeFacesInclusionsInBall( r, f, bvh );
+            std::sort( bfs.begin(), bfs.end() );
+            const auto bfs_cells = torus.computeCellsInclusionsInBall( r, f );
+            const auto cells     = torus.computeCellsInclusionsInBall( r, f, bvh );
+            bool ok = std::includes( wf.begin(), wf.end(), bfs.begin(), bfs.end() )
+              && std::get< 2 >( cells ) == wf
+              && std::includes( std::get< 0 >( cells ).begin(), std::get< 0 >( cells ).end(),
+                                std::get< 0 >( bfs_cells ).begin(), std::get< 0 >( bfs_cells ).end() )
+              && std::get< 1 >( cells ).size() >= std::get< 1 >( bfs_cells ).size();
+            // Small balls do not reach the other side of the torus.
+            if ( r <= 0.5 ) ok = ok && wf == bfs;
+            nb_ok += ok ? 1 : 0;
+            nb    += 1;
+          }
+      REQUIRE( nb_ok == nb );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
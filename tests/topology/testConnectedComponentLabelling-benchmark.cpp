@@ -0,0 +1,129 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the connected components of random 3D sets: breadth
+ * first traversals (the former Object::writeComponents) versus
+ * ConnectedComponentLabelling with one or several threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <random>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef ConnectedComponentLabelling< Space > CCL;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The components as computed by the former Object::writeComponents:
+ * one breadth-first traversal per component.
+ * @return the number of components.
+ */
+std::size_t componentsByTraversals( const Object26_6 & object )
+{
+  std::size_t nb = 0;
+  DigitalSet visited( object.pointSet().domain() );
+  for ( auto p : object.pointSet() )
+    {
+      if ( visited( p ) ) continue;
+      BreadthFirstVisitor< Object26_6, std::set< Point > > visitor( object, p );
+      while ( ! visitor.finished() ) visitor.expand();
+      visited.insertNew( visitor.markedVertices().begin(),
+                         visitor.markedVertices().end() );
+      ++nb;
+    }
+  return nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int, char** )
+{
+  bool res = true;
+  trace.beginBlock ( "Benchmarking connected component labelling" );
+  std::mt19937 gen( 0 );
+  const int sizes[ 2 ] = { 64, 128 };
+  const double densities[ 2 ] = { 0.2, 0.6 };
+  for ( int n : sizes )
+    for ( double density : densities )
+      {
+        trace.beginBlock( "Random set" );
+        std::bernoulli_distribution coin( density );
+        Domain domain( Point::diagonal( 0 ), Point::diagonal( n - 1 ) );
+        DigitalSet aSet( domain );
+        for ( auto p : domain )
+          if ( coin( gen ) ) aSet.insertNew( p );
+        Object26_6 object( dt26_6, aSet );
+        trace.info() << n << "^3 domain, density " << density
+                     << ", " << aSet.size() << " points" << std::endl;
+        trace.endBlock();
+
+        trace.beginBlock( "Breadth-first traversals" );
+        const std::size_t nbBFS = componentsByTraversals( object );
+        trace.info() << nbBFS << " components." << std::endl;
+        trace.endBlock();
+
+        trace.beginBlock( "ConnectedComponentLabelling (1 thread)" );
+        CCL ccl( 3, 1 );
+        const std::size_t nbCCL = ccl.labelSet( aSet );
+        trace.info() << nbCCL << " components." << std::endl;
+        trace.endBlock();
+
+        trace.beginBlock( "ConnectedComponentLabelling (all threads)" );
+        CCL cclPar( 3, ParallelFor::nbThreads() );
+        const std::size_t nbPar = cclPar.labelSet( aSet );
+        trace.info() << nbPar << " components, "
+                     << ParallelFor::nbThreads() << " threads." << std::endl;
+        trace.endBlock();
+
+        trace.beginBlock( "Object::writeComponents" );
+        std::vector< Object26_6 > components;
+        std::back_insert_iterator< std::vector< Object26_6 > > it( components );
+        const std::size_t nbObject = object.writeComponents( it );
+        trace.endBlock();
+        res = res && nbBFS == nbCCL && nbCCL == nbPar && nbCCL == nbObject
+          && std::equal( ccl.labels().begin(), ccl.labels().end(),
+                         cclPar.labels().begin() );
+      }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,191 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabelling.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ConnectedComponentLabelling.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <random>
+#include <vector>
+#include <map>
+#include <queue>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/ConnectedComponentLabelling.h"
+#include "DGtal/topology/Object.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabelling.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Labels the components of a set by breadth-first traversals, in the
+/// raster order of their first point.
+template <typename Adjacency, typename DigitalSet>
+std::map< typename DigitalSet::Point, std::size_t >
+referenceLabels( const Adjacency & adj, const DigitalSet & aSet, std::size_t & nb )
+{
+  typedef typename DigitalSet::Point Point;
+  std::map< Point, std::size_t > labels;
+  nb = 0;
+  for ( auto p : aSet.domain() )
+    {
+      if ( ! aSet( p ) || labels.count( p ) ) continue;
+      ++nb;
+      std::queue< Point > Q;
+      Q.push( p );
+      labels[ p ] = nb;
+      while ( ! Q.empty() )
+        {
+          const Point q = Q.front(); Q.pop();
+          std::vector< Point > neighbors;
+          std::back_insert_iterator< std::vector< Point > > out( neighbors );
+          adj.writeNeighbors( out, q );
+          for ( auto n : neighbors )
+            if ( aSet( n ) && ! labels.count( n ) )
+              {
+                labels[ n ] = nb;
+                Q.push( n );
+              }
+        }
+    }
+  return labels;
+}
+
+TEST_CASE( "ConnectedComponentLabelling of a 2D image", "[ccl]" )
+{
+  typedef ConnectedComponentLabelling< Z2i::Space > CCL;
+  typedef ImageContainerBySTLVector< Z2i::Domain, unsigned char > Image;
+  Image image( Z2i::Domain( Z2i::Point( -2, -1 ), Z2i::Point( 4, 3 ) ) );
+  // Two diagonal pixels and a horizontal bar.
+  image.setValue( Z2i::Point( -2, -1 ), 1 );
+  image.setValue( Z2i::Point( -1,  0 ), 1 );
+  image.setValue( Z2i::Point(  1,  3 ), 1 );
+  image.setValue( Z2i::Point(  2,  3 ), 1 );
+  image.setValue( Z2i::Point(  3,  3 ), 1 );
+
+  CCL ccl4( 1 );
+  CCL ccl8( 2 );
+  REQUIRE( ccl4.labelImage( image ) == 3 );
+  REQUIRE( ccl8.labelImage( image ) == 2 );
+  REQUIRE( ccl4.isValid() );
+  REQUIRE( ccl4.labels()( Z2i::Point( -2, -1 ) ) == 1 );
+  REQUIRE( ccl4.labels()( Z2i::Point( -1,  0 ) ) == 2 );
+  REQUIRE( ccl4.labels()( Z2i::Point(  2,  3 ) ) == 3 );
+  REQUIRE( ccl4.labels()( Z2i::Point(  0,  0 ) ) == 0 );
+  REQUIRE( ccl8.labels()( Z2i::Point( -1,  0 ) ) == 1 );
+  REQUIRE( ccl8.componentSize( 1 ) == 2 );
+  REQUIRE( ccl8.componentSize( 2 ) == 3 );
+  REQUIRE( ccl8.boundingBox( 2 ).first  == Z2i::Point( 1, 3 ) );
+  REQUIRE( ccl8.boundingBox( 2 ).second == Z2i::Point( 3, 3 ) );
+
+  // The predicate selects the background.
+  CCL cclBack( 1 );
+  REQUIRE( cclBack.labelImage( image, [] ( unsigned char v ) { return v == 0; } ) == 1 );
+  REQUIRE( cclBack.componentSize( 1 ) == image.domain().size() - 5 );
+}
+
+TEST_CASE( "ConnectedComponentLabelling of random 3D sets", "[ccl]" )
+{
+  typedef ConnectedComponentLabelling< Z3i::Space > CCL;
+  std::mt19937 gen( 7 );
+  std::bernoulli_distribution coin( 0.3 );
+  Z3i::Domain domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 12, 14, 20 ) );
+  Z3i::DigitalSet aSet( domain );
+  for ( auto p : domain )
+    if ( coin( gen ) ) aSet.insertNew( p );
+
+  SECTION( "Labels match breadth-first traversals for 6, 18 and 26 adjacencies" )
+    {
+      std::size_t nb6, nb18, nb26;
+      auto ref6  = referenceLabels( Z3i::Adj6(),  aSet, nb6 );
+      auto ref18 = referenceLabels( Z3i::Adj18(), aSet, nb18 );
+      auto ref26 = referenceLabels( Z3i::Adj26(), aSet, nb26 );
+      const std::map< Z3i::Point, std::size_t > * refs[ 3 ] = { &ref6, &ref18, &ref26 };
+      const std::size_t nbs[ 3 ] = { nb6, nb18, nb26 };
+      for ( Dimension n = 1; n <= 3; ++n )
+        {
+          CCL ccl( n );
+          REQUIRE( ccl.labelSet( aSet, domain ) == nbs[ n - 1 ] );
+          std::vector< std::size_t > sizes( ccl.nbComponents() + 1, 0 );
+          bool same = true;
+          for ( auto p : aSet )
+            {
+              same = same && ccl.labels()( p ) == refs[ n - 1 ]->at( p );
+              sizes[ ccl.labels()( p ) ]++;
+            }
+          REQUIRE( same );
+          bool sameSizes = true;
+          for ( CCL::Label l = 1; l <= ccl.nbComponents(); ++l )
+            sameSizes = sameSizes && sizes[ l ] == ccl.componentSize( l );
+          REQUIRE( sameSizes );
+        }
+    }
+
+  SECTION( "Labels, sizes and bounding boxes do not depend on the number of threads" )
+    {
+      CCL ccl( 3, 1 );
+      ccl.labelSet( aSet );
+      REQUIRE( ccl.domain().lowerBound() == domain.lowerBound() );
+      for ( unsigned int t : { 2u, 3u, 7u, 64u } )
+        {
+          CCL cclt( 3, t );
+          REQUIRE( cclt.labelSet( aSet ) == ccl.nbComponents() );
+          bool same = std::equal( ccl.labels().begin(), ccl.labels().end(),
+                                  cclt.labels().begin() );
+          for ( CCL::Label l = 1; l <= ccl.nbComponents(); ++l )
+            same = same && ccl.componentSize( l ) == cclt.componentSize( l )
+              && ccl.boundingBox( l ) == cclt.boundingBox( l );
+          REQUIRE( same );
+        }
+    }
+
+  SECTION( "Object uses the labelling for its components" )
+    {
+      Z3i::Object26_6 object( Z3i::dt26_6, aSet );
+      std::vector< Z3i::Object26_6 > components;
+      std::back_insert_iterator< std::vector< Z3i::Object26_6 > > it( components );
+      CCL ccl( 3 );
+      const auto nb = ccl.labelSet( aSet );
+      REQUIRE( object.writeComponents( it ) == nb );
+      REQUIRE( object.connectedness() == ( nb == 1 ? CONNECTED : DISCONNECTED ) );
+      bool ok = true;
+      for ( CCL::Label l = 1; l <= nb; ++l )
+        ok = ok && components[ l - 1 ].size() == ccl.componentSize( l )
+          && components[ l - 1 ].connectedness() == CONNECTED;
+      REQUIRE( ok );
+      Z3i::Object26_6 largest( Z3i::dt26_6, components[ 0 ].pointSet() );
+      REQUIRE( largest.computeConnectedness() == CONNECTED );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
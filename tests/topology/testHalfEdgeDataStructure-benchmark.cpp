@@ -0,0 +1,192 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHalfEdgeDataStructure-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the construction of HalfEdgeDataStructure on the dual
+ * triangulations of digital ellipsoids: the former construction with
+ * std::set for the edges and std::map for the arcs versus
+ * HalfEdgeDataStructure::build, which sorts packed edges (in
+ * parallel) and uses open-addressing hash maps for the arcs.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <set>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/ImplicitDigitalSurface.h"
+#include "DGtal/topology/HalfEdgeDataStructure.h"
+#include "DGtal/topology/CanonicCellEmbedder.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/shapes/TriangulatedSurface.h"
+#include "DGtal/shapes/MeshHelpers.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef HalfEdgeDataStructure::Triangle    Triangle;
+typedef HalfEdgeDataStructure::Edge        Edge;
+typedef HalfEdgeDataStructure::Arc         HEArc;
+typedef HalfEdgeDataStructure::Index       Index;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking HalfEdgeDataStructure::build.
+///////////////////////////////////////////////////////////////////////////////
+
+/// The digital ellipsoid of semi-axes a, b, c.
+struct ImplicitDigitalEllipsoid
+{
+  typedef Z3i::Point Point;
+  ImplicitDigitalEllipsoid( double a, double b, double c )
+    : myA( a ), myB( b ), myC( c ) {}
+  bool operator()( const Point & p ) const
+  {
+    const double x = p[ 0 ] / myA;
+    const double y = p[ 1 ] / myB;
+    const double z = p[ 2 ] / myC;
+    return x*x + y*y + z*z <= 1.0;
+  }
+  double myA, myB, myC;
+};
+
+/// @return the triangles of the dual triangulation of the boundary of
+/// the digital ellipsoid of semi-axes 4r, 3r, 2r.
+std::vector< Triangle > makeTriangles( int r )
+{
+  typedef ImplicitDigitalSurface< KSpace, ImplicitDigitalEllipsoid > Boundary;
+  typedef DigitalSurface< Boundary >                                 Surface;
+  KSpace K;
+  K.init( Point::diagonal( -4 * r - 2 ), Point::diagonal( 4 * r + 2 ), true );
+  ImplicitDigitalEllipsoid ellipsoid( 4 * r, 3 * r, 2 * r );
+  const SCell bel = Surfaces< KSpace >::findABel( K, ellipsoid, 100000 );
+  Surface surface( new Boundary( K, ellipsoid, SurfelAdjacency< 3 >( true ), bel ) );
+  CanonicCellEmbedder< KSpace > embedder( K );
+  TriangulatedSurface< RealPoint > trisurf;
+  std::map< SCell, TriangulatedSurface< RealPoint >::Index > vertexmap;
+  MeshHelpers::digitalSurface2DualTriangulatedSurface( surface, embedder, trisurf, vertexmap );
+  std::vector< Triangle > triangles( trisurf.nbFaces() );
+  for ( std::size_t f = 0; f < triangles.size(); ++f )
+    {
+      const auto vtcs = trisurf.verticesAroundFace( f );
+      triangles[ f ] = Triangle( vtcs[ 0 ], vtcs[ 1 ], vtcs[ 2 ] );
+    }
+  return triangles;
+}
+
+/**
+ * The former construction of the arcs of HalfEdgeDataStructure, with
+ * a std::set for the edges and std::map for the arcs.
+ *
+ * @return the number of edges.
+ */
+std::size_t formerBuild( const std::vector< Triangle > & triangles )
+{
+  std::set< Edge > edgeSet;
+  std::set< Index > vertexSet;
+  for ( const Triangle & T : triangles )
+    for ( unsigned int i = 0; i < 3; ++i )
+      {
+        edgeSet.insert( Edge( T.v[ i ], T.v[ ( i + 1 ) % 3 ] ) );
+        vertexSet.insert( T.v[ i ] );
+      }
+  std::vector< Edge > edges( edgeSet.begin(), edgeSet.end() );
+  std::map< HEArc, Index > de2fi;
+  for ( Index f = 0; f < triangles.size(); ++f )
+    for ( unsigned int i = 0; i < 3; ++i )
+      de2fi[ HEArc( triangles[ f ].v[ i ], triangles[ f ].v[ ( i + 1 ) % 3 ] ) ] = f;
+  std::map< HEArc, Index > arc2index;
+  std::vector< Index > faces( 2 * edges.size() );
+  for ( Index e = 0; e < edges.size(); ++e )
+    {
+      faces[ 2 * e ]     = de2fi.find( HEArc( edges[ e ].v[ 0 ], edges[ e ].v[ 1 ] ) )->second;
+      faces[ 2 * e + 1 ] = de2fi.find( HEArc( edges[ e ].v[ 1 ], edges[ e ].v[ 0 ] ) )->second;
+      arc2index[ HEArc( edges[ e ].v[ 0 ], edges[ e ].v[ 1 ] ) ] = 2 * e;
+      arc2index[ HEArc( edges[ e ].v[ 1 ], edges[ e ].v[ 0 ] ) ] = 2 * e + 1;
+    }
+  Index checksum = 0;
+  for ( const Triangle & T : triangles )
+    for ( unsigned int i = 0; i < 3; ++i )
+      checksum += arc2index[ HEArc( T.v[ i ], T.v[ ( i + 1 ) % 3 ] ) ];
+  trace.info() << vertexSet.size() << " vertices (checksum " << checksum << ")" << std::endl;
+  return edges.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+/**
+ * Usage: testHalfEdgeDataStructure-benchmark [max_radius]
+ */
+int main( int argc, char** argv )
+{
+  const int maxR = argc > 1 ? atoi( argv[ 1 ] ) : 60;
+  const unsigned int nbThreads = ParallelFor::nbThreads();
+  bool res = true;
+  trace.beginBlock ( "Benchmarking the construction of HalfEdgeDataStructure" );
+  for ( int r = 15; r <= maxR; r *= 2 )
+    {
+      trace.beginBlock( "Dual triangulation of a digital ellipsoid" );
+      const std::vector< Triangle > triangles = makeTriangles( r );
+      trace.info() << "Ellipsoid of semi-axes " << 4 * r << ", " << 3 * r << ", " << 2 * r
+                   << ": " << triangles.size() << " triangles." << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "Former construction (std::set and std::map)" );
+      const std::size_t former_edges = formerBuild( triangles );
+      trace.endBlock();
+
+      std::vector< Edge > edges;
+      trace.beginBlock( "getUnorderedEdgesFromTriangles, 1 thread" );
+      HalfEdgeDataStructure::getUnorderedEdgesFromTriangles( triangles, edges, 1 );
+      trace.endBlock();
+      trace.beginBlock( "getUnorderedEdgesFromTriangles, "
+                        + std::to_string( nbThreads ) + " thread(s)" );
+      HalfEdgeDataStructure::getUnorderedEdgesFromTriangles( triangles, edges, nbThreads );
+      trace.endBlock();
+
+      for ( unsigned int n : { 1u, nbThreads } )
+        {
+          trace.beginBlock( "HalfEdgeDataStructure::build (sorted edges and hash maps), "
+                            + std::to_string( n ) + " thread(s)" );
+          HalfEdgeDataStructure heds;
+          heds.setNbThreads( n );
+          const bool ok = heds.build( triangles );
+          trace.info() << heds << std::endl;
+          trace.endBlock();
+          res = res && ok && heds.nbEdges() == former_edges && edges.size() == former_edges;
+        }
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
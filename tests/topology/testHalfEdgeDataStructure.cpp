@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <algorithm>
+#include <set>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -180,6 +181,39 @@ HalfEdgeDataStructure makeBox()
 }
 
 
+/// A triangulated torus made of n x n squares, each cut in two triangles.
+std::vector< Triangle > makeTorusTriangles( const Size n )
+{
+  std::vector< Triangle > triangles;
+  for ( Size y = 0; y < n; ++y )
+    for ( Size x = 0; x < n; ++x )
+      {
+        const Size v00 = y * n + x;
+        const Size v10 = y * n + ( x + 1 ) % n;
+        const Size v01 = ( ( y + 1 ) % n ) * n + x;
+        const Size v11 = ( ( y + 1 ) % n ) * n + ( x + 1 ) % n;
+        triangles.push_back( Triangle( v00, v10, v11 ) );
+        triangles.push_back( Triangle( v00, v11, v01 ) );
+      }
+  return triangles;
+}
+
+/// The unoriented edges of the given faces, computed with std::set.
+template <typename TFace>
+std::vector< Edge > makeReferenceEdges( const std::vector< TFace >& faces, Size& nbVertices )
+{
+  std::set< Edge > edges;
+  std::set< Size > vertices;
+  for ( const TFace& F : faces )
+    for ( Size i = 0; i < F.size(); ++i )
+      {
+        edges.insert( Edge( F[ i ], F[ ( i + 1 ) % F.size() ] ) );
+        vertices.insert( F[ i ] );
+      }
+  nbVertices = vertices.size();
+  return std::vector< Edge >( edges.begin(), edges.end() );
+}
+
 SCENARIO( "HalfEdgeDataStructure build", "[halfedge][build]" )
 {
   GIVEN( "Two triangles incident by an edge" ) {
@@ -638,4 +672,52 @@ SCENARIO( "HalfEdgeDataStructure merges", "[halfedge][merges]" ){
   }
 }
 
+SCENARIO( "HalfEdgeDataStructure large builds", "[halfedge][build]" ){
+  GIVEN( "A triangulated torus with 80000 triangles" ) {
+    std::vector< Triangle > triangles = makeTorusTriangles( 200 );
+    std::vector< PolygonalFace > faces;
+    for ( const Triangle& T : triangles )
+      faces.push_back( PolygonalFace( T.v.begin(), T.v.end() ) );
+    Size refNbVertices = 0;
+    const std::vector< Edge > refEdges = makeReferenceEdges( faces, refNbVertices );
+    THEN( "Edges are the sorted edges of std::set, with any number of threads" ) {
+      for ( unsigned int nbThreads : { 1u, 4u } )
+        {
+          std::vector< Edge > edges, pedges;
+          const Size nbV  = HalfEdgeDataStructure::getUnorderedEdgesFromTriangles
+            ( triangles, edges, nbThreads );
+          const Size pnbV = HalfEdgeDataStructure::getUnorderedEdgesFromPolygonalFaces
+            ( faces, pedges, nbThreads );
+          REQUIRE( nbV == refNbVertices );
+          REQUIRE( pnbV == refNbVertices );
+          REQUIRE( edges == refEdges );
+          REQUIRE( pedges == refEdges );
+        }
+    }
+    THEN( "The mesh is a valid torus, whose arcs are found by both lookups" ) {
+      HalfEdgeDataStructure mesh;
+      mesh.setNbThreads( 4 );
+      REQUIRE( mesh.build( triangles ) );
+      REQUIRE( mesh.isValid() );
+      REQUIRE( mesh.nbVertices() == 40000 );
+      REQUIRE( mesh.nbEdges() == 120000 );
+      REQUIRE( mesh.Euler() == 0 );
+      bool ok = true;
+      for ( Size i = 0; i < mesh.nbHalfEdges(); ++i )
+        {
+          const ArcT arc = mesh.arcFromHalfEdgeIndex( i );
+          ok = ok && mesh.halfEdgeIndexFromArc( arc ) == i
+            && mesh.findHalfEdgeIndexFromArc( arc ) == i;
+        }
+      REQUIRE( ok );
+      REQUIRE( mesh.halfEdgeIndexFromArc( 0, 40001 ) == HALF_EDGE_INVALID_INDEX );
+    }
+    THEN( "A face sharing an arc with another face is rejected" ) {
+      triangles.push_back( triangles[ 17 ] );
+      HalfEdgeDataStructure mesh;
+      REQUIRE( ! mesh.build( triangles ) );
+    }
+  }
+}
+
 /** @ingroup Tests **/
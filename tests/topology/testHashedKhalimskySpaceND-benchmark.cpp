@@ -0,0 +1,150 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHashedKhalimskySpaceND-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmarks boundary tracking and adjacency queries with
+ * KhalimskySpaceND (ordered sets of cells) and HashedKhalimskySpaceND
+ * (hashed sets of cells).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/HashedKhalimskySpaceND.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class HashedKhalimskySpaceND.
+///////////////////////////////////////////////////////////////////////////////
+namespace DGtal {
+  template <typename TPoint3>
+  struct ImplicitDigitalEllipse3 {
+    typedef TPoint3 Point;
+    inline
+    ImplicitDigitalEllipse3( double a, double b, double c )
+      : myA( a ), myB( b ), myC( c )
+    {}
+    inline
+    bool operator()( const TPoint3 & p ) const
+    {
+      double x = ( (double) p[ 0 ] / myA );
+      double y = ( (double) p[ 1 ] / myB );
+      double z = ( (double) p[ 2 ] / myC );
+    return ( x*x + y*y + z*z ) <= 1.0;
+    }
+    double myA, myB, myC;
+  };
+
+  /**
+   * Tracks the boundary of a shape and builds the digital surface
+   * with the set of surfels of the given space.
+   *
+   * @return the number of surfels of the boundary.
+   */
+  template <typename KSpace, typename PointPredicate>
+  unsigned int
+  benchmarkTracking( const std::string & name,
+                     const typename KSpace::Point & low,
+                     const typename KSpace::Point & up,
+                     const PointPredicate & pp )
+  {
+    typedef SetOfSurfels< KSpace > Container;
+    KSpace K;
+    K.init( low, up, true );
+    SurfelAdjacency< KSpace::dimension > SAdj( true );
+    typename KSpace::SCell bel = Surfaces< KSpace >::findABel( K, pp, 10000 );
+
+    trace.beginBlock( name + " trackBoundary" );
+    typename KSpace::SurfelSet boundary;
+    Surfaces< KSpace >::trackBoundary( boundary, K, SAdj, pp, bel );
+    trace.info() << boundary.size() << " surfels." << std::endl;
+    trace.endBlock();
+
+    trace.beginBlock( name + " trackClosedBoundary" );
+    typename KSpace::SurfelSet closed;
+    Surfaces< KSpace >::trackClosedBoundary( closed, K, SAdj, pp, bel );
+    trace.endBlock();
+
+    DigitalSurface< Container > surface( new Container( K, SAdj, boundary ) );
+    // The iteration order of the container is the order of the cells
+    // for ordered sets, but a pseudo-random one for hashed sets, so
+    // queries are also done in the same order for both.
+    trace.beginBlock( name + " adjacency queries on SetOfSurfels (container order)" );
+    std::size_t nbArcs = 0;
+    for ( auto const & s : surface )
+      nbArcs += surface.degree( s );
+    trace.info() << nbArcs << " arcs." << std::endl;
+    trace.endBlock();
+
+    std::vector< typename KSpace::SCell > sorted( boundary.begin(), boundary.end() );
+    std::sort( sorted.begin(), sorted.end() );
+    trace.beginBlock( name + " adjacency queries on SetOfSurfels (cell order)" );
+    std::size_t nbSortedArcs = 0;
+    for ( auto const & s : sorted )
+      nbSortedArcs += surface.degree( s );
+    trace.info() << nbSortedArcs << " arcs." << std::endl;
+    trace.endBlock();
+
+    trace.beginBlock( name + " breadth-first traversal of the DigitalSurface" );
+    BreadthFirstVisitor< DigitalSurface< Container > > visitor( surface, sorted.front() );
+    std::size_t nbVisited = 0;
+    for ( ; ! visitor.finished(); visitor.expand() )
+      ++nbVisited;
+    trace.info() << nbVisited << " visited surfels." << std::endl;
+    trace.endBlock();
+    return closed.size() == boundary.size() && nbArcs == nbSortedArcs
+      && nbVisited == boundary.size() ? boundary.size() : 0;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int, char** )
+{
+  using namespace Z3i;
+  typedef DGtal::ImplicitDigitalEllipse3<Point> ImplicitDigitalEllipse;
+  typedef HashedKhalimskySpaceND< 3, DGtal::int32_t > HKSpace;
+
+  trace.beginBlock ( "Benchmarking boundary tracking with ordered and hashed cell sets" );
+  Point p1( -200, -200, -200 );
+  Point p2( 200, 200, 200 );
+  ImplicitDigitalEllipse ellipse( 180.0, 135.0, 102.0 );
+  unsigned int nb  = benchmarkTracking< KSpace >( "KhalimskySpaceND", p1, p2, ellipse );
+  unsigned int nbh = benchmarkTracking< HKSpace >( "HashedKhalimskySpaceND", p1, p2, ellipse );
+  bool res = ( nb == 354382 ) && ( nbh == nb );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHashedKhalimskySpaceND.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class HashedKhalimskySpaceND.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/HashedKhalimskySpaceND.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HashedKhalimskySpaceND.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef HashedKhalimskySpaceND< 3, DGtal::int32_t > HKSpace;
+BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< HKSpace > ));
+BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< HashedKhalimskySpaceND< 2, DGtal::int64_t > > ));
+
+TEST_CASE( "Testing HashedKhalimskySpaceND" )
+{
+  typedef Z3i::Space Space;
+  typedef Z3i::Point Point;
+  typedef ImplicitBall< Space > Ball;
+  typedef GaussDigitizer< Space, Ball > Shape;
+
+  Ball ball( Z3i::RealPoint( 0.5, -0.25, 0.0 ), 12.3 );
+  Shape shape;
+  shape.attach( ball );
+  shape.init( Point::diagonal( -16 ), Point::diagonal( 16 ), 1.0 );
+
+  Z3i::KSpace K;
+  HKSpace HK;
+  REQUIRE( K.init( Point::diagonal( -16 ), Point::diagonal( 16 ), true ) );
+  REQUIRE( HK.init( Point::diagonal( -16 ), Point::diagonal( 16 ), true ) );
+  SurfelAdjacency<3> SAdj( true );
+
+  SECTION( "Packed hash functor" )
+    {
+      KhalimskyCellPackedHash< HKSpace::SCell > hash;
+      HKSpace::SCell s = HK.sCell( Point( 1, 2, 3 ), true );
+      HKSpace::SCell t = HK.sCell( Point( 1, 2, 3 ), false );
+      REQUIRE( hash( s ) == hash( HK.sCell( Point( 1, 2, 3 ), true ) ) );
+      REQUIRE( hash( s ) != hash( t ) );
+      REQUIRE( KhalimskyCellPackedHash< HKSpace::Cell >()( HK.unsigns( s ) )
+               != KhalimskyCellPackedHash< HKSpace::Cell >()( HK.uCell( Point( 2, 1, 3 ) ) ) );
+    }
+
+  SECTION( "Opposite surfels have different packed hash values" )
+    {
+      typedef HashedKhalimskySpaceND< 2, DGtal::int32_t > HKSpace2;
+      HKSpace2 HK2;
+      REQUIRE( HK2.init( Z2i::Point::diagonal( -16 ), Z2i::Point::diagonal( 16 ), true ) );
+      KhalimskyCellPackedHash< HKSpace2::SCell > hash2;
+      unsigned int nb2 = 0, nbOk2 = 0;
+      for ( int x = -9; x <= 9; ++x )
+        for ( int y = -9; y <= 9; ++y )
+          if ( ( x + y ) % 2 != 0 )
+            {
+              const HKSpace2::SCell s = HK2.sCell( Z2i::Point( x, y ), true );
+              REQUIRE( HK2.sDim( s ) == 1 );
+              nbOk2 += hash2( s ) != hash2( HK2.sOpp( s ) ) ? 1 : 0;
+              ++nb2;
+            }
+      REQUIRE( nbOk2 == nb2 );
+
+      KhalimskyCellPackedHash< HKSpace::SCell > hash3;
+      HKSpace::SurfelSet hboundary;
+      Surfaces< HKSpace >::sMakeBoundary( hboundary, HK, shape, HK.lowerBound(), HK.upperBound() );
+      unsigned int nbOk3 = 0;
+      for ( auto const & s : hboundary )
+        nbOk3 += hash3( s ) != hash3( HK.sOpp( s ) ) ? 1 : 0;
+      REQUIRE( nbOk3 == hboundary.size() );
+    }
+
+  SECTION( "Tracked boundaries are the same as with KhalimskySpaceND" )
+    {
+      Z3i::KSpace::SCell bel = Surfaces< Z3i::KSpace >::findABel( K, shape, 10000 );
+      Z3i::KSpace::SurfelSet boundary;
+      Surfaces< Z3i::KSpace >::trackBoundary( boundary, K, SAdj, shape, bel );
+
+      HKSpace::SurfelSet hboundary;
+      Surfaces< HKSpace >::trackBoundary( hboundary, HK, SAdj, shape, bel );
+      REQUIRE( hboundary.size() == boundary.size() );
+      REQUIRE( std::set< HKSpace::SCell >( hboundary.begin(), hboundary.end() ) == boundary );
+
+      HKSpace::SurfelSet hclosed;
+      Surfaces< HKSpace >::trackClosedBoundary( hclosed, HK, SAdj, shape, bel );
+      REQUIRE( hclosed == hboundary );
+
+      HKSpace::SurfelSet hall;
+      Surfaces< HKSpace >::sMakeBoundary( hall, HK, shape, HK.lowerBound(), HK.upperBound() );
+      REQUIRE( hall == hboundary );
+    }
+
+  SECTION( "Digital surfaces and complexes" )
+    {
+      HKSpace::SurfelSet hboundary;
+      Surfaces< HKSpace >::sMakeBoundary( hboundary, HK, shape, HK.lowerBound(), HK.upperBound() );
+      typedef SetOfSurfels< HKSpace > Container;
+      DigitalSurface< Container > surface( new Container( HK, SAdj, hboundary ) );
+      REQUIRE( surface.size() == hboundary.size() );
+      // A closed surface: every surfel has four neighbors.
+      unsigned int nbOk = 0;
+      for ( auto const & s : surface )
+        nbOk += surface.degree( s ) == 4 ? 1 : 0;
+      REQUIRE( nbOk == surface.size() );
+
+      CubicalComplex< HKSpace > complex( HK );
+      for ( auto const & s : hboundary )
+        complex.insertCell( HK.unsigns( s ) );
+      complex.close();
+      REQUIRE( complex.euler() == 2 );
+    }
+}
+
+/** @ingroup Tests **/
@@ -0,0 +1,164 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIndexedDigitalSurface-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the construction of IndexedDigitalSurface: the former
+ * construction with ordered maps and sets versus
+ * IndexedDigitalSurface::build, which sorts faces once and uses
+ * open-addressing hash maps for the cell to index mappings.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/IndexedDigitalSurface.h"
+#include "DGtal/shapes/Shapes.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z3i;
+
+typedef DigitalSetBoundary< KSpace, DigitalSet >          DigitalSurfaceContainer;
+typedef IndexedDigitalSurface< DigitalSurfaceContainer > DigSurface;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking IndexedDigitalSurface::build.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Approximate memory used by a std::map (red-black tree nodes).
+template <typename Map>
+std::size_t memoryOfMap( const Map & m )
+{
+  return m.size() * ( sizeof( typename Map::value_type ) + 4 * sizeof( void* ) );
+}
+
+/// Approximate memory used by an OpenAddressingHashMap (slots and control bytes).
+template <typename Map>
+std::size_t memoryOfHashMap( const Map & m )
+{
+  return m.bucket_count() * ( sizeof( typename Map::value_type ) + 1 );
+}
+
+/**
+ * The former construction of IndexedDigitalSurface, with std::map
+ * for the surfel, linel and pointel mappings, and std::set for the
+ * faces and edges.
+ *
+ * @param[out] memory the approximate memory used by the three maps.
+ * @return the number of arcs.
+ */
+std::size_t formerBuild( const DigitalSurfaceContainer & container, std::size_t & memory )
+{
+  DigitalSurface< DigitalSurfaceContainer > surface( container );
+  std::map< SCell, DigSurface::VertexIndex > surfel2Vertex;
+  std::map< SCell, DigSurface::Arc >         linel2Arc;
+  std::map< SCell, DigSurface::FaceIndex >   pointel2Face;
+  std::vector< SCell > vertex2Surfel;
+  DigSurface::VertexIndex i = 0;
+  for ( SCell aSurfel : surface )
+    {
+      vertex2Surfel.push_back( aSurfel );
+      surfel2Vertex[ aSurfel ] = i++;
+    }
+  DigSurface::FaceIndex j = 0;
+  std::vector< DigSurface::PolygonalFace > polygonalFaces;
+  for ( auto aFace : surface.allClosedFaces() )
+    {
+      auto vtcs = surface.verticesAroundFace( aFace );
+      DigSurface::PolygonalFace idx_face( vtcs.size() );
+      std::transform( vtcs.cbegin(), vtcs.cend(), idx_face.begin(),
+                      [&] ( const SCell& v ) { return surfel2Vertex[ v ]; } );
+      polygonalFaces.push_back( idx_face );
+      pointel2Face[ surface.pivot( aFace ) ] = j++;
+    }
+  HalfEdgeDataStructure heds;
+  heds.build( polygonalFaces );
+  for ( DigSurface::Arc fi = 0; fi < heds.nbHalfEdges(); ++fi )
+    {
+      auto vi_vj = heds.arcFromHalfEdgeIndex( fi );
+      SCell lnl = surface.separator( surface.arc( vertex2Surfel[ vi_vj.first ],
+                                                  vertex2Surfel[ vi_vj.second ] ) );
+      linel2Arc[ lnl ] = fi;
+    }
+  memory = memoryOfMap( surfel2Vertex ) + memoryOfMap( linel2Arc ) + memoryOfMap( pointel2Face );
+  return linel2Arc.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int, char** )
+{
+  bool res = true;
+  trace.beginBlock ( "Benchmarking the construction of IndexedDigitalSurface" );
+  const int radii[ 3 ] = { 20, 40, 60 };
+  for ( int r : radii )
+    {
+      trace.beginBlock( "Digital ball" );
+      Point p1 = Point::diagonal( -r - 2 );
+      Point p2 = Point::diagonal(  r + 2 );
+      KSpace K;
+      K.init( p1, p2, true );
+      DigitalSet aSet( Domain( p1, p2 ) );
+      Shapes<Domain>::addNorm2Ball( aSet, Point::zero, r );
+      CountedPtr< DigitalSurfaceContainer > container( new DigitalSurfaceContainer( K, aSet ) );
+      trace.info() << "Ball of radius " << r << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "Former construction (std::map and std::set)" );
+      std::size_t former_memory = 0;
+      std::size_t former_arcs = formerBuild( *container, former_memory );
+      trace.info() << former_arcs << " arcs, maps use about "
+                   << ( former_memory >> 10 ) << " KB." << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "IndexedDigitalSurface::build (sorted faces and hash maps)" );
+      DigSurface dsurf;
+      const bool ok = dsurf.build( container );
+      trace.info() << dsurf.nbVertices() << " vertices, " << dsurf.nbArcs()
+                   << " arcs, " << dsurf.nbFaces() << " faces." << std::endl;
+      trace.endBlock();
+
+      // The maps are protected: their memory is measured on maps of the same type.
+      OpenAddressingHashMap< SCell, DigSurface::Index > surfels, linels, pointels;
+      surfels .reserve( dsurf.nbVertices() );
+      linels  .reserve( dsurf.nbArcs() );
+      pointels.reserve( dsurf.nbFaces() );
+      trace.info() << "Hash maps use about "
+                   << ( ( memoryOfHashMap( surfels ) + memoryOfHashMap( linels )
+                          + memoryOfHashMap( pointels ) ) >> 10 ) << " KB." << std::endl;
+      res = res && ok && former_arcs == dsurf.nbArcs();
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -93,6 +93,33 @@ SCENARIO( "IndexedDigitalSurface< DigitalSetBoundary > build tests", "[idxdsurf]
       REQUIRE( K.sOpp( dsurf.linel( 112 ) ) == dsurf.linel( dsurf.opposite( 112 ) ) );
       REQUIRE( K.sOpp( dsurf.linel( 200 ) ) == dsurf.linel( dsurf.opposite( 200 ) ) );
     }
+    THEN( "Surfels, linels and pointels are mapped back to their vertices, arcs and faces" ) {
+      bool vertices_ok = true;
+      for ( DigSurface::Vertex v = 0; v < dsurf.nbVertices(); ++v )
+        vertices_ok = vertices_ok && dsurf.getVertex( dsurf.surfel( v ) ) == v;
+      bool arcs_ok = true;
+      for ( DigSurface::Arc a = 0; a < dsurf.nbArcs(); ++a )
+        arcs_ok = arcs_ok && dsurf.getArc( dsurf.linel( a ) ) == a;
+      bool faces_ok = true;
+      for ( DigSurface::Face f = 0; f < dsurf.nbFaces(); ++f )
+        faces_ok = faces_ok && dsurf.getFace( dsurf.pointel( f ) ) == f;
+      REQUIRE( vertices_ok );
+      REQUIRE( arcs_ok );
+      REQUIRE( faces_ok );
+      const DigSurface::Vertex invalid = DigSurface::INVALID_FACE;
+      REQUIRE( dsurf.getVertex( dsurf.linel( 0 ) ) == invalid );
+    }
+    THEN( "Faces are numbered in the order of DigitalSurface::allClosedFaces" ) {
+      DigitalSurface< DigitalSurfaceContainer > surface( dsurf.container() );
+      std::vector< SCell > pointels;
+      for ( auto f : surface.allClosedFaces() )
+        pointels.push_back( surface.pivot( f ) );
+      REQUIRE( pointels.size() == dsurf.nbFaces() );
+      bool order_ok = true;
+      for ( DigSurface::Face f = 0; f < dsurf.nbFaces(); ++f )
+        order_ok = order_ok && dsurf.pointel( f ) == pointels[ f ];
+      REQUIRE( order_ok );
+    }
     THEN( "Breadth-first visiting the digital surface from vertex 0 goes to a distance 13." ) {
       BreadthFirstVisitor< DigSurface > visitor( dsurf, 0 );
       std::vector<int> vertices;
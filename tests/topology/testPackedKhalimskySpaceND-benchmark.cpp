@@ -0,0 +1,203 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedKhalimskySpaceND-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmarks the memory and the speed of sets of cells with
+ * HashedKhalimskySpaceND (hashed cells) and PackedKhalimskySpaceND
+ * (hashed 64 bits codes of cells).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/HashedKhalimskySpaceND.h"
+#include "DGtal/topology/PackedKhalimskySpaceND.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class PackedKhalimskySpaceND.
+///////////////////////////////////////////////////////////////////////////////
+namespace DGtal {
+  template <typename TPoint3>
+  struct ImplicitDigitalEllipse3 {
+    typedef TPoint3 Point;
+    inline
+    ImplicitDigitalEllipse3( double a, double b, double c )
+      : myA( a ), myB( b ), myC( c )
+    {}
+    inline
+    bool operator()( const TPoint3 & p ) const
+    {
+      double x = ( (double) p[ 0 ] / myA );
+      double y = ( (double) p[ 1 ] / myB );
+      double z = ( (double) p[ 2 ] / myC );
+    return ( x*x + y*y + z*z ) <= 1.0;
+    }
+    double myA, myB, myC;
+  };
+
+  /// @return the memory used by the slots of an OpenAddressingHashSet of cells.
+  template <typename TSet>
+  std::size_t setBytes( const TSet & S )
+  {
+    return S.bucket_count() * ( sizeof( typename TSet::value_type ) + 1 );
+  }
+
+  /// @return the memory used by the slots of a PackedKhalimskyCellSet.
+  template <typename TCell>
+  std::size_t setBytes( const PackedKhalimskyCellSet< TCell > & S )
+  {
+    return S.bucket_count() * ( sizeof( typename PackedKhalimskyCellSet< TCell >::Code ) + 1 );
+  }
+
+  /**
+   * Tracks the boundary of a shape with the set of surfels of the
+   * given space, then counts the adjacent surfels of each surfel by
+   * lookups in this set.
+   *
+   * @param[out] bytes the memory used by the set of surfels.
+   * @return the number of surfels of the boundary.
+   */
+  template <typename KSpace, typename PointPredicate>
+  unsigned int
+  benchmarkSurfelSet( const std::string & name,
+                      const typename KSpace::Point & low,
+                      const typename KSpace::Point & up,
+                      const PointPredicate & pp,
+                      std::size_t & bytes )
+  {
+    typedef SetOfSurfels< KSpace > Container;
+    KSpace K;
+    K.init( low, up, true );
+    SurfelAdjacency< KSpace::dimension > SAdj( true );
+    typename KSpace::SCell bel = Surfaces< KSpace >::findABel( K, pp, 10000 );
+
+    trace.beginBlock( name + " trackBoundary" );
+    typename KSpace::SurfelSet boundary;
+    Surfaces< KSpace >::trackBoundary( boundary, K, SAdj, pp, bel );
+    bytes = setBytes( boundary );
+    trace.info() << boundary.size() << " surfels, " << bytes << " bytes." << std::endl;
+    trace.endBlock();
+
+    trace.beginBlock( name + " adjacency queries on SetOfSurfels" );
+    DigitalSurface< Container > surface( new Container( K, SAdj, boundary ) );
+    std::size_t nbArcs = 0;
+    for ( auto const & s : surface )
+      nbArcs += surface.degree( s );
+    trace.info() << nbArcs << " arcs." << std::endl;
+    trace.endBlock();
+    return boundary.size();
+  }
+
+  /**
+   * Counts, for each surfel of the boundary of a shape, the
+   * surfels of the boundary that are adjacent along a common
+   * direction, with the cell operations of the space and lookups of
+   * cells on one hand, and with the operations and lookups of codes on
+   * the other hand.
+   *
+   * @return 'true' iff both counts are the same.
+   */
+  template <typename PointPredicate>
+  bool
+  benchmarkCodeOperations( const Z3i::Point & low,
+                           const Z3i::Point & up,
+                           const PointPredicate & pp )
+  {
+    typedef PackedKhalimskySpaceND< 3, DGtal::int32_t > KSpace;
+    typedef KSpace::Packing Packing;
+    typedef KSpace::Code Code;
+    KSpace K;
+    K.init( low, up, true );
+    SurfelAdjacency< 3 > SAdj( true );
+    KSpace::SurfelSet boundary;
+    Surfaces< KSpace >::trackBoundary( boundary, K, SAdj, pp,
+                                       Surfaces< KSpace >::findABel( K, pp, 10000 ) );
+    HashedKhalimskySpaceND< 3, DGtal::int32_t >::SurfelSet cells( boundary.begin(), boundary.end() );
+    std::vector< KSpace::SCell > surfels( boundary.begin(), boundary.end() );
+    std::vector< Code > codes;
+    for ( auto const & s : surfels )
+      codes.push_back( Packing::encode( s ) );
+
+    trace.beginBlock( "Cell operations and lookups" );
+    std::size_t nb = 0, nbPos = 0;
+    for ( auto const & s : surfels )
+      for ( Dimension k = 0; k < 3; ++k )
+        {
+          if ( ! K.sIsOpen( s, k ) ) continue;
+          nb += cells.count( K.sAdjacent( s, k, true ) ) + cells.count( K.sAdjacent( s, k, false ) );
+          nbPos += K.sSign( K.sDirectIncident( s, k ) ) == KSpace::POS ? 1 : 0;
+          nbPos += K.sSign( K.sIncident( s, k, false ) ) == KSpace::POS ? 1 : 0;
+        }
+    trace.info() << nb << " adjacent surfels, " << nbPos << " positive linels." << std::endl;
+    trace.endBlock();
+
+    trace.beginBlock( "Code operations and lookups" );
+    std::size_t nbc = 0, nbcPos = 0;
+    for ( auto code : codes )
+      for ( Dimension k = 0; k < 3; ++k )
+        {
+          if ( ! Packing::isOpen( code, k ) ) continue;
+          nbc += boundary.codes().count( Packing::sAdjacent( code, k, true ) )
+            + boundary.codes().count( Packing::sAdjacent( code, k, false ) );
+          nbcPos += Packing::sSign( Packing::sDirectIncident( code, k ) ) ? 1 : 0;
+          nbcPos += Packing::sSign( Packing::sIncident( code, k, false ) ) ? 1 : 0;
+        }
+    trace.info() << nbc << " adjacent surfels, " << nbcPos << " positive linels." << std::endl;
+    trace.endBlock();
+    return ( nb == nbc ) && ( nbPos == nbcPos );
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int, char** )
+{
+  using namespace Z3i;
+  typedef DGtal::ImplicitDigitalEllipse3<Point> ImplicitDigitalEllipse;
+  typedef HashedKhalimskySpaceND< 3, DGtal::int32_t > HKSpace;
+  typedef PackedKhalimskySpaceND< 3, DGtal::int32_t > PKSpace;
+
+  trace.beginBlock ( "Benchmarking sets of hashed cells and of hashed codes of cells" );
+  Point p1( -200, -200, -200 );
+  Point p2( 200, 200, 200 );
+  ImplicitDigitalEllipse ellipse( 180.0, 135.0, 102.0 );
+  std::size_t bytesh = 0, bytesp = 0;
+  unsigned int nbh = benchmarkSurfelSet< HKSpace >( "HashedKhalimskySpaceND", p1, p2, ellipse, bytesh );
+  unsigned int nbp = benchmarkSurfelSet< PKSpace >( "PackedKhalimskySpaceND", p1, p2, ellipse, bytesp );
+  trace.info() << "Memory ratio packed/hashed = " << double( bytesp ) / double( bytesh ) << std::endl;
+  bool res = ( nbh == 354382 ) && ( nbp == nbh ) && ( bytesp < bytesh );
+  res = benchmarkCodeOperations( p1, p2, ellipse ) && res;
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
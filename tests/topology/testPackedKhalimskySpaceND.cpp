@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedKhalimskySpaceND.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing classes KhalimskyCellPacking,
+ * PackedKhalimskyCellSet and PackedKhalimskySpaceND.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <random>
+#include <set>
+#include "DGtal/base/Common.h"
+#include "DGtalCatch.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/CSTLAssociativeContainer.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/PackedKhalimskySpaceND.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/CubicalComplex.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedKhalimskySpaceND.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef PackedKhalimskySpaceND< 3, DGtal::int32_t > PKSpace;
+BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< PKSpace > ));
+BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< PackedKhalimskySpaceND< 2, DGtal::int64_t > > ));
+BOOST_CONCEPT_ASSERT(( concepts::CSTLAssociativeContainer< PKSpace::SurfelSet > ));
+
+/// Checks that the operations on codes match the ones on cells.
+template < typename KSpace >
+void checkCodeOperations( const KSpace & K, unsigned int nb )
+{
+  typedef typename KSpace::Packing Packing;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::Cell Cell;
+  typedef typename KSpace::SCell SCell;
+
+  std::mt19937 gen( 17 );
+  unsigned int nbOk = 0, nbTests = 0;
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      Point kp;
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        {
+          std::uniform_int_distribution< int > dist( K.uKCoord( K.lowerCell(), k ) + 2,
+                                                     K.uKCoord( K.upperCell(), k ) - 2 );
+          kp[ k ] = dist( gen );
+        }
+      const SCell s = K.sCell( kp, gen() % 2 == 0 );
+      const Cell  c = K.unsigns( s );
+      const auto code  = Packing::encode( s );
+      const auto ucode = Packing::encode( c );
+      nbTests += 8;
+      nbOk += Packing::sDecode( code ) == s ? 1 : 0;
+      nbOk += Packing::uDecode( ucode ) == c ? 1 : 0;
+      nbOk += Packing::unsigns( code ) == ucode ? 1 : 0;
+      nbOk += Packing::sOpp( code ) == Packing::encode( K.sOpp( s ) ) ? 1 : 0;
+      nbOk += Packing::sSign( code ) == ( K.sSign( s ) == KSpace::POS ) ? 1 : 0;
+      nbOk += Packing::dimensionOf( code ) == K.sDim( s ) ? 1 : 0;
+      nbOk += Packing::kCoords( code ) == kp ? 1 : 0;
+      nbOk += Packing::signs( ucode, K.sSign( s ) == KSpace::POS ) == code ? 1 : 0;
+      for ( Dimension k = 0; k < KSpace::dimension; ++k )
+        {
+          nbTests += 12;
+          nbOk += Packing::isOpen( code, k ) == K.sIsOpen( s, k ) ? 1 : 0;
+          nbOk += Packing::sDirect( code, k ) == K.sDirect( s, k ) ? 1 : 0;
+          nbOk += Packing::sDirectIncident( code, k ) == Packing::encode( K.sDirectIncident( s, k ) ) ? 1 : 0;
+          nbOk += Packing::sIndirectIncident( code, k ) == Packing::encode( K.sIndirectIncident( s, k ) ) ? 1 : 0;
+          for ( bool up : { false, true } )
+            {
+              nbOk += Packing::sIncident( code, k, up ) == Packing::encode( K.sIncident( s, k, up ) ) ? 1 : 0;
+              nbOk += Packing::uIncident( ucode, k, up ) == Packing::encode( K.uIncident( c, k, up ) ) ? 1 : 0;
+              nbOk += Packing::sAdjacent( code, k, up ) == Packing::encode( K.sAdjacent( s, k, up ) ) ? 1 : 0;
+              nbOk += Packing::uAdjacent( ucode, k, up ) == Packing::encode( K.uAdjacent( c, k, up ) ) ? 1 : 0;
+            }
+        }
+    }
+  REQUIRE( nbOk == nbTests );
+}
+
+TEST_CASE( "Testing KhalimskyCellPacking" )
+{
+  SECTION( "Operations on codes in 2D and 3D" )
+    {
+      PackedKhalimskySpaceND< 2, DGtal::int64_t > K2;
+      REQUIRE( K2.init( Z2i::Point( -1000, -300 ), Z2i::Point( 500, 1000 ), true ) );
+      checkCodeOperations( K2, 1000 );
+      PKSpace K3;
+      REQUIRE( K3.init( Z3i::Point( -100, -300, -20 ), Z3i::Point( 500, 100, 20 ), true ) );
+      checkCodeOperations( K3, 1000 );
+    }
+
+  SECTION( "Packable bounds" )
+    {
+      typedef PKSpace::Packing Packing;
+      REQUIRE( Packing::bits == 21 );
+      REQUIRE( Packing::isPackable( Z3i::Point( -( 1 << 20 ), 0, ( 1 << 20 ) - 1 ) ) );
+      REQUIRE( ! Packing::isPackable( Z3i::Point( 0, 1 << 20, 0 ) ) );
+      PKSpace K;
+      REQUIRE( K.init( Z3i::Point::diagonal( -500000 ), Z3i::Point::diagonal( 500000 ), true ) );
+      REQUIRE( ! K.init( Z3i::Point::diagonal( -600000 ), Z3i::Point::diagonal( 0 ), true ) );
+      REQUIRE( ! K.init( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( 600000 ), PKSpace::OPEN ) );
+    }
+}
+
+TEST_CASE( "Testing PackedKhalimskySpaceND" )
+{
+  typedef Z3i::Space Space;
+  typedef Z3i::Point Point;
+  typedef ImplicitBall< Space > Ball;
+  typedef GaussDigitizer< Space, Ball > Shape;
+
+  Ball ball( Z3i::RealPoint( 0.5, -0.25, 0.0 ), 12.3 );
+  Shape shape;
+  shape.attach( ball );
+  shape.init( Point::diagonal( -16 ), Point::diagonal( 16 ), 1.0 );
+
+  Z3i::KSpace K;
+  PKSpace PK;
+  REQUIRE( K.init( Point::diagonal( -16 ), Point::diagonal( 16 ), true ) );
+  REQUIRE( PK.init( Point::diagonal( -16 ), Point::diagonal( 16 ), true ) );
+  SurfelAdjacency<3> SAdj( true );
+
+  SECTION( "Packed sets of cells" )
+    {
+      PKSpace::SCellSet S;
+      PKSpace::SCell s = PK.sCell( Point( 1, 2, 3 ), true );
+      PKSpace::SCell t = PK.sCell( Point( 1, 2, 3 ), false );
+      REQUIRE( S.insert( s ).second );
+      REQUIRE( ! S.insert( s ).second );
+      REQUIRE( *S.insert( t ).first == t );
+      REQUIRE( S.size() == 2 );
+      REQUIRE( S.count( s ) == 1 );
+      REQUIRE( S.count( PK.sCell( Point( 1, 2, 5 ) ) ) == 0 );
+      REQUIRE( S.find( t ) != S.end() );
+      REQUIRE( *S.find( t ) == t );
+      REQUIRE( S.erase( s ) == 1 );
+      REQUIRE( S.erase( s ) == 0 );
+      REQUIRE( S.size() == 1 );
+      REQUIRE( *S.begin() == t );
+      S.erase( S.begin() );
+      REQUIRE( S.empty() );
+      REQUIRE( S.isValid() );
+
+      PKSpace::CellSet C;
+      C.insert( PK.uCell( Point( 1, 2, 3 ) ) );
+      REQUIRE( C.count( PK.unsigns( s ) ) == 1 );
+      REQUIRE( C.codes().count( PKSpace::Packing::encode( PK.unsigns( t ) ) ) == 1 );
+    }
+
+  SECTION( "Tracked boundaries are the same as with KhalimskySpaceND" )
+    {
+      Z3i::KSpace::SCell bel = Surfaces< Z3i::KSpace >::findABel( K, shape, 10000 );
+      Z3i::KSpace::SurfelSet boundary;
+      Surfaces< Z3i::KSpace >::trackBoundary( boundary, K, SAdj, shape, bel );
+
+      PKSpace::SurfelSet pboundary;
+      Surfaces< PKSpace >::trackBoundary( pboundary, PK, SAdj, shape, bel );
+      REQUIRE( pboundary.size() == boundary.size() );
+      REQUIRE( std::set< PKSpace::SCell >( pboundary.begin(), pboundary.end() ) == boundary );
+
+      PKSpace::SurfelSet pclosed;
+      Surfaces< PKSpace >::trackClosedBoundary( pclosed, PK, SAdj, shape, bel );
+      REQUIRE( pclosed == pboundary );
+
+      PKSpace::SurfelSet pall;
+      Surfaces< PKSpace >::sMakeBoundary( pall, PK, shape, PK.lowerBound(), PK.upperBound() );
+      REQUIRE( pall == pboundary );
+    }
+
+  SECTION( "Digital surfaces and complexes" )
+    {
+      PKSpace::SurfelSet pboundary;
+      Surfaces< PKSpace >::sMakeBoundary( pboundary, PK, shape, PK.lowerBound(), PK.upperBound() );
+      typedef SetOfSurfels< PKSpace > Container;
+      DigitalSurface< Container > surface( new Container( PK, SAdj, pboundary ) );
+      REQUIRE( surface.size() == pboundary.size() );
+      // A closed surface: every surfel has four neighbors.
+      unsigned int nbOk = 0;
+      for ( auto const & s : surface )
+        nbOk += surface.degree( s ) == 4 ? 1 : 0;
+      REQUIRE( nbOk == surface.size() );
+
+      CubicalComplex< PKSpace > complex( PK );
+      for ( auto const & s : pboundary )
+        complex.insertCell( PK.unsigns( s ) );
+      complex.close();
+      REQUIRE( complex.euler() == 2 );
+    }
+}
+
+/** @ingroup Tests **/
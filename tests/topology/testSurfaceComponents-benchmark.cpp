@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfaceComponents-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the extraction of all the boundary components of a
+ * porous volume: surface tracking from each unmarked bel versus the
+ * one-pass union-find labelling of Surfaces::sMakeBoundaryComponents
+ * (Shortcuts::getSurfelComponents).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <random>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef Shortcuts< Z3i::KSpace > SH3;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking Surfaces::sMakeBoundaryComponents.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Generates a porous volume: a solid block crossed by random
+ * spherical pores, some of them containing a floating grain, plus
+ * isolated grains around the block. Every pore, grain and the block
+ * itself gives (at least) one boundary component.
+ *
+ * @param n the size of the volume.
+ * @param nbPores the number of pores.
+ * @return the binary image of the volume.
+ */
+CountedPtr<SH3::BinaryImage> makePorousVolume( int n, int nbPores )
+{
+  SH3::Domain domain( SH3::Point::diagonal( 0 ), SH3::Point::diagonal( n - 1 ) );
+  auto image = SH3::makeBinaryImage( domain );
+  const int margin = n / 8;
+  for ( auto&& p : domain )
+    image->setValue( p, p[ 0 ] >= margin && p[ 0 ] < n - margin
+                     && p[ 1 ] >= margin && p[ 1 ] < n - margin
+                     && p[ 2 ] >= margin && p[ 2 ] < n - margin );
+  std::mt19937 gen( 13 );
+  std::uniform_int_distribution< int > center( 0, n - 1 );
+  std::uniform_int_distribution< int > radius( 1, 4 );
+  for ( int i = 0; i < nbPores; ++i )
+    {
+      const SH3::Point c( center( gen ), center( gen ), center( gen ) );
+      const int r = radius( gen );
+      const bool pore = (*image)( c );
+      const SH3::Domain box( ( c - SH3::Point::diagonal( r ) ).sup( domain.lowerBound() ),
+                             ( c + SH3::Point::diagonal( r ) ).inf( domain.upperBound() ) );
+      for ( auto&& p : box )
+        {
+          const auto d2 = ( p - c ).dot( p - c );
+          if ( d2 <= r * r ) image->setValue( p, ! pore );
+          // A grain inside the largest pores.
+          if ( pore && r >= 3 && d2 == 0 ) image->setValue( p, true );
+        }
+    }
+  return image;
+}
+
+/**
+ * Extracts all the boundary components by tracking, from each
+ * boundary surfel not yet marked, the light digital surface
+ * containing it (the former approach of
+ * Shortcuts::makeLightDigitalSurfaces).
+ *
+ * @return the number of components.
+ */
+std::size_t trackAllComponents( CountedPtr<SH3::BinaryImage> bimage,
+                                const SH3::KSpace & K,
+                                std::size_t & largest )
+{
+  SurfelAdjacency< 3 > surfAdj( false );
+  SH3::SurfelSet all_surfels;
+  Surfaces< SH3::KSpace >::sMakeBoundary( all_surfels, K, *bimage,
+                                          K.lowerBound(), K.upperBound() );
+  SH3::SurfelSet marked_surfels;
+  std::size_t nb = 0;
+  largest = 0;
+  for ( auto bel : all_surfels )
+    {
+      if ( marked_surfels.count( bel ) != 0 ) continue;
+      SH3::LightDigitalSurface surface
+        ( new SH3::LightSurfaceContainer( K, *bimage, surfAdj, bel ) );
+      marked_surfels.insert( surface.begin(), surface.end() );
+      largest = std::max( largest, (std::size_t) surface.size() );
+      ++nb;
+    }
+  return nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int, char** )
+{
+  bool res = true;
+  trace.beginBlock ( "Benchmarking the extraction of the boundary components of porous volumes" );
+  const int sizes[ 2 ]   = { 64, 128 };
+  const int nbPores[ 2 ] = { 400, 3200 };
+  for ( int i = 0; i < 2; ++i )
+    {
+      trace.beginBlock( "Porous volume generation" );
+      auto bimage = makePorousVolume( sizes[ i ], nbPores[ i ] );
+      auto K      = SH3::getKSpace( bimage );
+      trace.info() << sizes[ i ] << "^3 volume, " << nbPores[ i ] << " pores and grains." << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "Tracking from each unmarked bel" );
+      std::size_t largest_tracked = 0;
+      std::size_t nb_tracked = trackAllComponents( bimage, K, largest_tracked );
+      trace.info() << nb_tracked << " components, the largest has "
+                   << largest_tracked << " surfels." << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "One-pass union-find labelling (Shortcuts::getSurfelComponents)" );
+      auto components = SH3::getSurfelComponents( bimage, K );
+      trace.info() << components.size() << " components, the largest has "
+                   << components[ 0 ].size() << " surfels." << std::endl;
+      trace.endBlock();
+
+      trace.beginBlock( "Largest component (Shortcuts::makeLargestDigitalSurface)" );
+      auto surface = SH3::makeLargestDigitalSurface( bimage, K );
+      trace.info() << surface->size() << " surfels." << std::endl;
+      trace.endBlock();
+
+      res = res && nb_tracked == components.size()
+        && largest_tracked == components[ 0 ].size()
+        && surface->size() == largest_tracked;
+    }
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -262,6 +262,160 @@ test3dSurfaceHelper()
 }
 
 
+/**
+* Checks that Surfaces::sMakeBoundaryComponents finds the same
+* components as the tracking of Surfaces::extractAllConnectedSCell.
+*/
+bool testBoundaryComponents()
+{
+  typedef Z3i::Domain                Domain;
+  typedef Z3i::Point                 Point;
+  typedef Z3i::SCell                 SCell;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing Surfaces::sMakeBoundaryComponents." );
+  Point p1( -12, -12, -12 );
+  Point p2(  12,  12,  12 );
+  Z3i::KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  // A hollow ball, a ball inside its cavity, two balls touching by an
+  // edge, and a ball cut by the domain border.
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( -4, -4, -4 ), 7 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( -4, -4, -4 ), 5 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( -4, -4, -4 ), 2 );
+  aSet.insert( Point( 6, 6, 6 ) );
+  aSet.insert( Point( 7, 7, 6 ) );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 12, -8, 8 ), 3 );
+  for ( int adj = 0; adj < 2; ++adj )
+    {
+      SurfelAdjacency<3> SAdj( adj == 1 );
+      std::vector< std::vector<SCell> > tracked, labelled;
+      Surfaces<Z3i::KSpace>::extractAllConnectedSCell( tracked, K, SAdj, aSet, false );
+      std::size_t nbc = Surfaces<Z3i::KSpace>::sMakeBoundaryComponents
+        ( labelled, K, SAdj, aSet, p1, p2 );
+      ++nb; nbok += ( nbc == labelled.size() && nbc == tracked.size() ) ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << " adj=" << adj << " nb components=" << nbc
+                   << " (should be " << tracked.size() << ")" << std::endl;
+      std::vector< std::set<SCell> > tracked_sets, labelled_sets;
+      for ( auto && c : tracked )  tracked_sets.push_back( std::set<SCell>( c.begin(), c.end() ) );
+      for ( auto && c : labelled ) labelled_sets.push_back( std::set<SCell>( c.begin(), c.end() ) );
+      std::sort( tracked_sets.begin(), tracked_sets.end() );
+      std::sort( labelled_sets.begin(), labelled_sets.end() );
+      ++nb; nbok += tracked_sets == labelled_sets ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << " same components as tracking" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+* Checks that the parallel versions of sMakeBoundary, trackBoundary,
+* trackSurface and extractAllConnectedSCell give the same results as
+* the sequential ones.
+*/
+bool testParallelSurfaces()
+{
+  typedef Z3i::Domain                Domain;
+  typedef Z3i::Point                 Point;
+  typedef Z3i::SCell                 SCell;
+  typedef DigitalSetBySTLSet<Domain> DigitalSet;
+  typedef Surfaces<Z3i::KSpace>      Surf;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing parallel versions of Surfaces services." );
+  Point p1( -14, -12, -10 );
+  Point p2(  14,  12,  10 );
+  Z3i::KSpace K; K.init( p1, p2, true );
+  Domain domain( p1, p2 );
+  DigitalSet aSet( domain );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( -4, -3, -1 ), 8 );
+  Shapes<Domain>::removeNorm2Ball( aSet, Point( -4, -3, -1 ), 3 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 9, 7, 5 ), 4 );
+  Shapes<Domain>::addNorm2Ball( aSet, Point( 14, -12, 10 ), 5 );
+  SurfelAdjacency<3> SAdj( true );
+  std::set<SCell> bdry;
+  Surf::sMakeBoundary( bdry, K, aSet, p1, p2 );
+  SCell bel = *bdry.begin();
+  std::set<SCell> tracked;
+  Surf::trackBoundary( tracked, K, SAdj, aSet, bel );
+  std::set<SCell> surface( bdry );
+  functors::SurfelSetPredicate< std::set<SCell>, SCell > surfPred( surface );
+  std::set<SCell> tracked_surface;
+  Surf::trackSurface( tracked_surface, K, SAdj, surfPred, bel );
+  std::vector< std::vector<SCell> > components;
+  Surf::extractAllConnectedSCell( components, K, SAdj, aSet, true );
+  for ( unsigned int nbThreads = 1; nbThreads <= 4; nbThreads += 3 )
+    {
+      std::set<SCell> pbdry;
+      Surf::sMakeBoundary( pbdry, K, aSet, p1, p2, nbThreads );
+      ++nb; nbok += pbdry == bdry ? 1 : 0;
+      std::set<SCell> ptracked;
+      Surf::trackBoundary( ptracked, K, SAdj, aSet, bel, nbThreads );
+      ++nb; nbok += ptracked == tracked ? 1 : 0;
+      std::set<SCell> ptracked_surface;
+      Surf::trackSurface( ptracked_surface, K, SAdj, surfPred, bel, nbThreads );
+      ++nb; nbok += ptracked_surface == tracked_surface ? 1 : 0;
+      std::vector< std::vector<SCell> > pcomponents;
+      Surf::extractAllConnectedSCell( pcomponents, K, SAdj, aSet, true, nbThreads );
+      ++nb; nbok += pcomponents == components ? 1 : 0;
+      // Small tiles: the candidates of each level are merged from
+      // several tiles.
+      std::set<SCell> ttracked;
+      Surf::trackBoundary( ttracked, K, SAdj, aSet, bel, nbThreads, 16 );
+      ++nb; nbok += ttracked == tracked ? 1 : 0;
+      std::set<SCell> ttracked_surface;
+      Surf::trackSurface( ttracked_surface, K, SAdj, surfPred, bel, nbThreads, 16 );
+      ++nb; nbok += ttracked_surface == tracked_surface ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << nbThreads << " threads: " << pbdry.size() << " bels, "
+                   << ptracked.size() << " tracked, " << pcomponents.size()
+                   << " components" << std::endl;
+    }
+
+  // A thick sphere, whose surfels span several tiles of
+  // sMakeBoundaryComponents and whose levels span several tiles of
+  // the tracking.
+  Point q1( -26, -26, -26 );
+  Point q2(  26,  26,  26 );
+  Z3i::KSpace K2; K2.init( q1, q2, true );
+  Domain domain2( q1, q2 );
+  DigitalSet shell( domain2 );
+  Shapes<Domain>::addNorm2Ball( shell, Point( 0, 0, 0 ), 24 );
+  Shapes<Domain>::removeNorm2Ball( shell, Point( 0, 0, 0 ), 18 );
+  std::set<SCell> bdry2;
+  Surf::sMakeBoundary( bdry2, K2, shell, q1, q2 );
+  SCell bel2 = *bdry2.begin();
+  std::set<SCell> tracked2;
+  Surf::trackBoundary( tracked2, K2, SAdj, shell, bel2 );
+  std::vector< std::vector<SCell> > components2;
+  Surf::extractAllConnectedSCell( components2, K2, SAdj, shell, true );
+  for ( unsigned int nbThreads = 1; nbThreads <= 4; nbThreads += 3 )
+    {
+      std::set<SCell> ptracked;
+      Surf::trackBoundary( ptracked, K2, SAdj, shell, bel2, nbThreads, 64 );
+      ++nb; nbok += ptracked == tracked2 ? 1 : 0;
+      std::vector< std::vector<SCell> > pcomponents;
+      std::size_t nbc = Surf::sMakeBoundaryComponents
+        ( pcomponents, K2, SAdj, shell, q1, q2, nbThreads );
+      std::size_t nbSurfels = 0;
+      for ( auto const & c : pcomponents ) nbSurfels += c.size();
+      ++nb; nbok += nbc == components2.size() && nbSurfels == bdry2.size() ? 1 : 0;
+      std::vector< std::vector<SCell> > ecomponents;
+      Surf::extractAllConnectedSCell( ecomponents, K2, SAdj, shell, true, nbThreads );
+      ++nb; nbok += ecomponents == components2 ? 1 : 0;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << nbThreads << " threads: " << bdry2.size() << " bels, "
+                   << ptracked.size() << " tracked, " << nbc
+                   << " components" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 /**
 * Checks that method Surfaces::findABel can take in argument any pair
 * of points (one inside, one outside) to determine a boundary surfel
@@ -327,7 +481,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testComputeInterior()
-    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper();
+    && testFindABel< KhalimskySpaceND<3,int> >()  && test3dSurfaceHelper()
+    && testBoundaryComponents() && testParallelSurfaces();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
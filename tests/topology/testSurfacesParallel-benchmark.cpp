@@ -0,0 +1,136 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSurfacesParallel-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the sequential and parallel versions of
+ * Surfaces::sMakeBoundary, Surfaces::trackBoundary and
+ * Surfaces::extractAllConnectedSCell.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ParallelFor.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/HashedKhalimskySpaceND.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the parallel services of Surfaces.
+///////////////////////////////////////////////////////////////////////////////
+namespace DGtal {
+  template <typename TPoint3>
+  struct ImplicitDigitalEllipse3 {
+    typedef TPoint3 Point;
+    inline
+    ImplicitDigitalEllipse3( double a, double b, double c )
+      : myA( a ), myB( b ), myC( c )
+    {}
+    inline
+    bool operator()( const TPoint3 & p ) const
+    {
+      double x = ( (double) p[ 0 ] / myA );
+      double y = ( (double) p[ 1 ] / myB );
+      double z = ( (double) p[ 2 ] / myC );
+      return ( x*x + y*y + z*z ) <= 1.0;
+    }
+    double myA, myB, myC;
+  };
+
+  /**
+   * Runs the sequential (nbThreads == 1 and sequential == true) or
+   * parallel services of Surfaces on a shape.
+   *
+   * @return the numbers of bels, of tracked surfels and of components.
+   */
+  template <typename KSpace, typename PointPredicate>
+  std::vector<std::size_t>
+  benchmarkSurfaces( const std::string & name,
+                     const KSpace & K,
+                     const PointPredicate & pp,
+                     bool sequential, unsigned int nbThreads )
+  {
+    typedef Surfaces< KSpace > Surf;
+    SurfelAdjacency< KSpace::dimension > SAdj( true );
+    std::vector<std::size_t> result;
+
+    trace.beginBlock( name + " sMakeBoundary" );
+    typename KSpace::SurfelSet bdry;
+    if ( sequential ) Surf::sMakeBoundary( bdry, K, pp, K.lowerBound(), K.upperBound() );
+    else Surf::sMakeBoundary( bdry, K, pp, K.lowerBound(), K.upperBound(), nbThreads );
+    trace.info() << bdry.size() << " bels." << std::endl;
+    result.push_back( bdry.size() );
+    trace.endBlock();
+
+    trace.beginBlock( name + " trackBoundary" );
+    typename KSpace::SurfelSet surface;
+    const auto bel = Surf::findABel( K, pp, 10000 );
+    if ( sequential ) Surf::trackBoundary( surface, K, SAdj, pp, bel );
+    else Surf::trackBoundary( surface, K, SAdj, pp, bel, nbThreads );
+    trace.info() << surface.size() << " surfels." << std::endl;
+    result.push_back( surface.size() );
+    trace.endBlock();
+
+    trace.beginBlock( name + " extractAllConnectedSCell" );
+    std::vector< std::vector< typename KSpace::SCell > > components;
+    if ( sequential ) Surf::extractAllConnectedSCell( components, K, SAdj, pp );
+    else Surf::extractAllConnectedSCell( components, K, SAdj, pp, false, nbThreads );
+    trace.info() << components.size() << " components." << std::endl;
+    result.push_back( components.size() );
+    trace.endBlock();
+    return result;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int, char** )
+{
+  using namespace Z3i;
+  typedef DGtal::ImplicitDigitalEllipse3<Point> ImplicitDigitalEllipse;
+  typedef HashedKhalimskySpaceND< 3, DGtal::int32_t > HKSpace;
+
+  trace.beginBlock ( "Benchmarking sequential and parallel services of Surfaces" );
+  Point p1( -120, -120, -120 );
+  Point p2( 120, 120, 120 );
+  ImplicitDigitalEllipse ellipse( 110.0, 80.0, 60.0 );
+  HKSpace K;
+  K.init( p1, p2, true );
+  const unsigned int nbThreads = ParallelFor::nbThreads();
+  trace.info() << nbThreads << " threads." << std::endl;
+  auto seq = benchmarkSurfaces( "Sequential", K, ellipse, true, 1 );
+  auto one = benchmarkSurfaces( "Parallel, 1 thread", K, ellipse, false, 1 );
+  auto par = benchmarkSurfaces( "Parallel", K, ellipse, false, nbThreads );
+  bool res = ( seq == one ) && ( seq == par ) && ( seq[ 2 ] == 1 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////